@@ -8,6 +8,7 @@
 #include "Common/Constants.hlsli"
 #include "Common/Math.hlsli"
 #include "Resources/ConstantBuffers.hlsli"
+#include "Resources/ObjectData.hlsli"
 
 #include "Geometry/VertexInput.hlsli"
 #include "Geometry/VertexOutput.hlsli"
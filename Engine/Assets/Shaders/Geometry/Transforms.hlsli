@@ -6,9 +6,9 @@
 // Position Transforms
 // -----------------------------------------------------------------------------
 
-float4 PositionLocalToWorld(float4 localPosition)
+float4 PositionLocalToWorld(float4 localPosition, float4x4 worldMTX)
 {
-	return mul(localPosition, WorldMTX);
+	return mul(localPosition, worldMTX);
 }
 
 float4 PositionWorldToView(float4 worldPosition)
@@ -21,9 +21,9 @@ float4 PositionViewToClip(float4 viewPosition)
 	return mul(viewPosition, ProjectionMTX);
 }
 
-float4 PositionLocalToClip(float4 localPosition)
+float4 PositionLocalToClip(float4 localPosition, float4x4 worldMTX)
 {
-	const float4 worldPosition = PositionLocalToWorld(localPosition);
+	const float4 worldPosition = PositionLocalToWorld(localPosition, worldMTX);
 	const float4 viewPosition = PositionWorldToView(worldPosition);
 	return PositionViewToClip(viewPosition);
 }
@@ -38,15 +38,15 @@ float4 PositionWorldToClip(float4 worldPosition)
 // -----------------------------------------------------------------------------
 
 // Transform normal from local to world space (handles non-uniform scale)
-float3 NormalLocalToWorld(float3 normalLocal)
+float3 NormalLocalToWorld(float3 normalLocal, float3x3 worldInvTransposeMTX)
 {
-	return normalize(mul(normalLocal, WorldInvTransposeMTX));
+	return normalize(mul(normalLocal, worldInvTransposeMTX));
 }
 
 // Transform tangent from local to world space (direction only)
-float4 TangentLocalToWorld(float4 tangentLocal)
+float4 TangentLocalToWorld(float4 tangentLocal, float4x4 worldMTX)
 {
-	const float3 worldTangent = mul(tangentLocal.xyz, (float3x3) WorldMTX);
+	const float3 worldTangent = mul(tangentLocal.xyz, (float3x3) worldMTX);
 	return float4(worldTangent, tangentLocal.w);  // Preserve handedness
 }
 
@@ -14,5 +14,6 @@ namespace VS
 		float4 Color : COLOR;
 		float3 Normal : NORMAL;
 		float4 Tangent : TANGENT;  // xyz = tangent, w = handedness (+1 or -1)
+		uint InstanceID : SV_InstanceID;  // Relative to the bound instance ID range
 	};
 }  // namespace VS
@@ -15,6 +15,21 @@
 
 Texture2D TextureBaseColor : register(t0);
 
+// -----------------------------------------------------------------------------
+// Material Table (t3) — mirrors MaterialRecord in D3D12ConstantBufferData.h
+// -----------------------------------------------------------------------------
+
+struct MaterialRecord
+{
+	float4 BaseColor;       // RGBA base/albedo color or tint
+	float Metallic;         // PBR metallic [0,1]
+	float Roughness;        // PBR roughness [0,1]
+	float F0;               // PBR reflectance at normal incidence
+	uint AlbedoTextureIdx;  // 0xFFFFFFFF = no texture bound
+};
+
+StructuredBuffer<MaterialRecord> MaterialTable : register(t3);
+
 // -----------------------------------------------------------------------------
 // Material Namespace
 // -----------------------------------------------------------------------------
@@ -2,15 +2,18 @@
 // Forward Lit Vertex Shader
 // =============================================================================
 // Basic vertex transformation with world-space outputs for PBR lighting.
+// Transforms come from the per-object buffer, reached through SV_InstanceID.
 
 #include "CommonVS.hlsli"
 
 void main(in VS::Input Input, out VS::Output Output)
 {
+	const ObjectData objectData = LoadInstanceObject(Input.InstanceID);
+
 	// Transform local-space vectors to world space
-	const float4 positionWorld = PositionLocalToWorld(float4(Input.Position, 1.0f));
-	const float3 normalWorld = NormalLocalToWorld(Input.Normal);
-	const float4 tangentWorld = TangentLocalToWorld(Input.Tangent);
+	const float4 positionWorld = PositionLocalToWorld(float4(Input.Position, 1.0f), objectData.WorldMTX);
+	const float3 normalWorld = NormalLocalToWorld(Input.Normal, (float3x3) objectData.WorldInvTransposeMTX);
+	const float4 tangentWorld = TangentLocalToWorld(Input.Tangent, objectData.WorldMTX);
 
 	// Reconstruct bitangent from world normal/tangent
 	const float3 bitangentWorld = ComputeBitangent(normalWorld, tangentWorld);
@@ -3,7 +3,9 @@
 // =============================================================================
 // Constant Buffer Definitions
 // =============================================================================
-// Layout: b0 = PerFrame, b1 = PerView, b2 = PerObject VS, b3 = PerObject PS
+// Layout: b0 = PerFrame, b1 = PerView, b3 = material index (root constant)
+// Per-object transforms live in the per-object buffer (ObjectData.hlsli),
+// material parameters in the material table (Material.hlsli)
 
 // -----------------------------------------------------------------------------
 // Per-Frame CB (b0) — updated once per CPU frame, shared by all draws
@@ -46,27 +48,9 @@ cbuffer PerViewConstantBufferData : register(b1)
 };
 
 // -----------------------------------------------------------------------------
-// Per-Object VS CB (b2) — updated per draw call (transforms)
+// Material Index (b3) — root constant, set per instanced draw
 // -----------------------------------------------------------------------------
-cbuffer PerObjectVSConstantBufferData : register(b2)
+cbuffer MaterialIndexConstants : register(b3)
 {
-	row_major float4x4 WorldMTX;              // Local -> World
-	row_major float3x3 WorldInvTransposeMTX;  // Normal transform (3x3) -> correct under non-uniform scale
-
-	// remaining space in the 256-byte slot is reserved for future use
-};
-
-// -----------------------------------------------------------------------------
-// Per-Object PS CB (b3) — updated per draw call (material scalars)
-// -----------------------------------------------------------------------------
-cbuffer PerObjectPSConstantBufferData : register(b3)
-{
-	float4 BaseColor;  // RGBA base/albedo color or tint
-
-	float Metallic;          // PBR metallic [0,1]
-	float Roughness;         // PBR roughness [0,1]
-	float F0;                // PBR reflectance at normal incidence
-	float _padPerObjectPS0;  // pad to 16 bytes
-
-	// remaining space reserved
+	uint MaterialIndex;  // Index into MaterialTable (t3)
 };
@@ -0,0 +1,23 @@
+#pragma once
+
+// =============================================================================
+// Per-Object Data
+// =============================================================================
+// Layout: t1 = PerObjectData[] indexed by object ID (mirrors PerObjectData in
+//         D3D12ConstantBufferData.h), t2 = instance -> object ID.
+// t2 is bound per instanced draw at the batch's first instance, so
+// SV_InstanceID indexes it directly.
+
+struct ObjectData
+{
+	row_major float4x4 WorldMTX;              // Local -> World
+	row_major float3x4 WorldInvTransposeMTX;  // Normal transform (upper 3x3 used) -> correct under non-uniform scale
+};
+
+StructuredBuffer<ObjectData> ObjectBuffer : register(t1);
+StructuredBuffer<uint> InstanceObjectIds : register(t2);
+
+ObjectData LoadInstanceObject(uint instanceID)
+{
+	return ObjectBuffer[InstanceObjectIds[instanceID]];
+}
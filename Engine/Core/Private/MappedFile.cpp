@@ -0,0 +1,146 @@
+// ============================================================================
+// MappedFile.cpp
+// ----------------------------------------------------------------------------
+// Read-only file mapping: MapViewOfFile on Windows, mmap elsewhere.
+// ============================================================================
+
+#include "PCH.h"
+
+#include "MappedFile.h"
+
+#if !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Engine::FileSystem
+{
+
+	MappedFile::~MappedFile() noexcept
+	{
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept : m_data(other.m_data), m_size(other.m_size)
+	{
+		other.m_data = nullptr;
+		other.m_size = 0;
+	}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+			m_data = other.m_data;
+			m_size = other.m_size;
+			other.m_data = nullptr;
+			other.m_size = 0;
+		}
+		return *this;
+	}
+
+#if defined(_WIN32)
+
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		Close();
+
+		HANDLE file = CreateFileW(
+		    path.c_str(),
+		    GENERIC_READ,
+		    FILE_SHARE_READ,
+		    nullptr,
+		    OPEN_EXISTING,
+		    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		    nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if (!mapping)
+		{
+			return false;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);  // View keeps the mapping object alive
+		if (!view)
+		{
+			return false;
+		}
+
+		m_data = static_cast<const std::byte*>(view);
+		m_size = static_cast<std::size_t>(fileSize.QuadPart);
+		return true;
+	}
+
+	void MappedFile::Close() noexcept
+	{
+		if (m_data)
+		{
+			UnmapViewOfFile(m_data);
+			m_data = nullptr;
+			m_size = 0;
+		}
+	}
+
+#else
+
+	bool MappedFile::Open(const std::filesystem::path& path)
+	{
+		Close();
+
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			return false;
+		}
+
+		struct stat fileStat{};
+		if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		const auto size = static_cast<std::size_t>(fileStat.st_size);
+		void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);  // Mapping holds its own reference to the file
+		if (view == MAP_FAILED)
+		{
+			return false;
+		}
+
+		::madvise(view, size, MADV_SEQUENTIAL);
+
+		m_data = static_cast<const std::byte*>(view);
+		m_size = size;
+		return true;
+	}
+
+	void MappedFile::Close() noexcept
+	{
+		if (m_data)
+		{
+			::munmap(const_cast<std::byte*>(m_data), m_size);
+			m_data = nullptr;
+			m_size = 0;
+		}
+	}
+
+#endif
+
+}  // namespace Engine::FileSystem
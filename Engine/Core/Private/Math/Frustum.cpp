@@ -7,6 +7,19 @@
 #include "PCH.h"
 #include "Frustum.h"
 
+#include <bit>
+#include <cstring>
+
+// SIMD width for the batch tests; DirectXMath's own intrinsics switch decides
+// whether SSE is available at all
+#if !defined(_XM_NO_INTRINSICS_) && defined(__AVX2__)
+	#include <immintrin.h>
+	#define SPARKLE_FRUSTUM_AVX2 1
+#elif !defined(_XM_NO_INTRINSICS_) && defined(_XM_SSE_INTRINSICS_)
+	#include <emmintrin.h>
+	#define SPARKLE_FRUSTUM_SSE 1
+#endif
+
 using namespace DirectX;
 
 void Frustum::ExtractFromViewProjection(const XMFLOAT4X4& viewProj) noexcept
@@ -103,3 +116,283 @@ bool Frustum::IntersectsAABB(const XMFLOAT3& min, const XMFLOAT3& max) const noe
 	}
 	return true;
 }
+
+// ============================================================================
+// Batch Tests
+// ============================================================================
+
+namespace FrustumInternal
+{
+	// ------------------------------------------------------------------------
+	// Scalar (tail, fallback and plane-cache path)
+	// ------------------------------------------------------------------------
+
+	inline float PlaneDistance(const XMFLOAT4& plane, float x, float y, float z) noexcept
+	{
+		return plane.x * x + plane.y * y + plane.z * z + plane.w;
+	}
+
+	bool SphereVisible(const Frustum& frustum, const Frustum::SphereBatch& batch, std::uint32_t i, std::uint8_t* planeCache) noexcept
+	{
+		const float x = batch.centerX[i];
+		const float y = batch.centerY[i];
+		const float z = batch.centerZ[i];
+		const float negRadius = -batch.radius[i];
+
+		// Temporal coherence: the plane that rejected last time likely still does
+		if (planeCache && planeCache[i] < Frustum::Count &&
+		    PlaneDistance(frustum.planes[planeCache[i]], x, y, z) < negRadius)
+		{
+			return false;
+		}
+
+		for (std::uint8_t p = 0; p < Frustum::Count; ++p)
+		{
+			if (PlaneDistance(frustum.planes[p], x, y, z) < negRadius)
+			{
+				if (planeCache)
+					planeCache[i] = p;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool AABBVisible(const Frustum& frustum, const Frustum::AABBBatch& batch, std::uint32_t i, std::uint8_t* planeCache) noexcept
+	{
+		// Distance of the corner furthest along the plane normal
+		const auto positiveDistance = [&](const XMFLOAT4& plane)
+		{
+			return PlaneDistance(
+			    plane,
+			    plane.x >= 0.0f ? batch.maxX[i] : batch.minX[i],
+			    plane.y >= 0.0f ? batch.maxY[i] : batch.minY[i],
+			    plane.z >= 0.0f ? batch.maxZ[i] : batch.minZ[i]);
+		};
+
+		if (planeCache && planeCache[i] < Frustum::Count && positiveDistance(frustum.planes[planeCache[i]]) < 0.0f)
+		{
+			return false;
+		}
+
+		for (std::uint8_t p = 0; p < Frustum::Count; ++p)
+		{
+			if (positiveDistance(frustum.planes[p]) < 0.0f)
+			{
+				if (planeCache)
+					planeCache[i] = p;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// ------------------------------------------------------------------------
+	// SIMD (kLaneCount objects per iteration, returns a lane bitmask)
+	// ------------------------------------------------------------------------
+
+#if defined(SPARKLE_FRUSTUM_AVX2)
+
+	constexpr std::uint32_t kLaneCount = 8;
+	using Lanes = __m256;
+
+	inline Lanes Broadcast(float v) noexcept { return _mm256_set1_ps(v); }
+	inline Lanes Load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+	inline Lanes Add(Lanes a, Lanes b) noexcept { return _mm256_add_ps(a, b); }
+	inline Lanes Mul(Lanes a, Lanes b) noexcept { return _mm256_mul_ps(a, b); }
+	inline Lanes Negate(Lanes a) noexcept { return _mm256_sub_ps(_mm256_setzero_ps(), a); }
+	inline Lanes And(Lanes a, Lanes b) noexcept { return _mm256_and_ps(a, b); }
+	inline Lanes GreaterEqual(Lanes a, Lanes b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	inline Lanes AllTrue() noexcept { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+	inline std::uint32_t MoveMask(Lanes a) noexcept { return static_cast<std::uint32_t>(_mm256_movemask_ps(a)); }
+
+#elif defined(SPARKLE_FRUSTUM_SSE)
+
+	constexpr std::uint32_t kLaneCount = 4;
+	using Lanes = __m128;
+
+	inline Lanes Broadcast(float v) noexcept { return _mm_set1_ps(v); }
+	inline Lanes Load(const float* p) noexcept { return _mm_loadu_ps(p); }
+	inline Lanes Add(Lanes a, Lanes b) noexcept { return _mm_add_ps(a, b); }
+	inline Lanes Mul(Lanes a, Lanes b) noexcept { return _mm_mul_ps(a, b); }
+	inline Lanes Negate(Lanes a) noexcept { return _mm_sub_ps(_mm_setzero_ps(), a); }
+	inline Lanes And(Lanes a, Lanes b) noexcept { return _mm_and_ps(a, b); }
+	inline Lanes GreaterEqual(Lanes a, Lanes b) noexcept { return _mm_cmpge_ps(a, b); }
+	inline Lanes AllTrue() noexcept { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+	inline std::uint32_t MoveMask(Lanes a) noexcept { return static_cast<std::uint32_t>(_mm_movemask_ps(a)); }
+
+#else
+
+	constexpr std::uint32_t kLaneCount = 1;
+
+#endif
+
+#if defined(SPARKLE_FRUSTUM_AVX2) || defined(SPARKLE_FRUSTUM_SSE)
+
+	// Plane components broadcast once per batch
+	struct PlaneLanes
+	{
+		Lanes x[Frustum::Count];
+		Lanes y[Frustum::Count];
+		Lanes z[Frustum::Count];
+		Lanes w[Frustum::Count];
+
+		explicit PlaneLanes(const Frustum& frustum) noexcept
+		{
+			for (int p = 0; p < Frustum::Count; ++p)
+			{
+				x[p] = Broadcast(frustum.planes[p].x);
+				y[p] = Broadcast(frustum.planes[p].y);
+				z[p] = Broadcast(frustum.planes[p].z);
+				w[p] = Broadcast(frustum.planes[p].w);
+			}
+		}
+	};
+
+	inline Lanes PlaneDistance(const PlaneLanes& planes, int p, Lanes x, Lanes y, Lanes z) noexcept
+	{
+		return Add(Add(Mul(planes.x[p], x), Mul(planes.y[p], y)), Add(Mul(planes.z[p], z), planes.w[p]));
+	}
+
+	std::uint32_t SphereLanesVisible(const PlaneLanes& planes, const Frustum::SphereBatch& batch, std::uint32_t i) noexcept
+	{
+		const Lanes x = Load(batch.centerX + i);
+		const Lanes y = Load(batch.centerY + i);
+		const Lanes z = Load(batch.centerZ + i);
+		const Lanes negRadius = Negate(Load(batch.radius + i));
+
+		Lanes inside = AllTrue();
+		for (int p = 0; p < Frustum::Count; ++p)
+		{
+			inside = And(inside, GreaterEqual(PlaneDistance(planes, p, x, y, z), negRadius));
+		}
+		return MoveMask(inside);
+	}
+
+	std::uint32_t AABBLanesVisible(
+	    const Frustum& frustum,
+	    const PlaneLanes& planes,
+	    const Frustum::AABBBatch& batch,
+	    std::uint32_t i) noexcept
+	{
+		const Lanes zero = Broadcast(0.0f);
+
+		Lanes inside = AllTrue();
+		for (int p = 0; p < Frustum::Count; ++p)
+		{
+			// Positive-vertex selection depends only on the plane, not the lane
+			const XMFLOAT4& plane = frustum.planes[p];
+			const Lanes x = Load((plane.x >= 0.0f ? batch.maxX : batch.minX) + i);
+			const Lanes y = Load((plane.y >= 0.0f ? batch.maxY : batch.minY) + i);
+			const Lanes z = Load((plane.z >= 0.0f ? batch.maxZ : batch.minZ) + i);
+			inside = And(inside, GreaterEqual(PlaneDistance(planes, p, x, y, z), zero));
+		}
+		return MoveMask(inside);
+	}
+
+#endif
+
+	// ------------------------------------------------------------------------
+	// Batch Driver
+	// ------------------------------------------------------------------------
+
+	// Calls sink(firstIndex, laneMask) for every group of objects. Full SIMD
+	// groups come first; the tail (and the plane-cache path) goes one by one.
+	template <typename GroupFn, typename ScalarFn, typename SinkFn>
+	void RunBatch(std::uint32_t count, bool bAllowSimd, GroupFn&& group, ScalarFn&& scalar, SinkFn&& sink) noexcept
+	{
+		std::uint32_t i = 0;
+		if constexpr (kLaneCount > 1)
+		{
+			if (bAllowSimd)
+			{
+				for (; i + kLaneCount <= count; i += kLaneCount)
+				{
+					sink(i, group(i));
+				}
+			}
+		}
+		else
+		{
+			(void) bAllowSimd;
+			(void) group;
+		}
+
+		for (; i < count; ++i)
+		{
+			sink(i, scalar(i) ? 1u : 0u);
+		}
+	}
+
+	// Groups start at multiples of kLaneCount (a divisor of 32), so a lane
+	// mask never straddles two words
+	inline auto MaskSink(std::uint32_t* outMask) noexcept
+	{
+		return [outMask](std::uint32_t first, std::uint32_t laneMask) { outMask[first >> 5] |= laneMask << (first & 31u); };
+	}
+
+	inline auto IndexSink(std::uint32_t* outIndices, std::uint32_t& visibleCount) noexcept
+	{
+		return [outIndices, &visibleCount](std::uint32_t first, std::uint32_t laneMask)
+		{
+			while (laneMask != 0)
+			{
+				outIndices[visibleCount++] = first + static_cast<std::uint32_t>(std::countr_zero(laneMask));
+				laneMask &= laneMask - 1;
+			}
+		};
+	}
+
+	template <typename SinkFn>
+	void RunSpheres(const Frustum& frustum, const Frustum::SphereBatch& batch, std::uint8_t* planeCache, SinkFn&& sink) noexcept
+	{
+#if defined(SPARKLE_FRUSTUM_AVX2) || defined(SPARKLE_FRUSTUM_SSE)
+		const PlaneLanes planes(frustum);
+		const auto group = [&](std::uint32_t i) { return SphereLanesVisible(planes, batch, i); };
+#else
+		const auto group = [](std::uint32_t) { return 0u; };
+#endif
+		const auto scalar = [&](std::uint32_t i) { return SphereVisible(frustum, batch, i, planeCache); };
+		RunBatch(batch.count, planeCache == nullptr, group, scalar, sink);
+	}
+
+	template <typename SinkFn>
+	void RunAABBs(const Frustum& frustum, const Frustum::AABBBatch& batch, std::uint8_t* planeCache, SinkFn&& sink) noexcept
+	{
+#if defined(SPARKLE_FRUSTUM_AVX2) || defined(SPARKLE_FRUSTUM_SSE)
+		const PlaneLanes planes(frustum);
+		const auto group = [&](std::uint32_t i) { return AABBLanesVisible(frustum, planes, batch, i); };
+#else
+		const auto group = [](std::uint32_t) { return 0u; };
+#endif
+		const auto scalar = [&](std::uint32_t i) { return AABBVisible(frustum, batch, i, planeCache); };
+		RunBatch(batch.count, planeCache == nullptr, group, scalar, sink);
+	}
+
+}  // namespace FrustumInternal
+
+void Frustum::TestSpheres(const SphereBatch& batch, std::uint32_t* outVisibleMask, std::uint8_t* planeCache) const noexcept
+{
+	std::memset(outVisibleMask, 0, GetMaskWordCount(batch.count) * sizeof(std::uint32_t));
+	FrustumInternal::RunSpheres(*this, batch, planeCache, FrustumInternal::MaskSink(outVisibleMask));
+}
+
+std::uint32_t Frustum::CullSpheres(const SphereBatch& batch, std::uint32_t* outVisibleIndices, std::uint8_t* planeCache) const noexcept
+{
+	std::uint32_t visibleCount = 0;
+	FrustumInternal::RunSpheres(*this, batch, planeCache, FrustumInternal::IndexSink(outVisibleIndices, visibleCount));
+	return visibleCount;
+}
+
+void Frustum::TestAABBs(const AABBBatch& batch, std::uint32_t* outVisibleMask, std::uint8_t* planeCache) const noexcept
+{
+	std::memset(outVisibleMask, 0, GetMaskWordCount(batch.count) * sizeof(std::uint32_t));
+	FrustumInternal::RunAABBs(*this, batch, planeCache, FrustumInternal::MaskSink(outVisibleMask));
+}
+
+std::uint32_t Frustum::CullAABBs(const AABBBatch& batch, std::uint32_t* outVisibleIndices, std::uint8_t* planeCache) const noexcept
+{
+	std::uint32_t visibleCount = 0;
+	FrustumInternal::RunAABBs(*this, batch, planeCache, FrustumInternal::IndexSink(outVisibleIndices, visibleCount));
+	return visibleCount;
+}
@@ -0,0 +1,103 @@
+// ============================================================================
+// FencedRingAllocator.cpp
+// ----------------------------------------------------------------------------
+// Ring offset allocator with fence-tagged batch retirement.
+// ============================================================================
+
+#include "PCH.h"
+#include "Memory/FencedRingAllocator.h"
+
+#include <bit>
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+FencedRingAllocator::FencedRingAllocator(std::uint64_t capacity) : m_capacity(capacity) {}
+
+void FencedRingAllocator::Reset()
+{
+	m_head = 0;
+	m_usedBytes = 0;
+	m_openBytes = 0;
+	m_batches.clear();
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+OffsetAllocation FencedRingAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0 || size > m_capacity || !std::has_single_bit(alignment))
+	{
+		++m_failedAllocations;
+		return {};
+	}
+
+	// An empty ring restarts at 0, so the largest block fits without wrapping
+	if (m_usedBytes == 0)
+	{
+		m_head = 0;
+	}
+
+	const std::uint64_t alignMask = alignment - 1;
+	std::uint64_t offset = (m_head + alignMask) & ~alignMask;
+	if (offset < m_head || offset > m_capacity - size)
+	{
+		// Skip the tail of the range and start over at 0
+		offset = 0;
+	}
+
+	// The free space starts at the head, so the padding in front of offset
+	// (alignment or the skipped tail) is consumed together with the block
+	const std::uint64_t padding = offset >= m_head ? offset - m_head : m_capacity - m_head;
+	const std::uint64_t bytes = padding + size;
+	if (bytes > m_capacity - m_usedBytes)
+	{
+		++m_failedAllocations;
+		return {};
+	}
+
+	m_head = offset + size;
+	m_usedBytes += bytes;
+	m_openBytes += bytes;
+	return {offset, size};
+}
+
+// ============================================================================
+// Retirement
+// ============================================================================
+
+void FencedRingAllocator::CloseBatch(std::uint64_t fenceValue)
+{
+	if (m_openBytes == 0)
+		return;
+
+	m_batches.push_back({fenceValue, m_openBytes});
+	m_openBytes = 0;
+}
+
+void FencedRingAllocator::Retire(std::uint64_t completedFenceValue)
+{
+	while (!m_batches.empty() && m_batches.front().fenceValue <= completedFenceValue)
+	{
+		m_usedBytes -= m_batches.front().bytes;
+		m_batches.pop_front();
+	}
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+FencedRingAllocatorStats FencedRingAllocator::GetStats() const noexcept
+{
+	FencedRingAllocatorStats stats;
+	stats.capacity = m_capacity;
+	stats.usedBytes = m_usedBytes;
+	stats.openBytes = m_openBytes;
+	stats.batchesInFlight = static_cast<std::uint32_t>(m_batches.size());
+	stats.failedAllocations = m_failedAllocations;
+	return stats;
+}
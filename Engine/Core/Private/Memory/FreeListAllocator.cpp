@@ -0,0 +1,149 @@
+// ============================================================================
+// FreeListAllocator.cpp
+// ----------------------------------------------------------------------------
+// Best-fit offset allocator with coalescing free list.
+// ============================================================================
+
+#include "PCH.h"
+#include "Memory/FreeListAllocator.h"
+
+#include <bit>
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+FreeListAllocator::FreeListAllocator(std::uint64_t capacity) : m_capacity(capacity)
+{
+	Reset();
+}
+
+void FreeListAllocator::Reset()
+{
+	m_freeByOffset.clear();
+	m_freeBySize.clear();
+	m_allocatedBytes = 0;
+	m_allocationCount = 0;
+	if (m_capacity > 0)
+	{
+		InsertFree(0, m_capacity);
+	}
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+OffsetAllocation FreeListAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0 || !std::has_single_bit(alignment))
+		return {};
+
+	// Smallest ranges first; alignment padding may push a candidate over
+	for (auto it = m_freeBySize.lower_bound(size); it != m_freeBySize.end(); ++it)
+	{
+		const std::uint64_t rangeOffset = it->second;
+		const std::uint64_t rangeSize = it->first;
+		const std::uint64_t alignedOffset = (rangeOffset + alignment - 1) & ~(alignment - 1);
+		const std::uint64_t padding = alignedOffset - rangeOffset;
+		if (padding + size > rangeSize)
+			continue;
+
+		EraseFree(m_freeByOffset.find(rangeOffset));
+		if (padding > 0)
+		{
+			InsertFree(rangeOffset, padding);
+		}
+		const std::uint64_t tail = rangeSize - padding - size;
+		if (tail > 0)
+		{
+			InsertFree(alignedOffset + size, tail);
+		}
+
+		m_allocatedBytes += size;
+		++m_allocationCount;
+		return {alignedOffset, size};
+	}
+	return {};
+}
+
+void FreeListAllocator::Free(const OffsetAllocation& allocation)
+{
+	if (!allocation.IsValid() || allocation.size == 0)
+		return;
+
+	std::uint64_t offset = allocation.offset;
+	std::uint64_t size = allocation.size;
+	if (offset + size > m_capacity)
+	{
+		LOG_ERROR("FreeListAllocator: Free of a block outside the capacity");
+		return;
+	}
+
+	// Neighbours: 'next' starts at or after the block, 'prev' before it
+	auto next = m_freeByOffset.lower_bound(offset);
+	auto prev = next == m_freeByOffset.begin() ? m_freeByOffset.end() : std::prev(next);
+	const bool bOverlapsNext = next != m_freeByOffset.end() && next->first < offset + size;
+	const bool bOverlapsPrev = prev != m_freeByOffset.end() && prev->first + prev->second > offset;
+	if (bOverlapsNext || bOverlapsPrev)
+	{
+		LOG_ERROR("FreeListAllocator: double free or foreign block");
+		return;
+	}
+
+	m_allocatedBytes -= allocation.size;
+	--m_allocationCount;
+
+	if (next != m_freeByOffset.end() && next->first == offset + size)
+	{
+		size += next->second;
+		EraseFree(next);
+	}
+	if (prev != m_freeByOffset.end() && prev->first + prev->second == offset)
+	{
+		offset = prev->first;
+		size += prev->second;
+		EraseFree(prev);
+	}
+	InsertFree(offset, size);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+OffsetAllocatorStats FreeListAllocator::GetStats() const noexcept
+{
+	OffsetAllocatorStats stats;
+	stats.capacity = m_capacity;
+	stats.allocatedBytes = m_allocatedBytes;
+	stats.freeBytes = m_capacity - m_allocatedBytes;
+	stats.largestFreeRange = m_freeBySize.empty() ? 0 : m_freeBySize.rbegin()->first;
+	stats.allocationCount = m_allocationCount;
+	stats.freeRangeCount = static_cast<std::uint32_t>(m_freeByOffset.size());
+	return stats;
+}
+
+// ============================================================================
+// Free List
+// ============================================================================
+
+void FreeListAllocator::InsertFree(std::uint64_t offset, std::uint64_t size)
+{
+	m_freeByOffset.emplace(offset, size);
+	m_freeBySize.emplace(size, offset);
+}
+
+void FreeListAllocator::EraseFree(std::map<std::uint64_t, std::uint64_t>::iterator byOffset)
+{
+	auto [first, last] = m_freeBySize.equal_range(byOffset->second);
+	for (auto it = first; it != last; ++it)
+	{
+		if (it->second == byOffset->first)
+		{
+			m_freeBySize.erase(it);
+			break;
+		}
+	}
+	m_freeByOffset.erase(byOffset);
+}
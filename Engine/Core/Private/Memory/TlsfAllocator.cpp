@@ -0,0 +1,307 @@
+// ============================================================================
+// TlsfAllocator.cpp
+// ----------------------------------------------------------------------------
+// Two-level segregated fit offset allocator.
+// ============================================================================
+
+#include "PCH.h"
+#include "Memory/TlsfAllocator.h"
+
+#include <bit>
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+TlsfAllocator::TlsfAllocator(std::uint64_t capacity) : m_capacity(capacity)
+{
+	Reset();
+}
+
+void TlsfAllocator::Reset()
+{
+	m_nodes.clear();
+	m_unusedNodes.clear();
+	m_firstLevelBitmap = 0;
+	m_secondLevelBitmaps.fill(0);
+	m_binHeads.fill(kNone);
+	m_allocatedBytes = 0;
+	m_allocationCount = 0;
+	m_freeBlockCount = 0;
+	if (m_capacity > 0)
+	{
+		InsertFree(CreateNode(0, m_capacity));
+	}
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+OffsetAllocation TlsfAllocator::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0 || !std::has_single_bit(alignment))
+		return {};
+
+	// Worst-case padding is included so any block found can be aligned in place
+	const std::uint64_t alignMask = alignment - 1;
+	if (size > UINT64_MAX - alignMask)
+		return {};
+
+	const std::uint32_t index = FindFreeNode(size, alignMask);
+	if (index == kNone)
+		return {};
+	RemoveFree(index);
+
+	const std::uint64_t blockOffset = m_nodes[index].offset;
+	const std::uint64_t alignedOffset = (blockOffset + alignMask) & ~alignMask;
+	if (alignedOffset > blockOffset)
+	{
+		// Front padding becomes a free block before this one
+		const std::uint32_t front = CreateNode(blockOffset, alignedOffset - blockOffset);
+		const std::uint32_t prev = m_nodes[index].physPrev;
+		m_nodes[front].physPrev = prev;
+		m_nodes[front].physNext = index;
+		if (prev != kNone)
+		{
+			m_nodes[prev].physNext = front;
+		}
+		m_nodes[index].physPrev = front;
+		m_nodes[index].offset = alignedOffset;
+		m_nodes[index].size -= alignedOffset - blockOffset;
+		InsertFree(front);
+	}
+
+	if (m_nodes[index].size > size)
+	{
+		// Remainder becomes a free block after this one
+		const std::uint32_t tail = CreateNode(alignedOffset + size, m_nodes[index].size - size);
+		const std::uint32_t next = m_nodes[index].physNext;
+		m_nodes[tail].physPrev = index;
+		m_nodes[tail].physNext = next;
+		if (next != kNone)
+		{
+			m_nodes[next].physPrev = tail;
+		}
+		m_nodes[index].physNext = tail;
+		m_nodes[index].size = size;
+		InsertFree(tail);
+	}
+
+	m_nodes[index].bUsed = true;
+	m_allocatedBytes += size;
+	++m_allocationCount;
+	return {alignedOffset, size, index};
+}
+
+void TlsfAllocator::Free(const OffsetAllocation& allocation)
+{
+	if (!allocation.IsValid())
+		return;
+
+	const std::uint32_t index = allocation.metadata;
+	if (index >= m_nodes.size() || !m_nodes[index].bUsed || m_nodes[index].offset != allocation.offset ||
+	    m_nodes[index].size != allocation.size)
+	{
+		LOG_ERROR("TlsfAllocator: double free or foreign block");
+		return;
+	}
+
+	m_nodes[index].bUsed = false;
+	m_allocatedBytes -= allocation.size;
+	--m_allocationCount;
+
+	// Free neighbours are never adjacent to each other, so one merge per side
+	const std::uint32_t prev = m_nodes[index].physPrev;
+	if (prev != kNone && !m_nodes[prev].bUsed)
+	{
+		RemoveFree(prev);
+		m_nodes[index].offset = m_nodes[prev].offset;
+		m_nodes[index].size += m_nodes[prev].size;
+		m_nodes[index].physPrev = m_nodes[prev].physPrev;
+		if (m_nodes[index].physPrev != kNone)
+		{
+			m_nodes[m_nodes[index].physPrev].physNext = index;
+		}
+		ReleaseNode(prev);
+	}
+
+	const std::uint32_t next = m_nodes[index].physNext;
+	if (next != kNone && !m_nodes[next].bUsed)
+	{
+		RemoveFree(next);
+		m_nodes[index].size += m_nodes[next].size;
+		m_nodes[index].physNext = m_nodes[next].physNext;
+		if (m_nodes[index].physNext != kNone)
+		{
+			m_nodes[m_nodes[index].physNext].physPrev = index;
+		}
+		ReleaseNode(next);
+	}
+
+	InsertFree(index);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+OffsetAllocatorStats TlsfAllocator::GetStats() const noexcept
+{
+	OffsetAllocatorStats stats;
+	stats.capacity = m_capacity;
+	stats.allocatedBytes = m_allocatedBytes;
+	stats.freeBytes = m_capacity - m_allocatedBytes;
+	stats.allocationCount = m_allocationCount;
+	stats.freeRangeCount = m_freeBlockCount;
+
+	if (m_firstLevelBitmap != 0)
+	{
+		const auto firstLevel = static_cast<std::uint32_t>(63 - std::countl_zero(m_firstLevelBitmap));
+		const auto secondLevel = static_cast<std::uint32_t>(31 - std::countl_zero(m_secondLevelBitmaps[firstLevel]));
+		for (std::uint32_t node = m_binHeads[firstLevel * kSecondLevelCount + secondLevel]; node != kNone; node = m_nodes[node].binNext)
+		{
+			stats.largestFreeRange = std::max(stats.largestFreeRange, m_nodes[node].size);
+		}
+	}
+	return stats;
+}
+
+// ============================================================================
+// Bins
+// ============================================================================
+
+TlsfAllocator::BinIndex TlsfAllocator::MapSize(std::uint64_t size) noexcept
+{
+	if (size < kSecondLevelCount)
+		return {0, static_cast<std::uint32_t>(size)};
+
+	const auto msb = static_cast<std::uint32_t>(std::bit_width(size) - 1);
+	const auto secondLevel = static_cast<std::uint32_t>(size >> (msb - kSecondLevelBits)) ^ kSecondLevelCount;
+	return {msb - kSecondLevelBits + 1, secondLevel};
+}
+
+// Rounds the padded size up to the next bin boundary, so every block in the
+// bin found is large enough, then takes the first non-empty bin at or above
+// it. When that fails, the request's own bin may still hold a block that
+// fits (e.g. all of the capacity); only then is that one bin scanned.
+std::uint32_t TlsfAllocator::FindFreeNode(std::uint64_t size, std::uint64_t alignMask) const noexcept
+{
+	const std::uint32_t index = FindFreeNodeInBinsAbove(size + alignMask);
+	if (index != kNone)
+		return index;
+
+	const BinIndex bin = MapSize(size);
+	for (std::uint32_t node = m_binHeads[bin.firstLevel * kSecondLevelCount + bin.secondLevel]; node != kNone; node = m_nodes[node].binNext)
+	{
+		const std::uint64_t padding = ((m_nodes[node].offset + alignMask) & ~alignMask) - m_nodes[node].offset;
+		if (m_nodes[node].size >= size && m_nodes[node].size - size >= padding)
+			return node;
+	}
+	return kNone;
+}
+
+std::uint32_t TlsfAllocator::FindFreeNodeInBinsAbove(std::uint64_t size) const noexcept
+{
+	if (size >= kSecondLevelCount)
+	{
+		const auto msb = static_cast<std::uint32_t>(std::bit_width(size) - 1);
+		const std::uint64_t roundUp = (std::uint64_t{1} << (msb - kSecondLevelBits)) - 1;
+		if (size > UINT64_MAX - roundUp)
+			return kNone;
+		size += roundUp;
+	}
+
+	BinIndex bin = MapSize(size);
+	std::uint32_t secondLevelMap = m_secondLevelBitmaps[bin.firstLevel] & (~0u << bin.secondLevel);
+	if (secondLevelMap == 0)
+	{
+		const std::uint64_t firstLevelMap = bin.firstLevel + 1 < 64 ? m_firstLevelBitmap & (~std::uint64_t{0} << (bin.firstLevel + 1)) : 0;
+		if (firstLevelMap == 0)
+			return kNone;
+
+		bin.firstLevel = static_cast<std::uint32_t>(std::countr_zero(firstLevelMap));
+		secondLevelMap = m_secondLevelBitmaps[bin.firstLevel];
+	}
+	bin.secondLevel = static_cast<std::uint32_t>(std::countr_zero(secondLevelMap));
+	return m_binHeads[bin.firstLevel * kSecondLevelCount + bin.secondLevel];
+}
+
+void TlsfAllocator::InsertFree(std::uint32_t index) noexcept
+{
+	const BinIndex bin = MapSize(m_nodes[index].size);
+	std::uint32_t& head = m_binHeads[bin.firstLevel * kSecondLevelCount + bin.secondLevel];
+
+	m_nodes[index].binPrev = kNone;
+	m_nodes[index].binNext = head;
+	if (head != kNone)
+	{
+		m_nodes[head].binPrev = index;
+	}
+	head = index;
+
+	m_secondLevelBitmaps[bin.firstLevel] |= 1u << bin.secondLevel;
+	m_firstLevelBitmap |= std::uint64_t{1} << bin.firstLevel;
+	++m_freeBlockCount;
+}
+
+void TlsfAllocator::RemoveFree(std::uint32_t index) noexcept
+{
+	Node& node = m_nodes[index];
+	const BinIndex bin = MapSize(node.size);
+	std::uint32_t& head = m_binHeads[bin.firstLevel * kSecondLevelCount + bin.secondLevel];
+
+	if (node.binPrev != kNone)
+	{
+		m_nodes[node.binPrev].binNext = node.binNext;
+	}
+	else
+	{
+		head = node.binNext;
+	}
+	if (node.binNext != kNone)
+	{
+		m_nodes[node.binNext].binPrev = node.binPrev;
+	}
+	node.binPrev = node.binNext = kNone;
+
+	if (head == kNone)
+	{
+		m_secondLevelBitmaps[bin.firstLevel] &= ~(1u << bin.secondLevel);
+		if (m_secondLevelBitmaps[bin.firstLevel] == 0)
+		{
+			m_firstLevelBitmap &= ~(std::uint64_t{1} << bin.firstLevel);
+		}
+	}
+	--m_freeBlockCount;
+}
+
+// ============================================================================
+// Node Pool
+// ============================================================================
+
+std::uint32_t TlsfAllocator::CreateNode(std::uint64_t offset, std::uint64_t size)
+{
+	std::uint32_t index = 0;
+	if (!m_unusedNodes.empty())
+	{
+		index = m_unusedNodes.back();
+		m_unusedNodes.pop_back();
+	}
+	else
+	{
+		index = static_cast<std::uint32_t>(m_nodes.size());
+		m_nodes.emplace_back();
+	}
+
+	m_nodes[index] = Node{};
+	m_nodes[index].offset = offset;
+	m_nodes[index].size = size;
+	return index;
+}
+
+void TlsfAllocator::ReleaseNode(std::uint32_t index) noexcept
+{
+	m_nodes[index] = Node{};
+	m_unusedNodes.push_back(index);
+}
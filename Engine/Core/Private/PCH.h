@@ -5,6 +5,7 @@
 //
 // RULES:
 // - Only STL and Windows headers (stable, rarely change)
+// - Windows headers are guarded so the module also builds headless off Windows
 // - NO module headers (Log.h, EngineConfig.h, etc.)
 // - Headers must be used in 50%+ of this module's .cpp files
 // ============================================================================
@@ -14,10 +15,12 @@
 // ============================================================================
 // Windows Configuration
 // ============================================================================
+#if defined(_WIN32)
 #define NOMINMAX
 #ifndef WIN32_LEAN_AND_MEAN
 	#define WIN32_LEAN_AND_MEAN
 #endif
+#endif
 
 // ============================================================================
 // C++ Standard Library - Commonly used across Core
@@ -35,7 +38,9 @@
 // ============================================================================
 // Windows - Required for platform abstraction
 // ============================================================================
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
 // ============================================================================
 // Engine Logging - Available everywhere via PCH
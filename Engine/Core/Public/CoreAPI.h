@@ -2,7 +2,9 @@
 #pragma once
 
 // DLL export/import configuration
-#ifdef SPARKLE_CORE_EXPORTS
+#if !defined(_WIN32)
+	#define SPARKLE_CORE_API __attribute__((visibility("default")))
+#elif defined(SPARKLE_CORE_EXPORTS)
 	#define SPARKLE_CORE_API __declspec(dllexport)
 #else
 	#define SPARKLE_CORE_API __declspec(dllimport)
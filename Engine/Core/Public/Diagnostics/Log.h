@@ -40,9 +40,9 @@ enum class LogLevel : std::uint8_t
 
 namespace Logger
 {
-	inline void SetLevel(LogLevel level) noexcept;
-	inline LogLevel GetLevel() noexcept;
-	inline bool IsEnabled(LogLevel level) noexcept;
+	SPARKLE_CORE_API void SetLevel(LogLevel level) noexcept;
+	SPARKLE_CORE_API LogLevel GetLevel() noexcept;
+	SPARKLE_CORE_API bool IsEnabled(LogLevel level) noexcept;
 }  // namespace Logger
 
 // =============================================================================
@@ -140,4 +140,4 @@ SPARKLE_CORE_API void LogWrite(std::string_view msg, LogLevel lvl, const char* f
 		const long _hr = (hr);                  \
 		if (_hr < 0)                            \
 			::CheckHR(_hr, __FILE__, __LINE__); \
-	} while (0)
\ No newline at end of file
+	} while (0)
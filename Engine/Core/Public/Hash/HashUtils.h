@@ -5,15 +5,19 @@
 // USAGE:
 //   constexpr uint64_t hash = Engine::Hash::Fnv1a64("my_string");
 //   uint64_t runtimeHash = Engine::Hash::Fnv1a64(data, size);
+//   uint64_t blobHash = Engine::Hash::HashBytes64(vertices, vertexBytes);
 //
 // DESIGN:
 //   - FNV-1a chosen for excellent distribution and simplicity
 //   - constexpr enables compile-time hash computation
+//   - HashBytes64 mixes 8 bytes per step for large runtime blobs (mesh
+//     data) where byte-wise FNV-1a is too slow
 //   - Non-cryptographic: suitable for hash tables, not security
 // ============================================================================
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <string_view>
 
 namespace Engine
@@ -51,6 +55,41 @@ namespace Engine
 			return hash;
 		}
 
+		// Finalizer of MurmurHash3 (fmix64): spreads every input bit over the result.
+		[[nodiscard]] constexpr uint64_t Mix64(uint64_t value) noexcept
+		{
+			value ^= value >> 33;
+			value *= 0xff51afd7ed558ccdull;
+			value ^= value >> 33;
+			value *= 0xc4ceb9fe1a85ec53ull;
+			value ^= value >> 33;
+			return value;
+		}
+
+		// Hashes raw bytes one 64-bit word at a time (runtime only). Several
+		// times faster than Fnv1a64 on large buffers; the length is folded in,
+		// so zero-padded inputs of different sizes do not collide.
+		[[nodiscard]] inline uint64_t HashBytes64(const void* data, size_t size, uint64_t seed = kFnv64OffsetBasis) noexcept
+		{
+			const auto* bytes = static_cast<const unsigned char*>(data);
+			uint64_t hash = seed ^ (static_cast<uint64_t>(size) * kFnv64Prime);
+
+			size_t offset = 0;
+			for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t))
+			{
+				uint64_t word = 0;
+				std::memcpy(&word, bytes + offset, sizeof(word));
+				hash = (hash ^ Mix64(word)) * kFnv64Prime;
+			}
+
+			uint64_t tail = 0;
+			for (size_t i = 0; offset + i < size; ++i)
+			{
+				tail |= static_cast<uint64_t>(bytes[offset + i]) << (8u * i);
+			}
+			return Mix64(hash ^ Mix64(tail));
+		}
+
 		// FNV-1a 32-bit variant (for when 64-bit is overkill).
 		inline constexpr uint32_t kFnv32OffsetBasis = 2166136261u;
 		inline constexpr uint32_t kFnv32Prime = 16777619u;
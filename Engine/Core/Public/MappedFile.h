@@ -0,0 +1,57 @@
+// ============================================================================
+// MappedFile.h
+// Read-only memory-mapped view of a whole file.
+// ----------------------------------------------------------------------------
+// USAGE:
+//   Engine::FileSystem::MappedFile file;
+//   if (file.Open(path))
+//   {
+//       std::span<const std::byte> bytes = file.GetBytes();
+//   }
+//
+// DESIGN:
+//   - RAII: the mapping lives exactly as long as the object (move-only)
+//   - Pages are mapped read-only: the view can be shared with the page
+//     cache and a stray write faults instead of silently diverging from
+//     the file
+//   - Win32: CreateFileMapping / MapViewOfFile, POSIX: mmap
+//
+// NOTES:
+//   - Empty files cannot be mapped; Open() fails for them
+// ============================================================================
+#pragma once
+
+#include "CoreAPI.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace Engine::FileSystem
+{
+	class SPARKLE_CORE_API MappedFile final
+	{
+	  public:
+		MappedFile() noexcept = default;
+		~MappedFile() noexcept;
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		// Maps the whole file. Closes any previous mapping first.
+		[[nodiscard]] bool Open(const std::filesystem::path& path);
+		void Close() noexcept;
+
+		[[nodiscard]] bool IsOpen() const noexcept { return m_data != nullptr; }
+		[[nodiscard]] const std::byte* GetData() const noexcept { return m_data; }
+		[[nodiscard]] std::size_t GetSize() const noexcept { return m_size; }
+		[[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return {m_data, m_size}; }
+
+	  private:
+		const std::byte* m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+
+}  // namespace Engine::FileSystem
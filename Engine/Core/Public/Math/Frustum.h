@@ -11,11 +11,22 @@
 //       // Object is potentially visible
 //   }
 //
+//   // Batch: thousands of bounds per call, SoA input
+//   Frustum::SphereBatch batch{xs, ys, zs, radii, count};
+//   uint32_t visible = frustum.CullSpheres(batch, outIndices);
+//
 // DESIGN:
 //   - Six planes representing view frustum boundaries
 //   - Planes stored as (A, B, C, D) where Ax + By + Cz + D = 0
 //   - Normals point inward (positive half-space is inside frustum)
 //   - Supports point and sphere intersection tests
+//   - Batch tests evaluate 4 (SSE) or 8 (AVX2 builds) objects per iteration
+//     with a scalar fallback for _XM_NO_INTRINSICS_ / non-x86 targets and
+//     for the tail of each batch
+//   - Optional per-object plane cache (temporal coherence): the plane that
+//     rejected an object last time is tested first. The cache is honored by
+//     the scalar path only — the SIMD path tests all planes branch-free,
+//     which is cheaper than per-lane plane selection
 //
 // ============================================================================
 
@@ -24,6 +35,7 @@
 #include "Core/Public/CoreAPI.h"
 
 #include <DirectXMath.h>
+#include <cstdint>
 
 // ============================================================================
 // Frustum - Six planes for view frustum culling
@@ -44,6 +56,33 @@ struct SPARKLE_CORE_API Frustum
 
 	DirectX::XMFLOAT4 planes[Count];
 
+	// ========================================================================
+	// Batch Inputs (structure of arrays, all arrays hold 'count' floats)
+	// ========================================================================
+
+	struct SphereBatch
+	{
+		const float* centerX = nullptr;
+		const float* centerY = nullptr;
+		const float* centerZ = nullptr;
+		const float* radius = nullptr;
+		std::uint32_t count = 0;
+	};
+
+	struct AABBBatch
+	{
+		const float* minX = nullptr;
+		const float* minY = nullptr;
+		const float* minZ = nullptr;
+		const float* maxX = nullptr;
+		const float* maxY = nullptr;
+		const float* maxZ = nullptr;
+		std::uint32_t count = 0;
+	};
+
+	/// Words needed for a visibility mask of 'count' objects (1 bit each).
+	[[nodiscard]] static constexpr std::uint32_t GetMaskWordCount(std::uint32_t count) noexcept { return (count + 31) / 32; }
+
 	// ========================================================================
 	// Extraction
 	// ========================================================================
@@ -64,4 +103,27 @@ struct SPARKLE_CORE_API Frustum
 
 	/// Tests if an axis-aligned bounding box intersects the frustum.
 	[[nodiscard]] bool IntersectsAABB(const DirectX::XMFLOAT3& min, const DirectX::XMFLOAT3& max) const noexcept;
+
+	// ========================================================================
+	// Batch Intersection Tests
+	// ========================================================================
+	//
+	// Test*: writes a visibility bitmask (bit i of word i/32 = object i),
+	//        GetMaskWordCount(count) words.
+	// Cull*: writes indices of visible objects in ascending order and
+	//        returns how many were written (outIndices must hold 'count').
+	// planeCache (optional, 'count' bytes, zero-initialized is fine): last
+	//        rejecting plane per object; enables the scalar coherent path.
+
+	void TestSpheres(const SphereBatch& batch, std::uint32_t* outVisibleMask, std::uint8_t* planeCache = nullptr) const noexcept;
+	[[nodiscard]] std::uint32_t CullSpheres(
+	    const SphereBatch& batch,
+	    std::uint32_t* outVisibleIndices,
+	    std::uint8_t* planeCache = nullptr) const noexcept;
+
+	void TestAABBs(const AABBBatch& batch, std::uint32_t* outVisibleMask, std::uint8_t* planeCache = nullptr) const noexcept;
+	[[nodiscard]] std::uint32_t CullAABBs(
+	    const AABBBatch& batch,
+	    std::uint32_t* outVisibleIndices,
+	    std::uint8_t* planeCache = nullptr) const noexcept;
 };
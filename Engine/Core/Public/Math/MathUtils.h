@@ -63,10 +63,60 @@ namespace MathUtils
 	inline DirectX::XMFLOAT2 SphericalUV(const DirectX::XMFLOAT3& n)
 	{
 		float u = std::atan2(n.z, n.x) / DirectX::XM_2PI + 0.5f;
-		float v = std::acosf(std::clamp(n.y, -1.0f, 1.0f)) / DirectX::XM_PI;
+		float v = std::acos(std::clamp(n.y, -1.0f, 1.0f)) / DirectX::XM_PI;
 		return {u, v};
 	}
 
+	// Transforms a local AABB by a row-vector affine matrix (p' = p * M) and
+	// returns the enclosing world AABB (Arvo's method — no corner expansion).
+	inline void TransformAABB(
+	    const DirectX::XMFLOAT3& localMin,
+	    const DirectX::XMFLOAT3& localMax,
+	    const DirectX::XMFLOAT4X4& m,
+	    DirectX::XMFLOAT3& outMin,
+	    DirectX::XMFLOAT3& outMax)
+	{
+		const float lo[3] = {localMin.x, localMin.y, localMin.z};
+		const float hi[3] = {localMax.x, localMax.y, localMax.z};
+		float rMin[3] = {m._41, m._42, m._43};
+		float rMax[3] = {m._41, m._42, m._43};
+
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				const float a = m.m[i][j] * lo[i];
+				const float b = m.m[i][j] * hi[i];
+				rMin[j] += std::min(a, b);
+				rMax[j] += std::max(a, b);
+			}
+		}
+
+		outMin = {rMin[0], rMin[1], rMin[2]};
+		outMax = {rMax[0], rMax[1], rMax[2]};
+	}
+
+	// Transforms a bounding sphere by a row-vector affine matrix. The radius is
+	// scaled by the largest axis scale, so the result stays conservative under
+	// non-uniform scale.
+	inline void TransformSphere(
+	    const DirectX::XMFLOAT3& localCenter,
+	    float localRadius,
+	    const DirectX::XMFLOAT4X4& m,
+	    DirectX::XMFLOAT3& outCenter,
+	    float& outRadius)
+	{
+		outCenter = {
+		    localCenter.x * m._11 + localCenter.y * m._21 + localCenter.z * m._31 + m._41,
+		    localCenter.x * m._12 + localCenter.y * m._22 + localCenter.z * m._32 + m._42,
+		    localCenter.x * m._13 + localCenter.y * m._23 + localCenter.z * m._33 + m._43};
+
+		const float sx = m._11 * m._11 + m._12 * m._12 + m._13 * m._13;
+		const float sy = m._21 * m._21 + m._22 * m._22 + m._23 * m._23;
+		const float sz = m._31 * m._31 + m._32 * m._32 + m._33 * m._33;
+		outRadius = localRadius * std::sqrt(std::max(sx, std::max(sy, sz)));
+	}
+
 	inline uint64_t EdgeKey(uint32_t a, uint32_t b)
 	{
 		uint32_t lo = std::min(a, b);
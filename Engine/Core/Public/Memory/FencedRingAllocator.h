@@ -0,0 +1,95 @@
+// ============================================================================
+// FencedRingAllocator.h
+// ----------------------------------------------------------------------------
+// Ring offset allocator over an abstract range [0, capacity) whose space is
+// reclaimed in batches, each tagged with the fence value of the GPU
+// submission that reads it. Like the other offset allocators it never
+// touches memory itself — the bookkeeping behind persistent staging rings.
+//
+// USAGE:
+//   FencedRingAllocator ring(32ull << 20);
+//   const OffsetAllocation block = ring.Allocate(bytes, 16);  // Open batch
+//   if (block.IsValid()) { /* write staging data at block.offset */ }
+//   ring.CloseBatch(fenceValue);                               // After Signal
+//   ring.Retire(completedFenceValue);                          // Each frame
+//
+// DESIGN:
+//   - Allocations are carved contiguously from the head; one that does not
+//     fit before the end of the range wraps to offset 0 and the skipped
+//     tail is charged to the open batch
+//   - CloseBatch stamps everything allocated since the previous close with
+//     one fence value; Retire frees whole batches in order once the
+//     completed fence value reaches theirs
+//   - Fence values are plain numbers, so retirement is deterministic and
+//     can be driven by a fake fence without a device
+//
+// NOTES:
+//   - Not thread-safe
+//   - Fence values passed to CloseBatch must not decrease
+//   - A full ring returns invalid allocations; callers retry after a Retire
+// ============================================================================
+
+#pragma once
+
+#include "Core/Public/CoreAPI.h"
+#include "Core/Public/Memory/OffsetAllocation.h"
+
+#include <cstdint>
+#include <deque>
+
+// ============================================================================
+// FencedRingAllocatorStats
+// ============================================================================
+
+struct FencedRingAllocatorStats
+{
+	std::uint64_t capacity = 0;
+	std::uint64_t usedBytes = 0;        // Open batch plus batches in flight, wrap padding included
+	std::uint64_t openBytes = 0;        // Allocated since the last CloseBatch
+	std::uint32_t batchesInFlight = 0;  // Closed, not yet retired
+	std::uint64_t failedAllocations = 0;
+};
+
+// ============================================================================
+// FencedRingAllocator
+// ============================================================================
+
+class SPARKLE_CORE_API FencedRingAllocator final
+{
+  public:
+	FencedRingAllocator() = default;
+	explicit FencedRingAllocator(std::uint64_t capacity);
+
+	/// Returns an invalid allocation if size is 0 or larger than the
+	/// capacity, alignment is not a power of two, or the ring is full.
+	[[nodiscard]] OffsetAllocation Allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+	/// Stamps the open batch with fenceValue (no-op when it is empty).
+	void CloseBatch(std::uint64_t fenceValue);
+
+	/// Frees every closed batch whose fence value is <= completedFenceValue.
+	void Retire(std::uint64_t completedFenceValue);
+
+	/// Frees everything, open and in-flight batches included (GPU must be idle).
+	void Reset();
+
+	[[nodiscard]] std::uint64_t GetCapacity() const noexcept { return m_capacity; }
+	[[nodiscard]] bool IsEmpty() const noexcept { return m_usedBytes == 0; }
+	[[nodiscard]] bool HasOpenBatch() const noexcept { return m_openBytes > 0; }
+	[[nodiscard]] FencedRingAllocatorStats GetStats() const noexcept;
+
+  private:
+	struct Batch
+	{
+		std::uint64_t fenceValue = 0;
+		std::uint64_t bytes = 0;  // Padding included
+	};
+
+	std::uint64_t m_capacity = 0;
+	std::uint64_t m_head = 0;       // Next free byte
+	std::uint64_t m_usedBytes = 0;  // Bytes from tail to head in ring order (tail is implied)
+	std::uint64_t m_openBytes = 0;
+	std::uint64_t m_failedAllocations = 0;
+
+	std::deque<Batch> m_batches;  // Closed, oldest first
+};
@@ -0,0 +1,75 @@
+// ============================================================================
+// FreeListAllocator.h
+// ----------------------------------------------------------------------------
+// Offset allocator over an abstract range [0, capacity): hands out aligned
+// (offset, size) blocks and never touches memory itself. Best-fit reference
+// for TlsfAllocator, which serves the engine's GPU suballocation; this one
+// is simpler and exact, TLSF is O(1).
+//
+// USAGE:
+//   FreeListAllocator allocator(64ull << 20);
+//   const OffsetAllocation block = allocator.Allocate(vertexBytes, 16);
+//   if (block.IsValid()) { /* copy into buffer at block.offset */ }
+//   allocator.Free(block);
+//
+// DESIGN:
+//   - Free ranges are kept twice: by offset (neighbour lookup for
+//     coalescing) and by size (best fit). Allocate and Free are O(log n) in
+//     the number of free ranges
+//   - Best fit: the smallest free range that still fits after alignment
+//     padding; the padding in front of an aligned block goes back to the
+//     free list, so Free only needs the returned (offset, size)
+//   - Free merges the block with free neighbours on both sides, so the free
+//     list never holds two adjacent ranges
+//   - Pure CPU bookkeeping: deterministic and testable without a device
+//
+// NOTES:
+//   - Not thread-safe
+//   - Freeing a block twice or one that was never allocated is detected
+//     (overlap with a free range) and logged, not applied
+// ============================================================================
+
+#pragma once
+
+#include "Core/Public/CoreAPI.h"
+#include "Core/Public/Memory/OffsetAllocation.h"
+
+#include <cstdint>
+#include <map>
+
+// ============================================================================
+// FreeListAllocator
+// ============================================================================
+
+class SPARKLE_CORE_API FreeListAllocator final
+{
+  public:
+	FreeListAllocator() = default;
+	explicit FreeListAllocator(std::uint64_t capacity);
+
+	/// Returns an invalid allocation if size is 0, alignment is not a power
+	/// of two, or no free range fits.
+	[[nodiscard]] OffsetAllocation Allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+	/// Returns a block from Allocate to the free list (invalid blocks are ignored).
+	void Free(const OffsetAllocation& allocation);
+
+	/// Frees everything: the whole capacity becomes one free range.
+	void Reset();
+
+	[[nodiscard]] std::uint64_t GetCapacity() const noexcept { return m_capacity; }
+	[[nodiscard]] std::uint32_t GetAllocationCount() const noexcept { return m_allocationCount; }
+	[[nodiscard]] bool IsEmpty() const noexcept { return m_allocationCount == 0; }
+	[[nodiscard]] OffsetAllocatorStats GetStats() const noexcept;
+
+  private:
+	void InsertFree(std::uint64_t offset, std::uint64_t size);
+	void EraseFree(std::map<std::uint64_t, std::uint64_t>::iterator byOffset);
+
+	std::uint64_t m_capacity = 0;
+	std::uint64_t m_allocatedBytes = 0;
+	std::uint32_t m_allocationCount = 0;
+
+	std::map<std::uint64_t, std::uint64_t> m_freeByOffset;     // offset -> size
+	std::multimap<std::uint64_t, std::uint64_t> m_freeBySize;  // size -> offset
+};
@@ -0,0 +1,46 @@
+// ============================================================================
+// OffsetAllocation.h
+// ----------------------------------------------------------------------------
+// Result and statistics types shared by the offset allocators
+// (FreeListAllocator, TlsfAllocator). An offset allocator manages an abstract
+// range [0, capacity) and never touches memory itself.
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+// ============================================================================
+// OffsetAllocation
+// ============================================================================
+
+struct OffsetAllocation
+{
+	static constexpr std::uint64_t kInvalidOffset = ~std::uint64_t{0};
+
+	std::uint64_t offset = kInvalidOffset;
+	std::uint64_t size = 0;
+	std::uint32_t metadata = UINT32_MAX;  // Allocator-private (TlsfAllocator: block node)
+
+	[[nodiscard]] bool IsValid() const noexcept { return offset != kInvalidOffset; }
+};
+
+// ============================================================================
+// OffsetAllocatorStats
+// ============================================================================
+
+struct OffsetAllocatorStats
+{
+	std::uint64_t capacity = 0;
+	std::uint64_t allocatedBytes = 0;
+	std::uint64_t freeBytes = 0;
+	std::uint64_t largestFreeRange = 0;
+	std::uint32_t allocationCount = 0;
+	std::uint32_t freeRangeCount = 0;
+
+	/// 0 when all free space is one range, towards 1 as it splinters.
+	[[nodiscard]] float GetFragmentation() const noexcept
+	{
+		return freeBytes > 0 ? 1.0f - static_cast<float>(largestFreeRange) / static_cast<float>(freeBytes) : 0.0f;
+	}
+};
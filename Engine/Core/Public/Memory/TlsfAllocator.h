@@ -0,0 +1,119 @@
+// ============================================================================
+// TlsfAllocator.h
+// ----------------------------------------------------------------------------
+// Two-level segregated fit (TLSF) offset allocator over an abstract range
+// [0, capacity). Hands out aligned (offset, size) blocks in O(1) and never
+// touches memory itself — the backbone for suballocating GPU heaps and
+// buffers (geometry arena pages, later texture heaps and descriptor ranges).
+//
+// USAGE:
+//   TlsfAllocator allocator(64ull << 20);
+//   const OffsetAllocation block = allocator.Allocate(bytes, 256);
+//   if (block.IsValid()) { /* place resource at block.offset */ }
+//   allocator.Free(block);
+//
+// DESIGN:
+//   - Free blocks are binned by size: the first level is the power of two
+//     (most significant bit), the second level splits each power of two
+//     into kSecondLevelCount linear sub-ranges. Sizes below
+//     kSecondLevelCount map linearly into first level 0
+//   - One bitmap bit per non-empty first-level class and per non-empty bin;
+//     Allocate rounds the request up to the next bin boundary so any block of
+//     the bin found by two count-trailing-zeros fits (good fit, not best fit).
+//     Only if that fails is the request's own bin scanned for an exact fit,
+//     so a block barely larger than the request (or the whole capacity) is
+//     still usable
+//   - Blocks are nodes in a pool with physical neighbour links, so Free
+//     merges with free neighbours in O(1). OffsetAllocation::metadata is
+//     the node index; Free needs no search
+//   - Alignment is handled by asking for size + alignment - 1 and returning
+//     the front padding to the free bins
+//
+// NOTES:
+//   - Not thread-safe
+//   - Same OffsetAllocation/OffsetAllocatorStats as FreeListAllocator, the
+//     std::map best-fit reference implementation
+//   - Freeing a block twice or one from another allocator is detected via
+//     the node and logged, not applied
+// ============================================================================
+
+#pragma once
+
+#include "Core/Public/CoreAPI.h"
+#include "Core/Public/Memory/OffsetAllocation.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// TlsfAllocator
+// ============================================================================
+
+class SPARKLE_CORE_API TlsfAllocator final
+{
+  public:
+	static constexpr std::uint32_t kSecondLevelBits = 4;
+	static constexpr std::uint32_t kSecondLevelCount = 1u << kSecondLevelBits;
+	static constexpr std::uint32_t kFirstLevelCount = 64 - kSecondLevelBits + 1;
+
+	TlsfAllocator() = default;
+	explicit TlsfAllocator(std::uint64_t capacity);
+
+	/// Returns an invalid allocation if size is 0, alignment is not a power
+	/// of two, or no free block fits.
+	[[nodiscard]] OffsetAllocation Allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+	/// Returns a block from Allocate (invalid blocks are ignored).
+	void Free(const OffsetAllocation& allocation);
+
+	/// Frees everything: the whole capacity becomes one free block.
+	void Reset();
+
+	[[nodiscard]] std::uint64_t GetCapacity() const noexcept { return m_capacity; }
+	[[nodiscard]] std::uint32_t GetAllocationCount() const noexcept { return m_allocationCount; }
+	[[nodiscard]] bool IsEmpty() const noexcept { return m_allocationCount == 0; }
+
+	/// O(1) except largestFreeRange, which scans the highest non-empty bin.
+	[[nodiscard]] OffsetAllocatorStats GetStats() const noexcept;
+
+  private:
+	static constexpr std::uint32_t kNone = UINT32_MAX;
+
+	struct Node
+	{
+		std::uint64_t offset = 0;
+		std::uint64_t size = 0;
+		std::uint32_t binPrev = kNone;  // Free list of the node's bin
+		std::uint32_t binNext = kNone;
+		std::uint32_t physPrev = kNone;  // Adjacent blocks in offset order
+		std::uint32_t physNext = kNone;
+		bool bUsed = false;
+	};
+
+	struct BinIndex
+	{
+		std::uint32_t firstLevel = 0;
+		std::uint32_t secondLevel = 0;
+	};
+
+	[[nodiscard]] static BinIndex MapSize(std::uint64_t size) noexcept;
+	[[nodiscard]] std::uint32_t FindFreeNode(std::uint64_t size, std::uint64_t alignMask) const noexcept;
+	[[nodiscard]] std::uint32_t FindFreeNodeInBinsAbove(std::uint64_t size) const noexcept;
+	[[nodiscard]] std::uint32_t CreateNode(std::uint64_t offset, std::uint64_t size);
+	void ReleaseNode(std::uint32_t index) noexcept;
+	void InsertFree(std::uint32_t index) noexcept;
+	void RemoveFree(std::uint32_t index) noexcept;
+
+	std::uint64_t m_capacity = 0;
+	std::uint64_t m_allocatedBytes = 0;
+	std::uint32_t m_allocationCount = 0;
+	std::uint32_t m_freeBlockCount = 0;
+
+	std::uint64_t m_firstLevelBitmap = 0;
+	std::array<std::uint32_t, kFirstLevelCount> m_secondLevelBitmaps{};
+	std::array<std::uint32_t, kFirstLevelCount * kSecondLevelCount> m_binHeads{};
+
+	std::vector<Node> m_nodes;
+	std::vector<std::uint32_t> m_unusedNodes;  // Recycled node indices
+};
@@ -64,9 +64,11 @@ void AssetSystem::InitializeOutputPaths()
 	if (!outputRoot.empty())
 	{
 		m_shaderSymbolsOutputPath = outputRoot / GetAssetSubdirectory(AssetType::ShaderSymbols);
+		m_meshCacheOutputPath = outputRoot / GetAssetSubdirectory(AssetType::Mesh) / "Cooked";
 
 		std::error_code ec;
 		std::filesystem::create_directories(m_shaderSymbolsOutputPath, ec);
+		std::filesystem::create_directories(m_meshCacheOutputPath, ec);
 	}
 }
 
@@ -117,6 +119,7 @@ void AssetSystem::ValidatePaths()
 	logPath("Project", m_projectPath, false);
 	logPath("Project Assets", m_projectAssetsPath, false);
 	logPath("Shader Symbols Output", m_shaderSymbolsOutputPath, false);
+	logPath("Mesh Cache Output", m_meshCacheOutputPath, false);
 	LOG_INFO("================================================");
 }
 
@@ -139,6 +142,7 @@ AssetSystem::~AssetSystem()
 	}
 
 	m_shaderSymbolsOutputPath.clear();
+	m_meshCacheOutputPath.clear();
 }
 
 const std::filesystem::path& AssetSystem::GetTypedPath(AssetType type, PathRoot root) const noexcept
@@ -0,0 +1,237 @@
+// =============================================================================
+// GltfAccessorReader.cpp — Bulk decoding of cgltf accessors
+// =============================================================================
+
+#include "PCH.h"
+#include "GltfAccessorReader.h"
+
+#include <cgltf.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+	// Returns the first byte of element 0, or nullptr when the accessor cannot
+	// be read directly (sparse, no buffer view, buffers not loaded).
+	[[nodiscard]] const std::uint8_t* GetDirectData(const cgltf_accessor* accessor)
+	{
+		if (accessor->is_sparse || !accessor->buffer_view)
+			return nullptr;
+
+		const std::uint8_t* base = cgltf_buffer_view_data(accessor->buffer_view);
+		return base ? base + accessor->offset : nullptr;
+	}
+
+	template <typename T> [[nodiscard]] T LoadUnaligned(const std::uint8_t* src)
+	{
+		T value;
+		std::memcpy(&value, src, sizeof(T));
+		return value;
+	}
+
+	// Calls fn.template operator()<N>() for N = components (1..4), so the
+	// per-element loops below see a constant element size.
+	template <typename Fn> void WithComponentCount(std::size_t components, Fn&& fn)
+	{
+		switch (components)
+		{
+		case 1:
+			fn.template operator()<1>();
+			break;
+		case 2:
+			fn.template operator()<2>();
+			break;
+		case 3:
+			fn.template operator()<3>();
+			break;
+		case 4:
+			fn.template operator()<4>();
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Float32 source. Interleaved attributes are read with the accessor stride;
+	// when both sides are packed the whole accessor is a single memcpy.
+	template <std::size_t Components>
+	void DecodeFloat32(const std::uint8_t* src, std::size_t srcStride, std::size_t count, std::uint8_t* dst, std::size_t dstStride)
+	{
+		constexpr std::size_t kElementSize = Components * sizeof(float);
+		if (srcStride == kElementSize && dstStride == kElementSize)
+		{
+			std::memcpy(dst, src, count * kElementSize);
+			return;
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			std::memcpy(dst, src, kElementSize);
+			src += srcStride;
+			dst += dstStride;
+		}
+	}
+
+	// Integer source. Normalized unsigned values map to [0, 1], normalized signed
+	// values to [-1, 1] (clamped per the glTF spec), others convert directly.
+	// The double-precision reciprocal rounds to the same float as cgltf's
+	// division for every 8- and 16-bit value, without a divide per component.
+	template <typename T, std::size_t Components>
+	void DecodeInteger(
+	    const std::uint8_t* src,
+	    std::size_t srcStride,
+	    std::size_t count,
+	    std::uint8_t* dst,
+	    std::size_t dstStride,
+	    bool bNormalized)
+	{
+		constexpr double kInvMax = 1.0 / static_cast<double>(std::numeric_limits<T>::max());
+		const double scale = bNormalized ? kInvMax : 1.0;
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			float decoded[Components];
+			for (std::size_t c = 0; c < Components; ++c)
+			{
+				T value = LoadUnaligned<T>(src + c * sizeof(T));
+				if constexpr (std::is_signed_v<T>)
+				{
+					// -128 / -32768 would land below -1
+					if (bNormalized)
+						value = std::max<T>(value, -std::numeric_limits<T>::max());
+				}
+				decoded[c] = static_cast<float>(static_cast<double>(value) * scale);
+			}
+			std::memcpy(dst, decoded, sizeof(decoded));
+			src += srcStride;
+			dst += dstStride;
+		}
+	}
+
+	template <typename T> void DecodeIndices(const std::uint8_t* src, std::size_t srcStride, std::size_t count, std::uint32_t* dst)
+	{
+		if constexpr (sizeof(T) == sizeof(std::uint32_t))
+		{
+			if (srcStride == sizeof(T))
+			{
+				std::memcpy(dst, src, count * sizeof(T));
+				return;
+			}
+		}
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			dst[i] = static_cast<std::uint32_t>(LoadUnaligned<T>(src));
+			src += srcStride;
+		}
+	}
+
+	// Generic per-element path via cgltf (handles sparse and zero-filled accessors).
+	void ReadFloatsFallback(const cgltf_accessor* accessor, std::uint8_t* dst, std::size_t dstStride, std::size_t dstComponents)
+	{
+		const std::size_t components = std::min<std::size_t>(cgltf_num_components(accessor->type), dstComponents);
+
+		for (cgltf_size i = 0; i < accessor->count; ++i)
+		{
+			cgltf_float element[16] = {};
+			cgltf_accessor_read_float(accessor, i, element, 16);
+			std::memcpy(dst, element, components * sizeof(float));
+			dst += dstStride;
+		}
+	}
+
+}  // namespace
+
+namespace GltfAccessorReader
+{
+	bool ReadFloats(const cgltf_accessor* accessor, void* dst, std::size_t dstStride, std::size_t dstComponents)
+	{
+		if (!accessor)
+			return false;
+
+		auto* out = static_cast<std::uint8_t*>(dst);
+		const std::size_t components = cgltf_num_components(accessor->type);
+		const std::uint8_t* src = GetDirectData(accessor);
+
+		// Fast paths only cover the exact-fit case, which is every attribute the
+		// engine reads from a conforming file.
+		if (!src || components != dstComponents || components > 4)
+		{
+			ReadFloatsFallback(accessor, out, dstStride, dstComponents);
+			return true;
+		}
+
+		const std::size_t srcStride = accessor->stride;
+		const std::size_t count = accessor->count;
+		const bool bNormalized = accessor->normalized != 0;
+
+		bool bDecoded = true;
+		WithComponentCount(components, [&]<std::size_t N>() {
+			switch (accessor->component_type)
+			{
+			case cgltf_component_type_r_32f:
+				DecodeFloat32<N>(src, srcStride, count, out, dstStride);
+				break;
+			case cgltf_component_type_r_8u:
+				DecodeInteger<std::uint8_t, N>(src, srcStride, count, out, dstStride, bNormalized);
+				break;
+			case cgltf_component_type_r_16u:
+				DecodeInteger<std::uint16_t, N>(src, srcStride, count, out, dstStride, bNormalized);
+				break;
+			case cgltf_component_type_r_8:
+				DecodeInteger<std::int8_t, N>(src, srcStride, count, out, dstStride, bNormalized);
+				break;
+			case cgltf_component_type_r_16:
+				DecodeInteger<std::int16_t, N>(src, srcStride, count, out, dstStride, bNormalized);
+				break;
+			default:
+				bDecoded = false;
+				break;
+			}
+		});
+
+		if (!bDecoded)
+		{
+			ReadFloatsFallback(accessor, out, dstStride, dstComponents);
+		}
+		return true;
+	}
+
+	bool ReadIndices(const cgltf_accessor* accessor, std::uint32_t* dst)
+	{
+		if (!accessor)
+			return false;
+
+		const std::uint8_t* src = GetDirectData(accessor);
+		const std::size_t srcStride = accessor->stride;
+		const std::size_t count = accessor->count;
+
+		if (src)
+		{
+			switch (accessor->component_type)
+			{
+			case cgltf_component_type_r_8u:
+				DecodeIndices<std::uint8_t>(src, srcStride, count, dst);
+				return true;
+			case cgltf_component_type_r_16u:
+				DecodeIndices<std::uint16_t>(src, srcStride, count, dst);
+				return true;
+			case cgltf_component_type_r_32u:
+				DecodeIndices<std::uint32_t>(src, srcStride, count, dst);
+				return true;
+			default:
+				break;
+			}
+		}
+
+		for (cgltf_size i = 0; i < count; ++i)
+		{
+			dst[i] = static_cast<std::uint32_t>(cgltf_accessor_read_index(accessor, i));
+		}
+		return true;
+	}
+
+}  // namespace GltfAccessorReader
@@ -0,0 +1,45 @@
+// =============================================================================
+// GltfAccessorReader.h — Bulk decoding of cgltf accessors
+// =============================================================================
+//
+// Decodes whole accessors in one call instead of one cgltf_accessor_read_*
+// call per element. Common layouts are handled by tight typed loops that read
+// straight from the loaded buffer view:
+//
+//   - FLOAT  VEC2 / VEC3 / VEC4  (packed or interleaved/strided)
+//   - UNSIGNED_BYTE / UNSIGNED_SHORT / BYTE / SHORT (normalized or not)
+//   - UNSIGNED_BYTE / UNSIGNED_SHORT / UNSIGNED_INT indices
+//
+// Anything else (sparse accessors, accessors without a buffer view, component
+// count mismatches) falls back to the per-element cgltf path, so output is
+// identical to the generic reader for every input, except that normalized
+// signed minimums (-128, -32768) clamp to -1 as the glTF spec requires.
+//
+// NOTES:
+//   - Attribute output is written with a caller-provided stride so decoded
+//     values land directly inside interleaved VertexData (no temporary array)
+//   - Destination components not present in the source are left untouched
+// =============================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Forward-declared to keep cgltf.h out of includers. GltfLoader.cpp defines
+// CGLTF_IMPLEMENTATION; GltfAccessorReader.cpp includes the declarations only.
+struct cgltf_accessor;
+
+namespace GltfAccessorReader
+{
+	// Decodes every element of a numeric accessor into floats.
+	// Element i is written to (dst + i * dstStride) as dstComponents floats,
+	// so dst must hold accessor->count elements (callers check attribute counts).
+	// Returns false (and writes nothing) if accessor is null.
+	bool ReadFloats(const cgltf_accessor* accessor, void* dst, std::size_t dstStride, std::size_t dstComponents);
+
+	// Decodes every element of an index accessor into dst[0 .. accessor->count).
+	// Returns false (and writes nothing) if accessor is null.
+	bool ReadIndices(const cgltf_accessor* accessor, std::uint32_t* dst);
+
+}  // namespace GltfAccessorReader
@@ -2,16 +2,22 @@
 // GltfLoader.cpp — glTF 2.0 Asset Loader Implementation
 // =============================================================================
 
-#define CGLTF_IMPLEMENTATION
 #include "PCH.h"
 #include "GameFramework/Public/Assets/GltfLoader.h"
+#include "GltfAccessorReader.h"
+#include "Core/Public/MappedFile.h"
+#include "Timer.h"
 
+// The cgltf implementation unit: other files include cgltf.h for declarations only
+#define CGLTF_IMPLEMENTATION
 #include <cgltf.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <format>
 #include <span>
+#include <thread>
 
 using namespace DirectX;
 
@@ -21,7 +27,6 @@ using namespace DirectX;
 
 namespace GltfLoaderInternal
 {
-	[[nodiscard]] XMMATRIX ComputeNodeWorldTransform(const cgltf_node* node);
 	[[nodiscard]] MeshData ExtractPrimitive(const cgltf_primitive& primitive);
 	[[nodiscard]] std::uint32_t ResolveMaterialIndex(const cgltf_primitive& primitive, const cgltf_data* data);
 
@@ -31,6 +36,64 @@ namespace GltfLoaderInternal
 		~CgltfGuard() { cgltf_free(ptr); }
 	};
 
+	// -------------------------------------------------------------------------
+	// Memory-mapped file callbacks
+	// -------------------------------------------------------------------------
+
+	// Owns every file cgltf opened through MappedFileRead during one Load.
+	// cgltf keeps pointers into these mappings (GLB payload, .bin buffers)
+	// until cgltf_free, so this must outlive the CgltfGuard.
+	struct MappedFileSet
+	{
+		std::vector<Engine::FileSystem::MappedFile> files;
+		std::size_t mappedBytes = 0;
+	};
+
+	cgltf_result MappedFileRead(
+	    const cgltf_memory_options* memoryOptions,
+	    const cgltf_file_options* fileOptions,
+	    const char* path,
+	    cgltf_size* size,
+	    void** data)
+	{
+		auto* fileSet = static_cast<MappedFileSet*>(fileOptions->user_data);
+
+		Engine::FileSystem::MappedFile file;
+		if (!file.Open(std::filesystem::path(path)))
+		{
+			return cgltf_default_file_read(memoryOptions, fileOptions, path, size, data);
+		}
+
+		// cgltf's callback is non-const but it only ever reads file data
+		*size = file.GetSize();
+		*data = const_cast<std::byte*>(file.GetData());
+		fileSet->mappedBytes += file.GetSize();
+		fileSet->files.push_back(std::move(file));
+		return cgltf_result_success;
+	}
+
+	void MappedFileRelease(const cgltf_memory_options* memoryOptions, const cgltf_file_options* fileOptions, void* data, cgltf_size size)
+	{
+		auto* fileSet = static_cast<MappedFileSet*>(fileOptions->user_data);
+
+		auto it = std::ranges::find_if(fileSet->files, [data](const auto& file) { return file.GetData() == data; });
+		if (it == fileSet->files.end())
+		{
+			// Read through the fallback path
+			cgltf_default_file_release(memoryOptions, fileOptions, data, size);
+			return;
+		}
+
+		fileSet->files.erase(it);
+	}
+
+	void ConfigureMappedFiles(cgltf_options& options, MappedFileSet& fileSet)
+	{
+		options.file.read = &MappedFileRead;
+		options.file.release = &MappedFileRelease;
+		options.file.user_data = &fileSet;
+	}
+
 	[[nodiscard]] bool ValidateInputPath(const std::filesystem::path& filePath, GltfLoader::LoadResult& result)
 	{
 		if (std::filesystem::exists(filePath))
@@ -87,6 +150,30 @@ namespace GltfLoaderInternal
 		}
 	}
 
+	// Records the glTF file and every external buffer file it references,
+	// so cooked caches can detect edits to any of them.
+	void CollectSourceFiles(
+	    const cgltf_data* data,
+	    const std::filesystem::path& filePath,
+	    const std::filesystem::path& gltfDirectory,
+	    std::vector<std::filesystem::path>& outSourceFiles)
+	{
+		outSourceFiles.push_back(filePath);
+
+		for (cgltf_size i = 0; i < data->buffers_count; ++i)
+		{
+			const char* uri = data->buffers[i].uri;
+			if (!uri || std::strncmp(uri, "data:", 5) == 0)
+			{
+				continue;
+			}
+
+			std::string decoded = uri;
+			decoded.resize(cgltf_decode_uri(decoded.data()));
+			outSourceFiles.push_back(gltfDirectory / decoded);
+		}
+	}
+
 	void EnsureDefaultMaterial(GltfLoader::LoadResult& result)
 	{
 		if (!result.materials.empty())
@@ -99,68 +186,251 @@ namespace GltfLoaderInternal
 		result.materials.push_back(std::move(defaultMat));
 	}
 
-	[[nodiscard]] std::size_t CountTotalPrimitives(const cgltf_data* data)
+	inline constexpr std::uint32_t kInvalidSlot = ~0u;
+
+	// One unit of extraction work: a unique triangle primitive. A cgltf_mesh
+	// referenced by several nodes contributes its primitives exactly once.
+	struct PrimitiveWorkItem
 	{
-		std::size_t totalPrimitives = 0;
+		const cgltf_primitive* primitive = nullptr;
+	};
+
+	// Maps (cgltf_mesh, primitive) to its work-list slot. primitiveSlots is
+	// flat; meshSlotBase[m] is the first entry of mesh m (kInvalidSlot if no
+	// node references the mesh). Non-triangle primitives map to kInvalidSlot.
+	struct PrimitiveWorkList
+	{
+		std::vector<PrimitiveWorkItem> items;
+		std::vector<std::uint32_t> meshSlotBase;
+		std::vector<std::uint32_t> primitiveSlots;
+	};
+
+	// Computes every node's world matrix in a single top-down pass: parents
+	// are always evaluated before their children, so each node costs exactly
+	// one local * parent multiply regardless of hierarchy depth.
+	// Fails on a cyclic node graph: a node reached twice, or one no root
+	// reaches (its parent chain loops), would otherwise hang or go unplaced.
+	[[nodiscard]] bool ComputeNodeWorldTransforms(
+	    const cgltf_data* data,
+	    const std::string& pathStr,
+	    std::vector<XMFLOAT4X4>& outWorldTransforms,
+	    GltfLoader::LoadResult& result)
+	{
+		outWorldTransforms.resize(data->nodes_count);
+		for (XMFLOAT4X4& world : outWorldTransforms)
+		{
+			XMStoreFloat4x4(&world, XMMatrixIdentity());
+		}
+
+		std::vector<std::uint8_t> visited(data->nodes_count, 0);
+		cgltf_size visitedCount = 0;
+		bool bCycle = false;
+
+		std::vector<const cgltf_node*> stack;
+		stack.reserve(data->nodes_count);
 		for (cgltf_size n = 0; n < data->nodes_count; ++n)
 		{
-			const cgltf_node& node = data->nodes[n];
-			if (node.mesh)
+			if (!data->nodes[n].parent)
 			{
-				totalPrimitives += node.mesh->primitives_count;
+				stack.push_back(&data->nodes[n]);
 			}
 		}
-		return totalPrimitives;
+
+		while (!stack.empty())
+		{
+			const cgltf_node* node = stack.back();
+			stack.pop_back();
+
+			const auto nodeIndex = static_cast<std::size_t>(node - data->nodes);
+			if (visited[nodeIndex])
+			{
+				bCycle = true;
+				break;
+			}
+			visited[nodeIndex] = 1;
+			++visitedCount;
+
+			float localMatrix[16];
+			cgltf_node_transform_local(node, localMatrix);
+
+			// cgltf stores matrices in column-major order (OpenGL convention).
+			// DirectXMath uses row-major storage, so we transpose.
+			const XMMATRIX local = XMMatrixTranspose(XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(localMatrix)));
+
+			XMMATRIX world = local;
+			if (node->parent)
+			{
+				const XMMATRIX parentWorld = XMLoadFloat4x4(&outWorldTransforms[node->parent - data->nodes]);
+				world = XMMatrixMultiply(parentWorld, local);
+			}
+			XMStoreFloat4x4(&outWorldTransforms[nodeIndex], world);
+
+			for (cgltf_size c = 0; c < node->children_count; ++c)
+			{
+				stack.push_back(node->children[c]);
+			}
+		}
+
+		if (bCycle || visitedCount != data->nodes_count)
+		{
+			result.errorMessage = std::format("GltfLoader: Node hierarchy of '{}' contains a cycle", pathStr);
+			LOG_ERROR(result.errorMessage);
+			return false;
+		}
+		return true;
 	}
 
-	void ExtractMeshesFromNodes(const cgltf_data* data, GltfLoader::LoadResult& result)
+	// Builds the unique-primitive work list. Meshes get slots in the order
+	// nodes first reference them, which keeps output order deterministic.
+	[[nodiscard]] PrimitiveWorkList BuildPrimitiveWorkList(const cgltf_data* data)
 	{
+		PrimitiveWorkList workList;
+		workList.meshSlotBase.assign(data->meshes_count, kInvalidSlot);
+
 		for (cgltf_size n = 0; n < data->nodes_count; ++n)
 		{
-			const cgltf_node& node = data->nodes[n];
-			if (!node.mesh)
+			const cgltf_mesh* mesh = data->nodes[n].mesh;
+			if (!mesh)
 			{
 				continue;
 			}
 
-			const XMMATRIX worldTransform = ComputeNodeWorldTransform(&node);
-
-			XMFLOAT4X4 worldMatrix;
-			XMStoreFloat4x4(&worldMatrix, worldTransform);
+			std::uint32_t& slotBase = workList.meshSlotBase[mesh - data->meshes];
+			if (slotBase != kInvalidSlot)
+			{
+				continue;  // Already scheduled by an earlier instance
+			}
 
-			for (cgltf_size p = 0; p < node.mesh->primitives_count; ++p)
+			slotBase = static_cast<std::uint32_t>(workList.primitiveSlots.size());
+			for (cgltf_size p = 0; p < mesh->primitives_count; ++p)
 			{
-				const cgltf_primitive& primitive = node.mesh->primitives[p];
+				const cgltf_primitive& primitive = mesh->primitives[p];
 
 				// Only triangle geometry is supported
 				if (primitive.type != cgltf_primitive_type_triangles)
 				{
+					workList.primitiveSlots.push_back(kInvalidSlot);
 					continue;
 				}
 
-				MeshData meshData = ExtractPrimitive(primitive);
-				if (!meshData.IsValid())
+				workList.primitiveSlots.push_back(static_cast<std::uint32_t>(workList.items.size()));
+				workList.items.push_back({&primitive});
+			}
+		}
+
+		return workList;
+	}
+
+	[[nodiscard]] std::uint32_t ResolveWorkerCount(std::uint32_t requested, std::size_t workCount)
+	{
+		std::uint32_t workers = requested;
+		if (workers == 0)
+		{
+			workers = std::max(1u, std::thread::hardware_concurrency());
+		}
+		return static_cast<std::uint32_t>(std::min<std::size_t>(workers, std::max<std::size_t>(workCount, 1)));
+	}
+
+	// Extracts every work item into its preallocated slot, then drops the
+	// invalid ones with a stable compaction so the result is deterministic
+	// regardless of worker count or scheduling.
+	// @return Final mesh index per work-list slot (kInvalidSlot if dropped)
+	[[nodiscard]] std::vector<std::uint32_t> ExtractPrimitives(
+	    const cgltf_data* data,
+	    const std::vector<PrimitiveWorkItem>& workList,
+	    std::uint32_t workerCount,
+	    const Timer::Stopwatch& loadTimer,
+	    GltfLoader::LoadResult& result)
+	{
+		const std::size_t workCount = workList.size();
+
+		result.meshes.resize(workCount);
+		result.materialIndices.resize(workCount);
+
+		// Primitives vary wildly in size, so workers pull one item at a time
+		// instead of taking fixed ranges.
+		std::atomic<std::size_t> nextItem{0};
+		std::atomic_flag firstMeshDone;
+		auto worker = [&]()
+		{
+			for (std::size_t i = nextItem.fetch_add(1, std::memory_order_relaxed); i < workCount;
+			     i = nextItem.fetch_add(1, std::memory_order_relaxed))
+			{
+				const PrimitiveWorkItem& item = workList[i];
+				result.meshes[i] = ExtractPrimitive(*item.primitive);
+				result.materialIndices[i] = ResolveMaterialIndex(*item.primitive, data);
+
+				if (result.meshes[i].IsValid() && !firstMeshDone.test_and_set(std::memory_order_relaxed))
 				{
-					continue;
+					result.stats.timeToFirstMeshMs = loadTimer.ElapsedMillis();
 				}
+			}
+		};
+
+		{
+			// Calling thread is worker 0; jthreads join on scope exit
+			std::vector<std::jthread> threads;
+			threads.reserve(workerCount - 1);
+			for (std::uint32_t t = 1; t < workerCount; ++t)
+			{
+				threads.emplace_back(worker);
+			}
+			worker();
+		}
 
-				result.materialIndices.push_back(ResolveMaterialIndex(primitive, data));
-				result.transforms.push_back(worldMatrix);
-				result.meshes.push_back(std::move(meshData));
+		std::vector<std::uint32_t> slotToMesh(workCount, kInvalidSlot);
+
+		std::size_t writeIndex = 0;
+		for (std::size_t i = 0; i < workCount; ++i)
+		{
+			if (!result.meshes[i].IsValid())
+			{
+				continue;
 			}
+
+			if (writeIndex != i)
+			{
+				result.meshes[writeIndex] = std::move(result.meshes[i]);
+				result.materialIndices[writeIndex] = result.materialIndices[i];
+			}
+			slotToMesh[i] = static_cast<std::uint32_t>(writeIndex);
+			++writeIndex;
 		}
+
+		result.meshes.resize(writeIndex);
+		result.materialIndices.resize(writeIndex);
+
+		return slotToMesh;
 	}
 
-	// Typed read from a cgltf accessor at a given element index.
-	// Returns a zeroed value if the accessor is null or index is out of range.
-	template <typename T> [[nodiscard]] T ReadAccessorElement(const cgltf_accessor* accessor, cgltf_size index)
+	// Emits one instance per (node, extracted primitive) in node order.
+	void EmitInstances(
+	    const cgltf_data* data,
+	    const PrimitiveWorkList& workList,
+	    const std::vector<std::uint32_t>& slotToMesh,
+	    const std::vector<XMFLOAT4X4>& worldTransforms,
+	    GltfLoader::LoadResult& result)
 	{
-		T result{};
-		if (accessor && index < accessor->count)
+		for (cgltf_size n = 0; n < data->nodes_count; ++n)
 		{
-			cgltf_accessor_read_float(accessor, index, reinterpret_cast<cgltf_float*>(&result), sizeof(T) / sizeof(float));
+			const cgltf_mesh* mesh = data->nodes[n].mesh;
+			if (!mesh)
+			{
+				continue;
+			}
+
+			const std::uint32_t slotBase = workList.meshSlotBase[mesh - data->meshes];
+			for (cgltf_size p = 0; p < mesh->primitives_count; ++p)
+			{
+				const std::uint32_t slot = workList.primitiveSlots[slotBase + p];
+				if (slot == kInvalidSlot || slotToMesh[slot] == kInvalidSlot)
+				{
+					continue;
+				}
+
+				result.instances.push_back({slotToMesh[slot], worldTransforms[n]});
+			}
 		}
-		return result;
 	}
 
 	// Finds the accessor for a named attribute in a primitive (POSITION, NORMAL, etc.)
@@ -183,41 +453,7 @@ namespace GltfLoaderInternal
 			return;
 
 		outIndices.resize(accessor->count);
-		for (cgltf_size i = 0; i < accessor->count; ++i)
-		{
-			outIndices[i] = static_cast<uint32_t>(cgltf_accessor_read_index(accessor, i));
-		}
-	}
-
-	// Computes the world transform for a node by walking up the parent chain.
-	// cgltf provides local transforms; we accumulate to world space.
-	[[nodiscard]] XMMATRIX ComputeNodeWorldTransform(const cgltf_node* node)
-	{
-		XMMATRIX world = XMMatrixIdentity();
-
-		// Walk up the hierarchy, accumulating local transforms
-		// We collect them first, then multiply in root-to-leaf order
-		const cgltf_node* chain[64];
-		int depth = 0;
-
-		for (const cgltf_node* n = node; n != nullptr && depth < 64; n = n->parent)
-		{
-			chain[depth++] = n;
-		}
-
-		// Multiply root-to-leaf (reverse of collection order)
-		for (int i = depth - 1; i >= 0; --i)
-		{
-			float localMatrix[16];
-			cgltf_node_transform_local(chain[i], localMatrix);
-
-			// cgltf stores matrices in column-major order (OpenGL convention).
-			// DirectXMath uses row-major storage, so we transpose.
-			XMMATRIX local = XMMatrixTranspose(XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(localMatrix)));
-			world = XMMatrixMultiply(world, local);
-		}
-
-		return world;
+		GltfAccessorReader::ReadIndices(accessor, outIndices.data());
 	}
 
 	// Resolves the file path for a cgltf image relative to the glTF file directory.
@@ -333,37 +569,36 @@ namespace GltfLoaderInternal
 		if (!positions)
 			return {};
 
+		// Attributes are decoded into a vertex array sized from POSITION, and
+		// cgltf_validate only warns on mismatched counts: reject such primitives
+		for (const cgltf_accessor* attribute : {normals, texcoords, tangents})
+		{
+			if (attribute && attribute->count != positions->count)
+			{
+				LOG_WARNING(std::format(
+				    "GltfLoader: Skipping primitive with mismatched attribute counts ({} vs {} positions)",
+				    attribute->count,
+				    positions->count));
+				return {};
+			}
+		}
+
 		const auto vertexCount = static_cast<uint32_t>(positions->count);
 
 		MeshData meshData;
 		meshData.Reserve(vertexCount, primitive.indices ? static_cast<uint32_t>(primitive.indices->count) : 0);
 
-		// Build vertex array
+		// Build vertex array. Each attribute is decoded in one pass straight into
+		// the interleaved vertices; missing attributes keep VertexData defaults.
 		meshData.vertices.resize(vertexCount);
 
-		for (uint32_t v = 0; v < vertexCount; ++v)
-		{
-			VertexData& vertex = meshData.vertices[v];
+		VertexData* vertices = meshData.vertices.data();
+		constexpr std::size_t kVertexStride = sizeof(VertexData);
 
-			vertex.position = ReadAccessorElement<XMFLOAT3>(positions, v);
-
-			if (normals)
-			{
-				vertex.normal = ReadAccessorElement<XMFLOAT3>(normals, v);
-			}
-
-			if (texcoords)
-			{
-				vertex.uv = ReadAccessorElement<XMFLOAT2>(texcoords, v);
-			}
-
-			if (tangents)
-			{
-				vertex.tangent = ReadAccessorElement<XMFLOAT4>(tangents, v);
-			}
-
-			vertex.color = {1.0f, 1.0f, 1.0f, 1.0f};
-		}
+		GltfAccessorReader::ReadFloats(positions, &vertices->position, kVertexStride, 3);
+		GltfAccessorReader::ReadFloats(normals, &vertices->normal, kVertexStride, 3);
+		GltfAccessorReader::ReadFloats(texcoords, &vertices->uv, kVertexStride, 2);
+		GltfAccessorReader::ReadFloats(tangents, &vertices->tangent, kVertexStride, 4);
 
 		// Read index buffer
 		ReadIndices(primitive.indices, meshData.indices);
@@ -378,8 +613,14 @@ namespace GltfLoaderInternal
 // =============================================================================
 
 GltfLoader::LoadResult GltfLoader::Load(const std::filesystem::path& filePath)
+{
+	return Load(filePath, LoadOptions{});
+}
+
+GltfLoader::LoadResult GltfLoader::Load(const std::filesystem::path& filePath, const LoadOptions& options)
 {
 	LoadResult result;
+	const Timer::Stopwatch loadTimer;
 
 	// -------------------------------------------------------------------------
 	// Validate input
@@ -397,31 +638,43 @@ GltfLoader::LoadResult GltfLoader::Load(const std::filesystem::path& filePath)
 	// Parse glTF
 	// -------------------------------------------------------------------------
 
-	cgltf_options options{};
+	cgltf_options cgltfOptions{};
 	cgltf_data* data = nullptr;
 
-	if (!GltfLoaderInternal::ParseGltfFile(options, pathStr, data, result))
+	// Declared before the guard: cgltf_free releases files through it
+	GltfLoaderInternal::MappedFileSet mappedFiles;
+	if (options.bMemoryMapBuffers)
+	{
+		GltfLoaderInternal::ConfigureMappedFiles(cgltfOptions, mappedFiles);
+	}
+
+	if (!GltfLoaderInternal::ParseGltfFile(cgltfOptions, pathStr, data, result))
 	{
 		return result;
 	}
 
 	// RAII cleanup — cgltf_free must be called regardless of early exits
 	GltfLoaderInternal::CgltfGuard guard{data};
+	result.stats.parseMs = loadTimer.ElapsedMillis();
 
 	// -------------------------------------------------------------------------
 	// Load buffer data (required for accessor reads)
 	// -------------------------------------------------------------------------
 
-	if (!GltfLoaderInternal::LoadGltfBuffers(options, data, pathStr, result))
+	if (!GltfLoaderInternal::LoadGltfBuffers(cgltfOptions, data, pathStr, result))
 	{
 		return result;
 	}
 
+	result.stats.buffersMs = loadTimer.ElapsedMillis();
+	result.stats.mappedBytes = mappedFiles.mappedBytes;
+
 	// -------------------------------------------------------------------------
 	// Validate parsed data
 	// -------------------------------------------------------------------------
 
 	GltfLoaderInternal::ValidateGltf(data, pathStr);
+	GltfLoaderInternal::CollectSourceFiles(data, filePath, gltfDirectory, result.sourceFiles);
 
 	// -------------------------------------------------------------------------
 	// Extract materials
@@ -434,34 +687,53 @@ GltfLoader::LoadResult GltfLoader::Load(const std::filesystem::path& filePath)
 	GltfLoaderInternal::EnsureDefaultMaterial(result);
 
 	// -------------------------------------------------------------------------
-	// Count total primitives for reservation
+	// Extract meshes from node hierarchy
 	// -------------------------------------------------------------------------
 
-	const std::size_t totalPrimitives = GltfLoaderInternal::CountTotalPrimitives(data);
+	// Node transforms first: a cyclic hierarchy fails the load before any
+	// primitive is decoded
+	std::vector<XMFLOAT4X4> worldTransforms;
+	if (!GltfLoaderInternal::ComputeNodeWorldTransforms(data, pathStr, worldTransforms, result))
+	{
+		return result;
+	}
+
+	const GltfLoaderInternal::PrimitiveWorkList workList = GltfLoaderInternal::BuildPrimitiveWorkList(data);
+	const std::uint32_t workerCount = GltfLoaderInternal::ResolveWorkerCount(options.workerCount, workList.items.size());
 
-	result.meshes.reserve(totalPrimitives);
-	result.transforms.reserve(totalPrimitives);
-	result.materialIndices.reserve(totalPrimitives);
+	const std::vector<std::uint32_t> slotToMesh =
+	    GltfLoaderInternal::ExtractPrimitives(data, workList.items, workerCount, loadTimer, result);
 
 	// -------------------------------------------------------------------------
-	// Extract meshes from node hierarchy
+	// Instance meshes at every node that references them
 	// -------------------------------------------------------------------------
 
-	GltfLoaderInternal::ExtractMeshesFromNodes(data, result);
+	GltfLoaderInternal::EmitInstances(data, workList, slotToMesh, worldTransforms, result);
 
 	// -------------------------------------------------------------------------
 	// Finalize
 	// -------------------------------------------------------------------------
 
 	result.bSuccess = true;
+	result.stats.totalMs = loadTimer.ElapsedMillis();
 
 	LOG_INFO(
 	    std::format(
-	        "GltfLoader: Loaded '{}' — {} meshes, {} materials, {} textures",
+	        "GltfLoader: Loaded '{}' — {} meshes ({} instances), {} materials, {} textures ({:.2f} ms, {} workers)",
 	        filePath.filename().string(),
 	        result.meshes.size(),
+	        result.instances.size(),
 	        result.materials.size(),
-	        result.texturePaths.size()));
+	        result.texturePaths.size(),
+	        result.stats.totalMs,
+	        workerCount));
+	LOG_INFO(
+	    std::format(
+	        "GltfLoader:   parse {:.2f} ms, buffers {:.2f} ms ({:.1f} MB mapped), first mesh {:.2f} ms",
+	        result.stats.parseMs,
+	        result.stats.buffersMs,
+	        static_cast<double>(result.stats.mappedBytes) / (1024.0 * 1024.0),
+	        result.stats.timeToFirstMeshMs));
 
 	return result;
 }
@@ -0,0 +1,620 @@
+// =============================================================================
+// MeshCache.cpp — Cooked binary mesh cache (.smesh)
+// =============================================================================
+
+#include "PCH.h"
+#include "GameFramework/Public/Assets/MeshCache.h"
+#include "GameFramework/Public/Assets/AssetId.h"
+
+#include "Core/Public/Hash/HashUtils.h"
+#include "Core/Public/MappedFile.h"
+#include "FileSystemUtils.h"
+#include "Timer.h"
+
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string_view>
+
+using namespace DirectX;
+
+// =============================================================================
+// Internal Helpers
+// =============================================================================
+
+namespace MeshCacheInternal
+{
+	inline constexpr std::uint32_t kMagic = 0x48534D53;  // "SMSH"
+	inline constexpr std::uint32_t kVersion = 3;
+	inline constexpr std::uint64_t kBlobAlignment = 16;
+	inline constexpr std::uint32_t kNoString = 0xFFFFFFFFu;
+
+	// -------------------------------------------------------------------------
+	// On-disk records (little-endian, fixed layout)
+	// -------------------------------------------------------------------------
+
+	struct StringRef
+	{
+		std::uint32_t offset = 0;          // Into the string blob
+		std::uint32_t length = kNoString;  // kNoString = absent (optional paths)
+	};
+
+	struct FileHeader
+	{
+		std::uint32_t magic = kMagic;
+		std::uint32_t version = kVersion;
+		std::uint64_t assetId = 0;
+		std::uint64_t sourceSize = 0;
+		std::int64_t sourceWriteTime = 0;
+		std::uint64_t sourceContentHash = 0;
+		double coldImportMs = 0.0;
+
+		std::uint32_t meshCount = 0;
+		std::uint32_t instanceCount = 0;
+		std::uint32_t materialCount = 0;
+		std::uint32_t textureCount = 0;
+		std::uint32_t dependencyCount = 0;
+		std::uint32_t padding = 0;
+
+		std::uint64_t meshTableOffset = 0;
+		std::uint64_t instanceTableOffset = 0;
+		std::uint64_t materialTableOffset = 0;
+		std::uint64_t textureTableOffset = 0;
+		std::uint64_t dependencyTableOffset = 0;
+		std::uint64_t stringBlobOffset = 0;
+		std::uint64_t stringBlobSize = 0;
+		std::uint64_t vertexBlobOffset = 0;
+		std::uint64_t indexBlobOffset = 0;
+		std::uint64_t fileSize = 0;
+	};
+
+	struct MeshRecord
+	{
+		std::uint64_t firstVertex = 0;  // Element offset into the vertex blob
+		std::uint64_t firstIndex = 0;   // Element offset into the index blob
+		std::uint32_t vertexCount = 0;
+		std::uint32_t indexCount = 0;
+		std::uint32_t materialIndex = 0;
+		std::uint32_t padding = 0;
+	};
+
+	struct InstanceRecord
+	{
+		std::uint32_t meshIndex = 0;
+		XMFLOAT4X4 transform;
+	};
+
+	struct MaterialRecord
+	{
+		StringRef name;
+		XMFLOAT4 baseColor;
+		float metallic = 0.0f;
+		float roughness = 0.0f;
+		float f0 = 0.0f;
+		StringRef albedoTexture;
+		StringRef normalTexture;
+		StringRef metallicRoughnessTexture;
+	};
+
+	struct DependencyRecord
+	{
+		StringRef path;
+		std::uint64_t size = 0;
+		std::int64_t writeTime = 0;
+	};
+
+	static_assert(std::is_trivially_copyable_v<FileHeader>);
+	static_assert(std::is_trivially_copyable_v<MeshRecord>);
+	static_assert(std::is_trivially_copyable_v<InstanceRecord>);
+	static_assert(std::is_trivially_copyable_v<MaterialRecord>);
+	static_assert(std::is_trivially_copyable_v<DependencyRecord>);
+
+	// -------------------------------------------------------------------------
+	// Source validation
+	// -------------------------------------------------------------------------
+
+	struct FileStamp
+	{
+		std::uint64_t size = 0;
+		std::int64_t writeTime = 0;
+	};
+
+	[[nodiscard]] std::optional<FileStamp> GetFileStamp(const std::filesystem::path& path)
+	{
+		std::error_code ec;
+		const auto size = std::filesystem::file_size(path, ec);
+		if (ec)
+			return std::nullopt;
+
+		const auto writeTime = std::filesystem::last_write_time(path, ec);
+		if (ec)
+			return std::nullopt;
+
+		return FileStamp{static_cast<std::uint64_t>(size), static_cast<std::int64_t>(writeTime.time_since_epoch().count())};
+	}
+
+	[[nodiscard]] std::optional<std::uint64_t> HashFileContents(const std::filesystem::path& path)
+	{
+		Engine::FileSystem::MappedFile file;
+		if (!file.Open(path))
+			return std::nullopt;
+
+		return Engine::Hash::HashBytes64(file.GetData(), file.GetSize());
+	}
+
+	// Rewrites the source mtime in a cooked header once its content hash has
+	// been confirmed, so the next load is stamp-only again
+	void RefreshSourceWriteTime(const std::filesystem::path& cachePath, std::int64_t writeTime)
+	{
+		std::fstream stream(cachePath, std::ios::binary | std::ios::in | std::ios::out);
+		if (!stream)
+			return;
+
+		stream.seekp(static_cast<std::streamoff>(offsetof(FileHeader, sourceWriteTime)));
+		stream.write(reinterpret_cast<const char*>(&writeTime), sizeof(writeTime));
+	}
+
+	[[nodiscard]] std::uint64_t ComputeAssetKey(const std::filesystem::path& sourcePath)
+	{
+		const std::string normalized = Engine::FileSystem::NormalizePath(sourcePath).generic_string();
+		return AssetId(normalized).GetHash();
+	}
+
+	[[nodiscard]] constexpr std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) noexcept
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	// -------------------------------------------------------------------------
+	// Writing
+	// -------------------------------------------------------------------------
+
+	class StringBlobBuilder
+	{
+	  public:
+		[[nodiscard]] StringRef Add(std::string_view str)
+		{
+			StringRef ref{static_cast<std::uint32_t>(m_blob.size()), static_cast<std::uint32_t>(str.size())};
+			m_blob.append(str);
+			return ref;
+		}
+
+		[[nodiscard]] StringRef AddOptional(const std::optional<std::filesystem::path>& path)
+		{
+			return path ? Add(path->string()) : StringRef{};
+		}
+
+		[[nodiscard]] const std::string& GetBlob() const noexcept { return m_blob; }
+
+	  private:
+		std::string m_blob;
+	};
+
+	template <typename T> void WriteArray(std::ofstream& stream, const std::vector<T>& values)
+	{
+		stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+	}
+
+	void WritePadding(std::ofstream& stream, std::uint64_t targetOffset)
+	{
+		static constexpr char kZeros[kBlobAlignment] = {};
+		const auto current = static_cast<std::uint64_t>(stream.tellp());
+		stream.write(kZeros, static_cast<std::streamsize>(targetOffset - current));
+	}
+
+	// -------------------------------------------------------------------------
+	// Reading
+	// -------------------------------------------------------------------------
+
+	// Bounds-checked view over the mapped file. Every table and blob access
+	// goes through here so a truncated or corrupt file is just a cache miss.
+	class CookedFileReader
+	{
+	  public:
+		explicit CookedFileReader(std::span<const std::byte> bytes) noexcept : m_bytes(bytes) {}
+
+		template <typename T> [[nodiscard]] std::optional<std::span<const T>> GetArray(std::uint64_t offset, std::uint64_t count) const
+		{
+			if (offset % alignof(T) != 0 || count > m_bytes.size() / sizeof(T) || offset > m_bytes.size() - count * sizeof(T))
+				return std::nullopt;
+
+			return std::span<const T>(reinterpret_cast<const T*>(m_bytes.data() + offset), static_cast<std::size_t>(count));
+		}
+
+		// Elements [first, first + count) of a blob starting at blobOffset. first
+		// is bounded before it is scaled, so a corrupt record cannot wrap the offset.
+		template <typename T> [[nodiscard]] std::optional<std::span<const T>> GetBlobRange(std::uint64_t blobOffset, std::uint64_t first, std::uint64_t count) const
+		{
+			if (blobOffset > m_bytes.size() || first > (m_bytes.size() - blobOffset) / sizeof(T))
+				return std::nullopt;
+
+			return GetArray<T>(blobOffset + first * sizeof(T), count);
+		}
+
+		[[nodiscard]] std::optional<std::string_view> GetString(std::span<const char> blob, StringRef ref) const
+		{
+			if (ref.length == kNoString || ref.offset > blob.size() || ref.length > blob.size() - ref.offset)
+				return std::nullopt;
+
+			return std::string_view(blob.data() + ref.offset, ref.length);
+		}
+
+	  private:
+		std::span<const std::byte> m_bytes;
+	};
+
+	[[nodiscard]] std::optional<std::filesystem::path> ToOptionalPath(std::optional<std::string_view> str)
+	{
+		if (!str)
+			return std::nullopt;
+		return std::filesystem::path(*str);
+	}
+
+}  // namespace MeshCacheInternal
+
+// =============================================================================
+// MeshCache
+// =============================================================================
+
+std::filesystem::path MeshCache::GetCachePath(const std::filesystem::path& cacheDirectory, const std::filesystem::path& sourcePath)
+{
+	const std::uint64_t key = MeshCacheInternal::ComputeAssetKey(sourcePath);
+	return cacheDirectory / std::format("{}_{:016x}{}", sourcePath.stem().string(), key, kFileExtension);
+}
+
+bool MeshCache::TryLoad(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath, GltfLoader::LoadResult& outResult)
+{
+	using namespace MeshCacheInternal;
+
+	const Timer::Stopwatch loadTimer;
+
+	std::error_code ec;
+	if (!std::filesystem::exists(cachePath, ec))
+	{
+		return false;
+	}
+
+	const std::optional<FileStamp> sourceStamp = GetFileStamp(sourcePath);
+	if (!sourceStamp)
+	{
+		return false;
+	}
+
+	Engine::FileSystem::MappedFile file;
+	if (!file.Open(cachePath) || file.GetSize() < sizeof(FileHeader))
+	{
+		return false;
+	}
+
+	FileHeader header;
+	std::memcpy(&header, file.GetData(), sizeof(FileHeader));
+
+	if (header.magic != kMagic || header.version != kVersion || header.fileSize != file.GetSize())
+	{
+		LOG_INFO(std::format("MeshCache: '{}' has an incompatible format, re-cooking", cachePath.filename().string()));
+		return false;
+	}
+
+	if (header.assetId != ComputeAssetKey(sourcePath) || header.sourceSize != sourceStamp->size)
+	{
+		LOG_INFO(std::format("MeshCache: '{}' is stale, re-cooking", cachePath.filename().string()));
+		return false;
+	}
+
+	const CookedFileReader reader(file.GetBytes());
+
+	const auto meshes = reader.GetArray<MeshRecord>(header.meshTableOffset, header.meshCount);
+	const auto instances = reader.GetArray<InstanceRecord>(header.instanceTableOffset, header.instanceCount);
+	const auto materials = reader.GetArray<MaterialRecord>(header.materialTableOffset, header.materialCount);
+	const auto textures = reader.GetArray<StringRef>(header.textureTableOffset, header.textureCount);
+	const auto dependencies = reader.GetArray<DependencyRecord>(header.dependencyTableOffset, header.dependencyCount);
+	const auto strings = reader.GetArray<char>(header.stringBlobOffset, header.stringBlobSize);
+	if (!meshes || !instances || !materials || !textures || !dependencies || !strings)
+	{
+		LOG_WARNING(std::format("MeshCache: '{}' is corrupt, re-cooking", cachePath.filename().string()));
+		return false;
+	}
+
+	// External buffers (.bin) are checked by stamp only; hashing them would
+	// cost as much as re-reading the source.
+	for (const DependencyRecord& dependency : *dependencies)
+	{
+		const auto path = reader.GetString(*strings, dependency.path);
+		const auto stamp = path ? GetFileStamp(std::filesystem::path(*path)) : std::nullopt;
+		if (!stamp || stamp->size != dependency.size || stamp->writeTime != dependency.writeTime)
+		{
+			LOG_INFO(std::format("MeshCache: '{}' has a stale dependency, re-cooking", cachePath.filename().string()));
+			return false;
+		}
+	}
+
+	// Matching size and mtime are trusted; only a moved mtime (checkout,
+	// copy, touch) pays for hashing the source to tell edits from no-ops
+	const bool bSourceTouched = header.sourceWriteTime != sourceStamp->writeTime;
+	if (bSourceTouched)
+	{
+		const std::optional<std::uint64_t> contentHash = HashFileContents(sourcePath);
+		if (!contentHash || *contentHash != header.sourceContentHash)
+		{
+			LOG_INFO(std::format("MeshCache: '{}' content changed, re-cooking", cachePath.filename().string()));
+			return false;
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// Build result straight from the mapped tables
+	// -------------------------------------------------------------------------
+
+	GltfLoader::LoadResult result;
+
+	result.materials.reserve(materials->size());
+	for (const MaterialRecord& record : *materials)
+	{
+		MaterialDesc desc;
+		desc.name = std::string(reader.GetString(*strings, record.name).value_or(std::string_view{}));
+		desc.baseColor = record.baseColor;
+		desc.metallic = record.metallic;
+		desc.roughness = record.roughness;
+		desc.f0 = record.f0;
+		desc.albedoTexture = ToOptionalPath(reader.GetString(*strings, record.albedoTexture));
+		desc.normalTexture = ToOptionalPath(reader.GetString(*strings, record.normalTexture));
+		desc.metallicRoughnessTexture = ToOptionalPath(reader.GetString(*strings, record.metallicRoughnessTexture));
+		result.materials.push_back(std::move(desc));
+	}
+
+	result.texturePaths.reserve(textures->size());
+	for (const StringRef& texture : *textures)
+	{
+		result.texturePaths.emplace_back(reader.GetString(*strings, texture).value_or(std::string_view{}));
+	}
+
+	result.meshes.reserve(meshes->size());
+	result.materialIndices.reserve(meshes->size());
+
+	for (const MeshRecord& record : *meshes)
+	{
+		const auto vertices = reader.GetBlobRange<VertexData>(header.vertexBlobOffset, record.firstVertex, record.vertexCount);
+		const auto indices = reader.GetBlobRange<std::uint32_t>(header.indexBlobOffset, record.firstIndex, record.indexCount);
+		if (!vertices || !indices)
+		{
+			LOG_WARNING(std::format("MeshCache: '{}' is corrupt, re-cooking", cachePath.filename().string()));
+			return false;
+		}
+
+		// MeshData owns its arrays, so each blob range is copied out once; the
+		// mapping is closed before returning
+		MeshData meshData;
+		meshData.vertices.assign(vertices->begin(), vertices->end());
+		meshData.indices.assign(indices->begin(), indices->end());
+
+		result.meshes.push_back(std::move(meshData));
+		result.materialIndices.push_back(record.materialIndex);
+	}
+
+	result.instances.reserve(instances->size());
+	for (const InstanceRecord& record : *instances)
+	{
+		if (record.meshIndex >= result.meshes.size())
+		{
+			LOG_WARNING(std::format("MeshCache: '{}' is corrupt, re-cooking", cachePath.filename().string()));
+			return false;
+		}
+		result.instances.push_back({record.meshIndex, record.transform});
+	}
+
+	file.Close();
+	if (bSourceTouched)
+	{
+		RefreshSourceWriteTime(cachePath, sourceStamp->writeTime);
+	}
+
+	result.sourceFiles.push_back(sourcePath);
+	result.bSuccess = true;
+	result.stats.totalMs = loadTimer.ElapsedMillis();
+
+	LOG_INFO(
+	    std::format(
+	        "MeshCache: Loaded '{}' — {} meshes ({} instances) in {:.2f} ms (cold import {:.2f} ms)",
+	        cachePath.filename().string(),
+	        result.meshes.size(),
+	        result.instances.size(),
+	        result.stats.totalMs,
+	        header.coldImportMs));
+
+	outResult = std::move(result);
+	return true;
+}
+
+bool MeshCache::Write(const std::filesystem::path& cachePath, const std::filesystem::path& sourcePath, const GltfLoader::LoadResult& result)
+{
+	using namespace MeshCacheInternal;
+
+	if (!result.bSuccess)
+	{
+		return false;
+	}
+
+	const std::optional<FileStamp> sourceStamp = GetFileStamp(sourcePath);
+	const std::optional<std::uint64_t> contentHash = HashFileContents(sourcePath);
+	if (!sourceStamp || !contentHash)
+	{
+		return false;
+	}
+
+	// -------------------------------------------------------------------------
+	// Build tables
+	// -------------------------------------------------------------------------
+
+	StringBlobBuilder strings;
+
+	std::vector<MeshRecord> meshRecords;
+	meshRecords.reserve(result.meshes.size());
+
+	std::uint64_t totalVertices = 0;
+	std::uint64_t totalIndices = 0;
+	for (std::size_t i = 0; i < result.meshes.size(); ++i)
+	{
+		const MeshData& mesh = result.meshes[i];
+
+		MeshRecord record;
+		record.firstVertex = totalVertices;
+		record.firstIndex = totalIndices;
+		record.vertexCount = mesh.GetVertexCount();
+		record.indexCount = mesh.GetIndexCount();
+		record.materialIndex = i < result.materialIndices.size() ? result.materialIndices[i] : 0;
+		meshRecords.push_back(record);
+
+		totalVertices += mesh.GetVertexCount();
+		totalIndices += mesh.GetIndexCount();
+	}
+
+	std::vector<InstanceRecord> instanceRecords;
+	instanceRecords.reserve(result.instances.size());
+	for (const GltfLoader::MeshInstance& instance : result.instances)
+	{
+		instanceRecords.push_back({instance.meshIndex, instance.transform});
+	}
+
+	std::vector<MaterialRecord> materialRecords;
+	materialRecords.reserve(result.materials.size());
+	for (const MaterialDesc& desc : result.materials)
+	{
+		MaterialRecord record;
+		record.name = strings.Add(desc.name);
+		record.baseColor = desc.baseColor;
+		record.metallic = desc.metallic;
+		record.roughness = desc.roughness;
+		record.f0 = desc.f0;
+		record.albedoTexture = strings.AddOptional(desc.albedoTexture);
+		record.normalTexture = strings.AddOptional(desc.normalTexture);
+		record.metallicRoughnessTexture = strings.AddOptional(desc.metallicRoughnessTexture);
+		materialRecords.push_back(record);
+	}
+
+	std::vector<StringRef> textureRecords;
+	textureRecords.reserve(result.texturePaths.size());
+	for (const std::string& texturePath : result.texturePaths)
+	{
+		textureRecords.push_back(strings.Add(texturePath));
+	}
+
+	std::vector<DependencyRecord> dependencyRecords;
+	for (const std::filesystem::path& dependency : result.sourceFiles)
+	{
+		if (dependency == sourcePath)
+			continue;
+
+		const std::optional<FileStamp> stamp = GetFileStamp(dependency);
+		if (!stamp)
+			return false;
+
+		dependencyRecords.push_back({strings.Add(dependency.string()), stamp->size, stamp->writeTime});
+	}
+
+	// -------------------------------------------------------------------------
+	// Layout
+	// -------------------------------------------------------------------------
+
+	FileHeader header;
+	header.assetId = ComputeAssetKey(sourcePath);
+	header.sourceSize = sourceStamp->size;
+	header.sourceWriteTime = sourceStamp->writeTime;
+	header.sourceContentHash = *contentHash;
+	header.coldImportMs = result.stats.totalMs;
+	header.meshCount = static_cast<std::uint32_t>(meshRecords.size());
+	header.instanceCount = static_cast<std::uint32_t>(instanceRecords.size());
+	header.materialCount = static_cast<std::uint32_t>(materialRecords.size());
+	header.textureCount = static_cast<std::uint32_t>(textureRecords.size());
+	header.dependencyCount = static_cast<std::uint32_t>(dependencyRecords.size());
+
+	std::uint64_t offset = sizeof(FileHeader);
+	header.meshTableOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += meshRecords.size() * sizeof(MeshRecord);
+	header.instanceTableOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += instanceRecords.size() * sizeof(InstanceRecord);
+	header.materialTableOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += materialRecords.size() * sizeof(MaterialRecord);
+	header.textureTableOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += textureRecords.size() * sizeof(StringRef);
+	header.dependencyTableOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += dependencyRecords.size() * sizeof(DependencyRecord);
+	header.stringBlobOffset = offset = AlignUp(offset, kBlobAlignment);
+	header.stringBlobSize = strings.GetBlob().size();
+	offset += header.stringBlobSize;
+	header.vertexBlobOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += totalVertices * sizeof(VertexData);
+	header.indexBlobOffset = offset = AlignUp(offset, kBlobAlignment);
+	offset += totalIndices * sizeof(std::uint32_t);
+	header.fileSize = offset;
+
+	// -------------------------------------------------------------------------
+	// Write (temp file + rename)
+	// -------------------------------------------------------------------------
+
+	std::error_code ec;
+	std::filesystem::create_directories(cachePath.parent_path(), ec);
+
+	std::filesystem::path tempPath = cachePath;
+	tempPath += ".tmp";
+
+	{
+		std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+		if (!stream)
+		{
+			LOG_WARNING(std::format("MeshCache: Cannot write '{}'", tempPath.string()));
+			return false;
+		}
+
+		stream.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+		WritePadding(stream, header.meshTableOffset);
+		WriteArray(stream, meshRecords);
+		WritePadding(stream, header.instanceTableOffset);
+		WriteArray(stream, instanceRecords);
+		WritePadding(stream, header.materialTableOffset);
+		WriteArray(stream, materialRecords);
+		WritePadding(stream, header.textureTableOffset);
+		WriteArray(stream, textureRecords);
+		WritePadding(stream, header.dependencyTableOffset);
+		WriteArray(stream, dependencyRecords);
+		WritePadding(stream, header.stringBlobOffset);
+		stream.write(strings.GetBlob().data(), static_cast<std::streamsize>(strings.GetBlob().size()));
+		WritePadding(stream, header.vertexBlobOffset);
+		for (const MeshData& mesh : result.meshes)
+		{
+			WriteArray(stream, mesh.vertices);
+		}
+		WritePadding(stream, header.indexBlobOffset);
+		for (const MeshData& mesh : result.meshes)
+		{
+			WriteArray(stream, mesh.indices);
+		}
+
+		if (!stream)
+		{
+			LOG_WARNING(std::format("MeshCache: Failed writing '{}'", tempPath.string()));
+			stream.close();
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(tempPath, cachePath, ec);
+	if (ec)
+	{
+		LOG_WARNING(std::format("MeshCache: Cannot replace '{}' ({})", cachePath.string(), ec.message()));
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+
+	LOG_INFO(
+	    std::format(
+	        "MeshCache: Cooked '{}' — {} meshes, {:.1f} MB",
+	        cachePath.filename().string(),
+	        result.meshes.size(),
+	        static_cast<double>(header.fileSize) / (1024.0 * 1024.0)));
+
+	return true;
+}
@@ -1,32 +1,24 @@
 #include "PCH.h"
 #include "ImportedMesh.h"
 
-ImportedMesh::ImportedMesh(MeshData&& meshData, const DirectX::XMFLOAT4X4& worldTransform) noexcept :
-    Mesh(), m_importedData(std::move(meshData)), m_worldTransform(worldTransform)
+ImportedMesh::ImportedMesh(MeshGeometryHandle meshData, const DirectX::XMFLOAT4X4& worldTransform) noexcept :
+    Mesh(), m_importedData(std::move(meshData))
 {
+	SetExplicitWorldMatrix(worldTransform);
 }
 
 // =============================================================================
-// World Matrix
+// Geometry
 // =============================================================================
 
-DirectX::XMMATRIX ImportedMesh::GetWorldMatrix() const noexcept
-{
-	return DirectX::XMLoadFloat4x4(&m_worldTransform);
-}
-
-DirectX::XMMATRIX ImportedMesh::GetWorldInverseTransposeMatrix() const noexcept
+MeshGeometryHandle ImportedMesh::CreateGeometry() const
 {
-	const DirectX::XMMATRIX world = DirectX::XMLoadFloat4x4(&m_worldTransform);
-	return DirectX::XMMatrixTranspose(DirectX::XMMatrixInverse(nullptr, world));
+	return m_importedData;
 }
 
-// =============================================================================
-// Geometry
-// =============================================================================
-
 void ImportedMesh::GenerateGeometry(MeshData& outMeshData) const
 {
-	outMeshData.vertices = m_importedData.vertices;
-	outMeshData.indices = m_importedData.indices;
+	outMeshData.vertices = m_importedData->vertices;
+	outMeshData.indices = m_importedData->indices;
+	outMeshData.bounds = m_importedData->bounds;
 }
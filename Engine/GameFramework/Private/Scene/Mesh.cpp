@@ -6,6 +6,14 @@ Mesh::Mesh(const DirectX::XMFLOAT3& translation, const DirectX::XMFLOAT3& rotati
 {
 }
 
+Mesh::~Mesh()
+{
+	if (m_transformStore)
+	{
+		m_transformStore->Release(m_transformHandle);
+	}
+}
+
 // =============================================================================
 // Transform
 // =============================================================================
@@ -13,48 +21,66 @@ Mesh::Mesh(const DirectX::XMFLOAT3& translation, const DirectX::XMFLOAT3& rotati
 void Mesh::SetTranslation(const DirectX::XMFLOAT3& t) noexcept
 {
 	m_translation = t;
-	InvalidateWorldCache();
+	if (m_transformStore)
+		m_transformStore->SetTranslation(m_transformHandle, t);
 }
 
 void Mesh::SetRotationEuler(const DirectX::XMFLOAT3& r) noexcept
 {
 	m_rotationEuler = r;
-	InvalidateWorldCache();
+	if (m_transformStore)
+		m_transformStore->SetRotationEuler(m_transformHandle, r);
 }
 
 void Mesh::SetScale(const DirectX::XMFLOAT3& s) noexcept
 {
 	m_scale = s;
-	InvalidateWorldCache();
+	if (m_transformStore)
+		m_transformStore->SetScale(m_transformHandle, s);
+}
+
+void Mesh::SetExplicitWorldMatrix(const DirectX::XMFLOAT4X4& world) noexcept
+{
+	m_explicitWorld = world;
+	if (m_transformStore)
+		m_transformStore->SetWorldMatrix(m_transformHandle, world);
+}
+
+void Mesh::AttachTransform(TransformStore& store)
+{
+	if (m_transformStore)
+	{
+		m_transformStore->Release(m_transformHandle);
+	}
+
+	m_transformStore = &store;
+	m_transformHandle = m_explicitWorld ? store.AllocateExplicit(*m_explicitWorld)
+	                                    : store.Allocate(m_translation, m_rotationEuler, m_scale);
 }
 
 // =============================================================================
 // World Matrix
 // =============================================================================
 
-void Mesh::RebuildWorldIfNeeded() const noexcept
+DirectX::XMMATRIX Mesh::ComputeWorldMatrix() const noexcept
 {
-	if (!m_bWorldDirty)
-		return;
+	if (m_explicitWorld)
+		return DirectX::XMLoadFloat4x4(&*m_explicitWorld);
 
 	const DirectX::XMMATRIX S = DirectX::XMMatrixScaling(m_scale.x, m_scale.y, m_scale.z);
 	const DirectX::XMMATRIX R = DirectX::XMMatrixRotationRollPitchYaw(m_rotationEuler.x, m_rotationEuler.y, m_rotationEuler.z);
 	const DirectX::XMMATRIX T = DirectX::XMMatrixTranslation(m_translation.x, m_translation.y, m_translation.z);
-	DirectX::XMStoreFloat4x4(&m_worldMatrixCache, S * R * T);
-	m_bWorldDirty = false;
+	return S * R * T;
 }
 
 DirectX::XMMATRIX Mesh::GetWorldMatrix() const noexcept
 {
-	RebuildWorldIfNeeded();
-	return DirectX::XMLoadFloat4x4(&m_worldMatrixCache);
+	return m_transformStore ? m_transformStore->GetWorldMatrix(m_transformHandle) : ComputeWorldMatrix();
 }
 
 DirectX::XMMATRIX Mesh::GetWorldInverseTransposeMatrix() const noexcept
 {
-	RebuildWorldIfNeeded();
-	const DirectX::XMMATRIX world = DirectX::XMLoadFloat4x4(&m_worldMatrixCache);
-	return DirectX::XMMatrixTranspose(DirectX::XMMatrixInverse(nullptr, world));
+	return DirectX::XMMatrixTranspose(DirectX::XMMatrixInverse(nullptr, GetWorldMatrix()));
 }
 
 DirectX::XMFLOAT3X3 Mesh::GetWorldRotationMatrix3x3() const noexcept
@@ -70,20 +96,35 @@ DirectX::XMFLOAT3X3 Mesh::GetWorldRotationMatrix3x3() const noexcept
 // Geometry
 // =============================================================================
 
+MeshGeometryHandle Mesh::CreateGeometry() const
+{
+	if (const std::optional<PrimitiveGeometryKey> key = GetGeometryKey())
+	{
+		return PrimitiveGeometryCache::GetOrCreate(*key, [this](MeshData& outMeshData) { GenerateGeometry(outMeshData); });
+	}
+
+	MeshData meshData;
+	GenerateGeometry(meshData);
+	return MakeMeshGeometry(std::move(meshData));
+}
+
 void Mesh::RebuildGeometry()
 {
-	m_meshData.Clear();
-	GenerateGeometry(m_meshData);
+	m_geometry = CreateGeometry();
 	m_bGeometryDirty = false;
 }
 
-const MeshData& Mesh::GetMeshData() const
+const MeshGeometryHandle& Mesh::GetGeometry() const
 {
 	if (m_bGeometryDirty)
 	{
-		m_meshData.Clear();
-		GenerateGeometry(m_meshData);
+		m_geometry = CreateGeometry();
 		m_bGeometryDirty = false;
 	}
-	return m_meshData;
+	return m_geometry;
+}
+
+const MeshData& Mesh::GetMeshData() const
+{
+	return *GetGeometry();
 }
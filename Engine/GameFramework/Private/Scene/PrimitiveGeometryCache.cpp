@@ -0,0 +1,98 @@
+#include "PCH.h"
+#include "Scene/PrimitiveGeometryCache.h"
+#include "Scene/Mesh.h"  // MeshFactory.h (key shape enum) needs Mesh complete
+
+#include <mutex>
+#include <unordered_map>
+
+namespace PrimitiveGeometryCacheInternal
+{
+	struct KeyHash
+	{
+		std::size_t operator()(const PrimitiveGeometryKey& key) const noexcept
+		{
+			uint64 h = static_cast<uint64>(key.shape);
+			h = h * 0x9E3779B97F4A7C15ull ^ key.tessellationU;
+			h = h * 0x9E3779B97F4A7C15ull ^ key.tessellationV;
+			h = h * 0x9E3779B97F4A7C15ull ^ key.tessellationW;
+			return static_cast<std::size_t>(h);
+		}
+	};
+
+	struct CacheState
+	{
+		std::mutex mutex;
+		std::unordered_map<PrimitiveGeometryKey, std::weak_ptr<const MeshData>, KeyHash> entries;
+		uint64 hits = 0;
+		uint64 misses = 0;
+	};
+
+	CacheState& GetState()
+	{
+		static CacheState state;
+		return state;
+	}
+
+	// Drops entries whose geometry is no longer referenced by any mesh
+	void PruneExpired(CacheState& state)
+	{
+		std::erase_if(state.entries, [](const auto& entry) { return entry.second.expired(); });
+	}
+
+}  // namespace PrimitiveGeometryCacheInternal
+
+// =============================================================================
+// Lookup
+// =============================================================================
+
+MeshGeometryHandle PrimitiveGeometryCache::GetOrCreate(const PrimitiveGeometryKey& key, const GenerateFn& generate)
+{
+	using namespace PrimitiveGeometryCacheInternal;
+
+	CacheState& state = GetState();
+	std::scoped_lock lock(state.mutex);
+
+	auto it = state.entries.find(key);
+	if (it != state.entries.end())
+	{
+		if (MeshGeometryHandle shared = it->second.lock())
+		{
+			++state.hits;
+			return shared;
+		}
+	}
+
+	++state.misses;
+	PruneExpired(state);
+
+	MeshData meshData;
+	generate(meshData);
+	MeshGeometryHandle geometry = MakeMeshGeometry(std::move(meshData));
+	state.entries[key] = geometry;
+	return geometry;
+}
+
+// =============================================================================
+// Statistics
+// =============================================================================
+
+PrimitiveGeometryCache::Stats PrimitiveGeometryCache::GetStats()
+{
+	using namespace PrimitiveGeometryCacheInternal;
+
+	CacheState& state = GetState();
+	std::scoped_lock lock(state.mutex);
+
+	Stats stats;
+	stats.hits = state.hits;
+	stats.misses = state.misses;
+	for (const auto& [key, weak] : state.entries)
+	{
+		if (MeshGeometryHandle geometry = weak.lock())
+		{
+			++stats.liveEntries;
+			stats.residentBytes += geometry->GetVertexBufferSize() + geometry->GetIndexBufferSize();
+		}
+	}
+	return stats;
+}
@@ -15,9 +15,9 @@ void PrimitiveCapsule::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int lonSegments = 32;
-	const int hemiStacks = 8;
-	const int cylStacks = 4;
+	const int lonSegments = kLonSegments;
+	const int hemiStacks = kHemiStacks;
+	const int cylStacks = kCylStacks;
 	const float radius = 0.5f;
 	const float halfCylinder = 0.5f;
 
@@ -13,7 +13,7 @@ void PrimitiveCone::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int slices = 32;
+	const int slices = kSlices;
 	outVertices.clear();
 	outVertices.reserve(slices + 2);
 
@@ -13,7 +13,7 @@ void PrimitiveCylinder::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int slices = 32;
+	const int slices = kSlices;
 	outVertices.clear();
 	outVertices.reserve((slices + 1) * 2 + 2);
 
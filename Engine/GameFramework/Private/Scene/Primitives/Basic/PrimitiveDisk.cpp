@@ -13,7 +13,7 @@ void PrimitiveDisk::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int slices = 32;
+	const int slices = kSlices;
 	outVertices.clear();
 	outVertices.reserve((size_t) slices + 2);
 
@@ -15,8 +15,8 @@ void PrimitiveHemisphere::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int latSegments = 8;
-	const int lonSegments = 16;
+	const int latSegments = kLatSegments;
+	const int lonSegments = kLonSegments;
 
 	outVertices.clear();
 	// Curved surface vertices + cap vertices
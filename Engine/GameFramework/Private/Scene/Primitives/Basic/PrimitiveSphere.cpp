@@ -14,8 +14,8 @@ void PrimitiveSphere::GenerateGeometry(MeshData& outMeshData) const
 	auto& outIndices = outMeshData.indices;
 
 	// UV sphere parameterization
-	const int latSegments = 16;
-	const int lonSegments = 16;
+	const int latSegments = kLatSegments;
+	const int lonSegments = kLonSegments;
 	outVertices.clear();
 	outVertices.reserve((latSegments + 1) * (lonSegments + 1));
 
@@ -13,8 +13,8 @@ void PrimitiveTorus::GenerateGeometry(MeshData& outMeshData) const
 	auto& outVertices = outMeshData.vertices;
 	auto& outIndices = outMeshData.indices;
 
-	const int major = 32;
-	const int minor = 16;
+	const int major = kMajorSegments;
+	const int minor = kMinorSegments;
 	const float R = 1.0f;  // major radius
 	const float r = 0.3f;  // minor radius
 
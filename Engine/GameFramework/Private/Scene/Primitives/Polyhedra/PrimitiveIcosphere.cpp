@@ -18,7 +18,7 @@ void PrimitiveIcosphere::GenerateGeometry(MeshData& outMeshData) const
 	auto& outIndices = outMeshData.indices;
 
 	// Build subdivided triangle mesh, then convert to VertexData.
-	const int subdivisions = 2;
+	const int subdivisions = kSubdivisions;
 
 	const float phi = (1.0f + sqrtf(5.0f)) * 0.5f;
 	std::vector<DirectX::XMFLOAT3> positions = {
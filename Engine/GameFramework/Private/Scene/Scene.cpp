@@ -6,10 +6,14 @@
 #include "Camera/GameCamera.h"
 #include "Assets/AssetSystem.h"
 #include "Assets/GltfLoader.h"
+#include "Assets/MeshCache.h"
 #include "Level/Level.h"
 #include "Level/LevelDesc.h"
 #include "Core/Public/Diagnostics/Log.h"
 #include "Scene/MeshFactory.h"
+#include "Scene/PrimitiveGeometryCache.h"
+
+#include <format>
 
 Scene::Scene() : m_camera(std::make_unique<GameCamera>()) {}
 
@@ -68,7 +72,7 @@ void Scene::LoadImportedMeshRequest(const MeshRequest& request, AssetSystem& ass
 	auto resolved = assetSystem.ResolvePath(request.assetPath, request.assetType);
 	if (resolved)
 	{
-		AppendGltf(*resolved);
+		AppendGltf(*resolved, assetSystem.GetMeshCacheOutputPath());
 		return;
 	}
 
@@ -86,13 +90,30 @@ void Scene::AppendProceduralMeshes(const PrimitiveRequest& request)
 	factory.AppendShapes(request.shape, request.count, request.center, request.extents, request.seed);
 
 	std::vector<std::unique_ptr<Mesh>> meshes = std::move(factory).TakeMeshes();
+
+	// Resolve geometry now so identical primitives share one MeshData up front
+	for (const auto& mesh : meshes)
+	{
+		mesh->RebuildGeometry();
+	}
+
+	const PrimitiveGeometryCache::Stats stats = PrimitiveGeometryCache::GetStats();
+	LOG_INFO(std::format(
+	    "Scene: Spawned {} primitives — {} unique geometries ({:.1f} KB resident)",
+	    meshes.size(),
+	    stats.liveEntries,
+	    static_cast<double>(stats.residentBytes) / 1024.0));
+
 	AddMeshes(std::move(meshes));
 }
 
 void Scene::Clear()
 {
 	m_meshes.clear();
+	m_transforms.Clear();
 	m_loadedMaterials.clear();
+	++m_meshListGeneration;
+	++m_materialGeneration;
 	m_currentLevelName.clear();
 }
 
@@ -106,11 +127,24 @@ bool Scene::LoadGltf(const std::filesystem::path& filePath)
 	return AppendGltf(filePath);
 }
 
-bool Scene::AppendGltf(const std::filesystem::path& filePath)
+bool Scene::AppendGltf(const std::filesystem::path& filePath, const std::filesystem::path& cacheDirectory)
 {
 	LOG_INFO("Scene: Loading glTF from " + filePath.string());
 
-	GltfLoader::LoadResult result = GltfLoader::Load(filePath);
+	GltfLoader::LoadResult result;
+
+	const bool bUseCache = !cacheDirectory.empty();
+	const std::filesystem::path cachePath = bUseCache ? MeshCache::GetCachePath(cacheDirectory, filePath) : std::filesystem::path{};
+
+	if (!bUseCache || !MeshCache::TryLoad(cachePath, filePath, result))
+	{
+		result = GltfLoader::Load(filePath);
+
+		if (bUseCache && result.IsValid())
+		{
+			MeshCache::Write(cachePath, filePath, result);
+		}
+	}
 
 	if (!result.IsValid())
 	{
@@ -128,23 +162,56 @@ bool Scene::AppendGltf(const std::filesystem::path& filePath)
 		{
 			m_loadedMaterials.push_back(std::move(material));
 		}
+		++m_materialGeneration;
+	}
+
+	// Geometry is shared by every instance of the same glTF mesh
+	std::vector<MeshGeometryHandle> geometry;
+	geometry.reserve(result.meshes.size());
+
+	std::size_t uniqueGeometryBytes = 0;
+	for (MeshData& meshData : result.meshes)
+	{
+		uniqueGeometryBytes += meshData.GetVertexBufferSize() + meshData.GetIndexBufferSize();
+		geometry.push_back(MakeMeshGeometry(std::move(meshData)));
 	}
 
-	// Create ImportedMesh for each primitive
-	m_meshes.reserve(m_meshes.size() + result.meshes.size());
-	for (std::size_t i = 0; i < result.meshes.size(); ++i)
+	// Create an ImportedMesh for each node placement
+	std::vector<std::unique_ptr<Mesh>> meshes;
+	meshes.reserve(result.instances.size());
+	for (const GltfLoader::MeshInstance& instance : result.instances)
 	{
-		auto mesh = std::make_unique<ImportedMesh>(std::move(result.meshes[i]), result.transforms[i]);
+		auto mesh = std::make_unique<ImportedMesh>(geometry[instance.meshIndex], instance.transform);
 
 		// Map glTF material index to scene-level material
-		if (i < result.materialIndices.size())
+		if (instance.meshIndex < result.materialIndices.size())
 		{
-			mesh->SetMaterialId(static_cast<uint32_t>(materialOffset) + result.materialIndices[i]);
+			mesh->SetMaterialId(static_cast<uint32_t>(materialOffset) + result.materialIndices[instance.meshIndex]);
 		}
 
-		m_meshes.push_back(std::move(mesh));
+		meshes.push_back(std::move(mesh));
 	}
 
+	// Attaches transforms and bumps the mesh-list generation
+	AddMeshes(std::move(meshes));
+
+	// Each Mesh used to own its MeshData twice (imported copy + generated
+	// copy); now every instance points at one shared copy.
+	std::size_t perMeshCopyBytes = 0;
+	for (const GltfLoader::MeshInstance& instance : result.instances)
+	{
+		const MeshData& meshData = *geometry[instance.meshIndex];
+		perMeshCopyBytes += 2 * (meshData.GetVertexBufferSize() + meshData.GetIndexBufferSize());
+	}
+
+	constexpr double kBytesToMB = 1.0 / (1024.0 * 1024.0);
+	LOG_INFO(
+	    std::format(
+	        "Scene: Imported geometry {:.1f} MB resident ({:.1f} MB with per-mesh copies, {:.1f} MB saved)",
+	        static_cast<double>(uniqueGeometryBytes) * kBytesToMB,
+	        static_cast<double>(perMeshCopyBytes) * kBytesToMB,
+	        static_cast<double>(perMeshCopyBytes - uniqueGeometryBytes) * kBytesToMB));
+
 	LOG_INFO("Scene: Loaded " + std::to_string(m_meshes.size()) + " meshes, " + std::to_string(m_loadedMaterials.size()) + " materials");
 
 	return true;
@@ -157,8 +224,11 @@ bool Scene::AppendGltf(const std::filesystem::path& filePath)
 void Scene::AddMeshes(std::vector<std::unique_ptr<Mesh>> meshes)
 {
 	m_meshes.reserve(m_meshes.size() + meshes.size());
+	m_transforms.Reserve(m_transforms.GetCount() + static_cast<uint32>(meshes.size()));
 	for (auto& mesh : meshes)
 	{
+		mesh->AttachTransform(m_transforms);
 		m_meshes.push_back(std::move(mesh));
 	}
+	++m_meshListGeneration;
 }
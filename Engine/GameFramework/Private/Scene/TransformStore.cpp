@@ -0,0 +1,276 @@
+#include "PCH.h"
+#include "Scene/TransformStore.h"
+
+#include <bit>
+
+using namespace DirectX;
+
+// =============================================================================
+// Allocation
+// =============================================================================
+
+TransformHandle TransformStore::AllocateSlot()
+{
+	const uint32 denseIndex = GetCount();
+
+	uint32 slot;
+	if (!m_freeSlots.empty())
+	{
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = static_cast<uint32>(m_slotToDense.size());
+		m_slotToDense.push_back(0);
+		m_slotGenerations.push_back(0);
+	}
+	m_slotToDense[slot] = denseIndex;
+	m_denseToSlot.push_back(slot);
+
+	if ((denseIndex >> 6) >= m_dirtyBits.size())
+	{
+		m_dirtyBits.push_back(0);
+	}
+
+	return TransformHandle{slot, m_slotGenerations[slot]};
+}
+
+TransformHandle TransformStore::Allocate(const XMFLOAT3& translation, const XMFLOAT3& rotationEuler, const XMFLOAT3& scale)
+{
+	const TransformHandle handle = AllocateSlot();
+
+	m_translations.push_back(translation);
+	m_rotations.push_back(rotationEuler);
+	m_scales.push_back(scale);
+	m_worlds.emplace_back();
+	m_worldInvTransposes.emplace_back();
+	m_bExplicitWorld.push_back(0);
+
+	MarkDirty(GetCount() - 1);
+	return handle;
+}
+
+TransformHandle TransformStore::AllocateExplicit(const XMFLOAT4X4& world)
+{
+	const TransformHandle handle = AllocateSlot();
+
+	m_translations.push_back({0.0f, 0.0f, 0.0f});
+	m_rotations.push_back({0.0f, 0.0f, 0.0f});
+	m_scales.push_back({1.0f, 1.0f, 1.0f});
+	m_worlds.push_back(world);
+	m_worldInvTransposes.emplace_back();
+	m_bExplicitWorld.push_back(1);
+
+	MarkDirty(GetCount() - 1);
+	return handle;
+}
+
+void TransformStore::Release(TransformHandle handle) noexcept
+{
+	if (!IsValid(handle))
+		return;
+
+	const uint32 dense = m_slotToDense[handle.index];
+	const uint32 last = GetCount() - 1;
+	const bool bLastDirty = IsDenseDirty(last);
+
+	// Swap-remove: move the last entry into the hole to keep arrays packed
+	if (dense != last)
+	{
+		m_translations[dense] = m_translations[last];
+		m_rotations[dense] = m_rotations[last];
+		m_scales[dense] = m_scales[last];
+		m_worlds[dense] = m_worlds[last];
+		m_worldInvTransposes[dense] = m_worldInvTransposes[last];
+		m_bExplicitWorld[dense] = m_bExplicitWorld[last];
+
+		const uint32 movedSlot = m_denseToSlot[last];
+		m_denseToSlot[dense] = movedSlot;
+		m_slotToDense[movedSlot] = dense;
+
+		ClearDirty(dense);
+		if (bLastDirty)
+		{
+			MarkDirty(dense);
+		}
+	}
+	ClearDirty(last);
+
+	m_translations.pop_back();
+	m_rotations.pop_back();
+	m_scales.pop_back();
+	m_worlds.pop_back();
+	m_worldInvTransposes.pop_back();
+	m_bExplicitWorld.pop_back();
+	m_denseToSlot.pop_back();
+
+	++m_slotGenerations[handle.index];
+	m_freeSlots.push_back(handle.index);
+}
+
+void TransformStore::Reserve(uint32 count)
+{
+	m_translations.reserve(count);
+	m_rotations.reserve(count);
+	m_scales.reserve(count);
+	m_worlds.reserve(count);
+	m_worldInvTransposes.reserve(count);
+	m_bExplicitWorld.reserve(count);
+	m_denseToSlot.reserve(count);
+	m_slotToDense.reserve(count);
+	m_slotGenerations.reserve(count);
+	m_dirtyBits.reserve((count + 63) / 64);
+}
+
+void TransformStore::Clear() noexcept
+{
+	// Bump every generation so handles from before the clear stay invalid
+	m_freeSlots.clear();
+	for (uint32 slot = 0; slot < m_slotGenerations.size(); ++slot)
+	{
+		++m_slotGenerations[slot];
+		m_freeSlots.push_back(slot);
+	}
+
+	m_translations.clear();
+	m_rotations.clear();
+	m_scales.clear();
+	m_worlds.clear();
+	m_worldInvTransposes.clear();
+	m_bExplicitWorld.clear();
+	m_denseToSlot.clear();
+	m_dirtyBits.clear();
+	m_dirtyCount = 0;
+	m_lastUpdated.clear();
+}
+
+bool TransformStore::IsValid(TransformHandle handle) const noexcept
+{
+	return handle.index < m_slotGenerations.size() && m_slotGenerations[handle.index] == handle.generation &&
+	       m_slotToDense[handle.index] < GetCount() && m_denseToSlot[m_slotToDense[handle.index]] == handle.index;
+}
+
+// =============================================================================
+// Mutation
+// =============================================================================
+
+void TransformStore::SetTranslation(TransformHandle handle, const XMFLOAT3& translation) noexcept
+{
+	const uint32 dense = GetDenseIndex(handle);
+	m_translations[dense] = translation;
+	MarkDirty(dense);
+}
+
+void TransformStore::SetRotationEuler(TransformHandle handle, const XMFLOAT3& rotationEuler) noexcept
+{
+	const uint32 dense = GetDenseIndex(handle);
+	m_rotations[dense] = rotationEuler;
+	MarkDirty(dense);
+}
+
+void TransformStore::SetScale(TransformHandle handle, const XMFLOAT3& scale) noexcept
+{
+	const uint32 dense = GetDenseIndex(handle);
+	m_scales[dense] = scale;
+	MarkDirty(dense);
+}
+
+void TransformStore::SetWorldMatrix(TransformHandle handle, const XMFLOAT4X4& world) noexcept
+{
+	const uint32 dense = GetDenseIndex(handle);
+	m_worlds[dense] = world;
+	m_bExplicitWorld[dense] = 1;
+	MarkDirty(dense);
+}
+
+uint32 TransformStore::UpdateDirty()
+{
+	m_lastUpdated.clear();
+	if (m_dirtyCount == 0)
+		return 0;
+
+	uint32 recomputed = 0;
+	for (std::size_t word = 0; word < m_dirtyBits.size(); ++word)
+	{
+		uint64 bits = m_dirtyBits[word];
+		while (bits != 0)
+		{
+			const uint32 dense = static_cast<uint32>(word * 64) + static_cast<uint32>(std::countr_zero(bits));
+			Recompute(dense);
+			m_lastUpdated.push_back(dense);
+			bits &= bits - 1;
+			++recomputed;
+		}
+		m_dirtyBits[word] = 0;
+	}
+
+	m_dirtyCount = 0;
+	return recomputed;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+bool TransformStore::IsDirty(TransformHandle handle) const noexcept
+{
+	return IsDenseDirty(GetDenseIndex(handle));
+}
+
+XMMATRIX TransformStore::GetWorldMatrix(TransformHandle handle) const noexcept
+{
+	const uint32 dense = GetDenseIndex(handle);
+	return IsDenseDirty(dense) ? ComputeWorld(dense) : XMLoadFloat4x4(&m_worlds[dense]);
+}
+
+// =============================================================================
+// Internals
+// =============================================================================
+
+void TransformStore::MarkDirty(uint32 denseIndex) noexcept
+{
+	uint64& word = m_dirtyBits[denseIndex >> 6];
+	const uint64 mask = uint64{1} << (denseIndex & 63);
+	if ((word & mask) == 0)
+	{
+		word |= mask;
+		++m_dirtyCount;
+	}
+}
+
+void TransformStore::ClearDirty(uint32 denseIndex) noexcept
+{
+	uint64& word = m_dirtyBits[denseIndex >> 6];
+	const uint64 mask = uint64{1} << (denseIndex & 63);
+	if ((word & mask) != 0)
+	{
+		word &= ~mask;
+		--m_dirtyCount;
+	}
+}
+
+bool TransformStore::IsDenseDirty(uint32 denseIndex) const noexcept
+{
+	return (m_dirtyBits[denseIndex >> 6] >> (denseIndex & 63)) & 1u;
+}
+
+XMMATRIX TransformStore::ComputeWorld(uint32 denseIndex) const noexcept
+{
+	if (m_bExplicitWorld[denseIndex])
+	{
+		return XMLoadFloat4x4(&m_worlds[denseIndex]);
+	}
+
+	const XMFLOAT3& s = m_scales[denseIndex];
+	const XMFLOAT3& r = m_rotations[denseIndex];
+	const XMFLOAT3& t = m_translations[denseIndex];
+	return XMMatrixScaling(s.x, s.y, s.z) * XMMatrixRotationRollPitchYaw(r.x, r.y, r.z) * XMMatrixTranslation(t.x, t.y, t.z);
+}
+
+void TransformStore::Recompute(uint32 denseIndex) noexcept
+{
+	const XMMATRIX world = ComputeWorld(denseIndex);
+	XMStoreFloat4x4(&m_worlds[denseIndex], world);
+	XMStoreFloat3x4(&m_worldInvTransposes[denseIndex], XMMatrixTranspose(XMMatrixInverse(nullptr, world)));
+}
@@ -84,6 +84,7 @@ class SPARKLE_ENGINE_API AssetSystem final
 	// =========================================================================
 
 	[[nodiscard]] const std::filesystem::path& GetShaderSymbolsOutputPath() const noexcept { return m_shaderSymbolsOutputPath; }
+	[[nodiscard]] const std::filesystem::path& GetMeshCacheOutputPath() const noexcept { return m_meshCacheOutputPath; }
 
 	// =========================================================================
 	// Queries
@@ -119,6 +120,7 @@ class SPARKLE_ENGINE_API AssetSystem final
 
 	// Output directories
 	std::filesystem::path m_shaderSymbolsOutputPath;
+	std::filesystem::path m_meshCacheOutputPath;
 
 	inline static const std::filesystem::path s_emptyPath{};
 };
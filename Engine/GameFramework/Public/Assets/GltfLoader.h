@@ -16,9 +16,16 @@
 // DESIGN:
 //   - Static loader (no instance state needed)
 //   - Returns a self-contained LoadResult with all data
-//   - Each glTF primitive becomes one MeshData
-//   - Transforms are pre-computed to world space per node hierarchy
+//   - Each unique glTF primitive becomes one MeshData, extracted once even
+//     when several nodes reference its mesh
+//   - Every (node, primitive) pair becomes a MeshInstance that references a
+//     MeshData by index and carries its world transform
+//   - World transforms are evaluated top-down in a single pass
 //   - Materials map 1:1 to glTF PBR metallic-roughness workflow
+//   - Primitive extraction runs across a worker pool (LoadOptions::workerCount);
+//     output order is identical to the serial path
+//   - Buffer files (.bin / .glb) are memory-mapped by default and accessors are
+//     decoded straight from the mapped pages (no heap copy of the file)
 //
 // NOTES:
 //   - Uses cgltf for parsing (header-only, C99)
@@ -49,33 +56,72 @@ class SPARKLE_ENGINE_API GltfLoader final
 	// Load Result
 	// =========================================================================
 
+	/// Timings for one Load call, all relative to its start.
+	struct LoadStats
+	{
+		double parseMs = 0.0;            // JSON / GLB header parsed
+		double buffersMs = 0.0;          // Buffer data available
+		double timeToFirstMeshMs = 0.0;  // First primitive fully extracted
+		double totalMs = 0.0;            // Load returned
+		std::size_t mappedBytes = 0;     // Bytes served from memory-mapped files
+	};
+
+	/// One placement of a mesh in the scene (a node referencing a primitive).
+	struct MeshInstance
+	{
+		std::uint32_t meshIndex = 0;    // Into LoadResult::meshes
+		DirectX::XMFLOAT4X4 transform;  // World transform of the referencing node
+	};
+
 	/// Self-contained result from loading a glTF file.
 	/// Owns all loaded data — caller takes ownership via move.
 	struct LoadResult
 	{
-		std::vector<MeshData> meshes;                 // One per glTF primitive
-		std::vector<MaterialDesc> materials;          // One per glTF material
-		std::vector<std::string> texturePaths;        // Unique texture file paths
-		std::vector<DirectX::XMFLOAT4X4> transforms;  // World transform per mesh
-		std::vector<std::uint32_t> materialIndices;   // Material index per mesh (into materials[])
+		std::vector<MeshData> meshes;                    // One per unique glTF primitive
+		std::vector<MaterialDesc> materials;             // One per glTF material
+		std::vector<std::string> texturePaths;           // Unique texture file paths
+		std::vector<std::uint32_t> materialIndices;      // Material index per mesh (into materials[])
+		std::vector<MeshInstance> instances;             // One per (node, primitive) placement
+		std::vector<std::filesystem::path> sourceFiles;  // glTF file + external buffers read (cache validation)
+
+		LoadStats stats;
 
 		bool bSuccess = false;
 		std::string errorMessage;
 
 		[[nodiscard]] bool IsValid() const noexcept { return bSuccess && !meshes.empty(); }
 		[[nodiscard]] std::size_t GetMeshCount() const noexcept { return meshes.size(); }
+		[[nodiscard]] std::size_t GetInstanceCount() const noexcept { return instances.size(); }
 		[[nodiscard]] std::size_t GetMaterialCount() const noexcept { return materials.size(); }
 	};
 
+	// =========================================================================
+	// Load Options
+	// =========================================================================
+
+	struct LoadOptions
+	{
+		/// Threads used to extract primitives once buffers are loaded.
+		/// 0 = one per hardware thread, 1 = serial on the calling thread.
+		std::uint32_t workerCount = 0;
+
+		/// Map .gltf/.glb/.bin files instead of reading them into heap memory.
+		/// Falls back to a regular read for any file that cannot be mapped.
+		bool bMemoryMapBuffers = true;
+	};
+
 	// =========================================================================
 	// Public API
 	// =========================================================================
 
 	/// Loads a glTF or GLB file from an absolute path.
 	/// @param filePath Absolute filesystem path to the .gltf or .glb file
-	/// @return LoadResult containing all meshes, materials, and transforms
+	/// @return LoadResult containing all meshes, instances, and materials
 	[[nodiscard]] static LoadResult Load(const std::filesystem::path& filePath);
 
+	/// Same as Load(filePath) with explicit extraction settings.
+	[[nodiscard]] static LoadResult Load(const std::filesystem::path& filePath, const LoadOptions& options);
+
 	// Static utility — no instantiation
 	GltfLoader() = delete;
 	~GltfLoader() = delete;
@@ -0,0 +1,74 @@
+// =============================================================================
+// MeshCache.h — Cooked binary mesh cache (.smesh)
+// =============================================================================
+//
+// Stores the final output of an import (vertex/index blobs, material
+// indices, instances, materials, texture paths) in a flat binary file so later
+// loads skip JSON parsing and primitive extraction entirely.
+//
+// USAGE:
+//   const auto cachePath = MeshCache::GetCachePath(cacheDir, gltfPath);
+//   GltfLoader::LoadResult result;
+//   if (!MeshCache::TryLoad(cachePath, gltfPath, result))
+//   {
+//       result = GltfLoader::Load(gltfPath);
+//       MeshCache::Write(cachePath, gltfPath, result);
+//   }
+//
+// DESIGN:
+//   - One .smesh per source asset, named after its AssetId
+//   - Keyed by AssetId + source file size and mtime; the source is only
+//     hashed (HashBytes64) when its mtime moved, and a touched but unchanged
+//     source stays cached with its stored mtime refreshed. External buffer
+//     files the import read are validated by size and mtime
+//   - Loading memory-maps the file; vertex/index blobs are 16-byte aligned
+//     and bulk-copied into each MeshData (one copy per array, no parsing).
+//     The mapping is closed when TryLoad returns, nothing points into it
+//   - The cold import time is stored so cached loads can log both
+//   - Any mismatch (version, key, truncated file) is a cache miss, never an error
+//
+// FILE LAYOUT:
+//   Header | MeshRecord[] | InstanceRecord[] | MaterialRecord[] | StringRef[] (textures)
+//          | DependencyRecord[] | string blob | vertex blob | index blob
+//
+// =============================================================================
+
+#pragma once
+
+#include "GameFramework/Public/GameFrameworkAPI.h"
+#include "GameFramework/Public/Assets/GltfLoader.h"
+
+#include <filesystem>
+
+// =============================================================================
+// MeshCache
+// =============================================================================
+
+class SPARKLE_ENGINE_API MeshCache final
+{
+  public:
+	static constexpr const char* kFileExtension = ".smesh";
+
+	/// Location of the cooked file for a source asset inside cacheDirectory.
+	[[nodiscard]] static std::filesystem::path GetCachePath(
+	    const std::filesystem::path& cacheDirectory,
+	    const std::filesystem::path& sourcePath);
+
+	/// Loads a cooked file if it exists and is still valid for sourcePath.
+	/// @return false on any miss (missing, stale, corrupt); outResult untouched
+	[[nodiscard]] static bool TryLoad(
+	    const std::filesystem::path& cachePath,
+	    const std::filesystem::path& sourcePath,
+	    GltfLoader::LoadResult& outResult);
+
+	/// Writes a cooked file for a successful import. Written to a temporary
+	/// file first and renamed, so a crash never leaves a partial cache behind.
+	static bool Write(
+	    const std::filesystem::path& cachePath,
+	    const std::filesystem::path& sourcePath,
+	    const GltfLoader::LoadResult& result);
+
+	// Static utility — no instantiation
+	MeshCache() = delete;
+	~MeshCache() = delete;
+};
@@ -7,14 +7,17 @@
 // geometry is not generated — it is supplied at construction time.
 //
 // USAGE:
-//   auto mesh = std::make_unique<ImportedMesh>(std::move(meshData), worldTransform);
+//   MeshGeometryHandle geometry = MakeMeshGeometry(std::move(meshData));
+//   auto mesh = std::make_unique<ImportedMesh>(geometry, worldTransform);
 //   mesh->SetMaterialId(materialIndex);
 //
 // DESIGN:
-//   - Owns a copy of the CPU mesh data (moved in at construction)
-//   - Stores a raw XMFLOAT4X4 world transform (from glTF node hierarchy)
-//   - Overrides GetWorldMatrix/GetWorldInverseTransposeMatrix for custom transform
-//   - GenerateGeometry() copies stored data (no procedural generation)
+//   - Shares immutable CPU mesh data with every other instance of the same
+//     glTF mesh (one MeshData per unique primitive)
+//   - Uses the node's XMFLOAT4X4 world transform as an explicit world matrix
+//     (see Mesh::SetExplicitWorldMatrix) instead of TRS
+//   - CreateGeometry() returns the shared handle — the base Mesh points at
+//     the same MeshData, so imported geometry is never copied
 //
 // =============================================================================
 
@@ -36,32 +39,28 @@ class SPARKLE_ENGINE_API ImportedMesh final : public Mesh
 	// Lifecycle
 	// -------------------------------------------------------------------------
 
-	/// Constructs an imported mesh from pre-built data and a world transform.
-	ImportedMesh(MeshData&& meshData, const DirectX::XMFLOAT4X4& worldTransform) noexcept;
+	/// Constructs an imported mesh instance from shared data and a world transform.
+	ImportedMesh(MeshGeometryHandle meshData, const DirectX::XMFLOAT4X4& worldTransform) noexcept;
 
 	~ImportedMesh() override = default;
 
 	ImportedMesh(const ImportedMesh&) = delete;
 	ImportedMesh& operator=(const ImportedMesh&) = delete;
-	ImportedMesh(ImportedMesh&&) noexcept = default;
-	ImportedMesh& operator=(ImportedMesh&&) noexcept = default;
-
-	// -------------------------------------------------------------------------
-	// World Matrix Override
-	// -------------------------------------------------------------------------
-
-	[[nodiscard]] DirectX::XMMATRIX GetWorldMatrix() const noexcept override;
-	[[nodiscard]] DirectX::XMMATRIX GetWorldInverseTransposeMatrix() const noexcept override;
+	ImportedMesh(ImportedMesh&&) = delete;
+	ImportedMesh& operator=(ImportedMesh&&) = delete;
 
   protected:
 	// -------------------------------------------------------------------------
 	// NVI: Geometry Generation
 	// -------------------------------------------------------------------------
 
-	/// Copies stored mesh data (no procedural generation).
+	/// Returns the shared imported data (no copy, no generation).
+	[[nodiscard]] MeshGeometryHandle CreateGeometry() const override;
+
+	/// Copies stored mesh data. Only reached if a caller explicitly asks
+	/// for a private copy; the normal path is CreateGeometry().
 	void GenerateGeometry(MeshData& outMeshData) const override;
 
   private:
-	MeshData m_importedData;
-	DirectX::XMFLOAT4X4 m_worldTransform;
+	MeshGeometryHandle m_importedData;
 };
@@ -2,8 +2,10 @@
 // Mesh.h — CPU-side renderable mesh with transform and geometry
 // =============================================================================
 //
-// Base class for primitives and imported meshes. Owns transform (TRS) and
-// CPU geometry (MeshData). GPU resources are managed by Renderer's GPUMesh.
+// Base class for primitives and imported meshes. Holds its authored
+// transform (TRS or an explicit world matrix), an entry in the scene's
+// TransformStore and a shared handle to immutable CPU geometry (MeshData).
+// GPU resources are managed by Renderer's GPUMesh.
 //
 // USAGE:
 //   class MyMesh : public Mesh {
@@ -17,6 +19,15 @@
 //   - No D3D12 or GPU dependencies — pure CPU data
 //   - Geometry is built lazily via RebuildGeometry() or on first access
 //   - Derived classes implement GenerateGeometry() for shape-specific data
+//   - Geometry is held through a MeshGeometryHandle; meshes that already own
+//     shared data (ImportedMesh) override CreateGeometry() to hand it out
+//     without copying
+//   - Procedural primitives return a GetGeometryKey(); identical keys resolve
+//     to one shared MeshData through PrimitiveGeometryCache
+//   - World matrices live in a TransformStore (SoA) once the mesh is attached
+//     (Scene::AddMeshes does this). Setters write through and mark the entry
+//     dirty; the store recomputes dirty entries in one batch per frame.
+//     Detached meshes compute their world matrix on demand.
 //
 // =============================================================================
 
@@ -24,8 +35,11 @@
 
 #include "GameFramework/Public/GameFrameworkAPI.h"
 #include "MeshData.h"
+#include "PrimitiveGeometryCache.h"
+#include "TransformStore.h"
 
 #include <DirectXMath.h>
+#include <optional>
 
 // =============================================================================
 // Mesh
@@ -43,12 +57,13 @@ class SPARKLE_ENGINE_API Mesh
 	    const DirectX::XMFLOAT3& rotation = {0.0f, 0.0f, 0.0f},
 	    const DirectX::XMFLOAT3& scale = {1.0f, 1.0f, 1.0f}) noexcept;
 
-	virtual ~Mesh() = default;
+	virtual ~Mesh();
 
+	// Non-movable: the TransformStore entry is released by the owning object
 	Mesh(const Mesh&) = delete;
 	Mesh& operator=(const Mesh&) = delete;
-	Mesh(Mesh&&) noexcept = default;
-	Mesh& operator=(Mesh&&) noexcept = default;
+	Mesh(Mesh&&) = delete;
+	Mesh& operator=(Mesh&&) = delete;
 
 	// -------------------------------------------------------------------------
 	// Transform
@@ -63,25 +78,34 @@ class SPARKLE_ENGINE_API Mesh
 	void SetScale(const DirectX::XMFLOAT3& s) noexcept;
 	[[nodiscard]] DirectX::XMFLOAT3 GetScale() const noexcept { return m_scale; }
 
+	/// Registers the transform in store. The store must outlive the mesh.
+	void AttachTransform(TransformStore& store);
+
+	[[nodiscard]] TransformHandle GetTransformHandle() const noexcept { return m_transformHandle; }
+	[[nodiscard]] bool HasTransformHandle() const noexcept { return m_transformStore != nullptr; }
+
 	// -------------------------------------------------------------------------
 	// World Matrix
 	// -------------------------------------------------------------------------
 
-	[[nodiscard]] virtual DirectX::XMMATRIX GetWorldMatrix() const noexcept;
-	[[nodiscard]] virtual DirectX::XMMATRIX GetWorldInverseTransposeMatrix() const noexcept;
+	[[nodiscard]] DirectX::XMMATRIX GetWorldMatrix() const noexcept;
+	[[nodiscard]] DirectX::XMMATRIX GetWorldInverseTransposeMatrix() const noexcept;
 	[[nodiscard]] DirectX::XMFLOAT3X3 GetWorldRotationMatrix3x3() const noexcept;
 
 	// -------------------------------------------------------------------------
 	// Geometry
 	// -------------------------------------------------------------------------
 
-	// Rebuilds internal MeshData by calling GenerateGeometry()
+	// Rebuilds internal geometry by calling CreateGeometry()
 	void RebuildGeometry();
 
 	// Returns CPU mesh data. Builds geometry on first call if not yet built.
 	[[nodiscard]] const MeshData& GetMeshData() const;
 
-	[[nodiscard]] uint32 GetIndexCount() const noexcept { return m_meshData.GetIndexCount(); }
+	// Returns the shared geometry handle. Builds geometry on first call.
+	[[nodiscard]] const MeshGeometryHandle& GetGeometry() const;
+
+	[[nodiscard]] uint32 GetIndexCount() const noexcept { return m_geometry ? m_geometry->GetIndexCount() : 0; }
 
 	// -------------------------------------------------------------------------
 	// Material
@@ -98,10 +122,20 @@ class SPARKLE_ENGINE_API Mesh
 	// Override in derived classes to populate mesh geometry
 	virtual void GenerateGeometry(MeshData& outMeshData) const = 0;
 
-	void InvalidateWorldCache() noexcept { m_bWorldDirty = true; }
+	// Produces the geometry handle. Default resolves GetGeometryKey() through
+	// PrimitiveGeometryCache, or wraps GenerateGeometry() output when there is
+	// no key; override to return already-shared data without a copy.
+	[[nodiscard]] virtual MeshGeometryHandle CreateGeometry() const;
+
+	// Identifies geometry that is fully determined by shape + tessellation.
+	// Meshes returning a key share one MeshData with every identical mesh.
+	[[nodiscard]] virtual std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept { return std::nullopt; }
+
+	// Replaces TRS with an authored world matrix (e.g. glTF node transforms)
+	void SetExplicitWorldMatrix(const DirectX::XMFLOAT4X4& world) noexcept;
 
   private:
-	void RebuildWorldIfNeeded() const noexcept;
+	[[nodiscard]] DirectX::XMMATRIX ComputeWorldMatrix() const noexcept;
 
 	// -------------------------------------------------------------------------
 	// Transform
@@ -110,15 +144,16 @@ class SPARKLE_ENGINE_API Mesh
 	DirectX::XMFLOAT3 m_translation{0.0f, 0.0f, 0.0f};
 	DirectX::XMFLOAT3 m_rotationEuler{0.0f, 0.0f, 0.0f};
 	DirectX::XMFLOAT3 m_scale{1.0f, 1.0f, 1.0f};
+	std::optional<DirectX::XMFLOAT4X4> m_explicitWorld;
 
-	mutable DirectX::XMFLOAT4X4 m_worldMatrixCache{};
-	mutable bool m_bWorldDirty = true;
+	TransformStore* m_transformStore = nullptr;
+	TransformHandle m_transformHandle;
 
 	// -------------------------------------------------------------------------
 	// Geometry
 	// -------------------------------------------------------------------------
 
-	mutable MeshData m_meshData;
+	mutable MeshGeometryHandle m_geometry;
 	mutable bool m_bGeometryDirty = true;
 
 	// -------------------------------------------------------------------------
@@ -6,8 +6,12 @@
 
 #include "GameFramework/Public/GameFrameworkAPI.h"
 #include "Core/Public/CoreTypes.h"
+#include "Core/Public/Hash/HashUtils.h"
 
 #include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <vector>
 
 // =============================================================================
@@ -40,6 +44,21 @@ struct VertexData
 
 static_assert(std::is_trivially_copyable_v<VertexData>, "VertexData must be trivially copyable for GPU upload");
 
+// =============================================================================
+// MeshBounds
+// =============================================================================
+
+// Local-space bounds of a mesh's vertex positions. The sphere is centered on
+// the AABB center with the radius of the farthest vertex (tighter than the
+// half-diagonal for round shapes).
+struct MeshBounds
+{
+	DirectX::XMFLOAT3 aabbMin = {0.0f, 0.0f, 0.0f};
+	DirectX::XMFLOAT3 aabbMax = {0.0f, 0.0f, 0.0f};
+	DirectX::XMFLOAT3 sphereCenter = {0.0f, 0.0f, 0.0f};
+	float sphereRadius = 0.0f;
+};
+
 // =============================================================================
 // MeshData
 // =============================================================================
@@ -50,6 +69,8 @@ struct MeshData
 {
 	std::vector<VertexData> vertices;
 	std::vector<uint32> indices;
+	MeshBounds bounds;        // Filled by ComputeBounds() (MakeMeshGeometry calls it)
+	uint64 contentHash = 0;  // Filled by ComputeContentHash() (MakeMeshGeometry calls it)
 
 	// -------------------------------------------------------------------------
 	// Validation
@@ -84,6 +105,46 @@ struct MeshData
 		indices.clear();
 	}
 
+	// Recomputes local bounds from vertex positions
+	void ComputeBounds() noexcept
+	{
+		bounds = {};
+		if (vertices.empty())
+			return;
+
+		DirectX::XMFLOAT3 lo = vertices[0].position;
+		DirectX::XMFLOAT3 hi = vertices[0].position;
+		for (const VertexData& v : vertices)
+		{
+			lo = {std::min(lo.x, v.position.x), std::min(lo.y, v.position.y), std::min(lo.z, v.position.z)};
+			hi = {std::max(hi.x, v.position.x), std::max(hi.y, v.position.y), std::max(hi.z, v.position.z)};
+		}
+
+		const DirectX::XMFLOAT3 c{(lo.x + hi.x) * 0.5f, (lo.y + hi.y) * 0.5f, (lo.z + hi.z) * 0.5f};
+		float maxDistSq = 0.0f;
+		for (const VertexData& v : vertices)
+		{
+			const float dx = v.position.x - c.x;
+			const float dy = v.position.y - c.y;
+			const float dz = v.position.z - c.z;
+			maxDistSq = std::max(maxDistSq, dx * dx + dy * dy + dz * dz);
+		}
+
+		bounds.aabbMin = lo;
+		bounds.aabbMax = hi;
+		bounds.sphereCenter = c;
+		bounds.sphereRadius = std::sqrt(maxDistSq);
+	}
+
+	// Hashes the vertex and index data. Equal geometry built by different loads
+	// (a level reloaded, an asset shared by two levels) gets the same hash, so
+	// GPU caches can key on content instead of object identity.
+	void ComputeContentHash() noexcept
+	{
+		const uint64 vertexHash = Engine::Hash::HashBytes64(vertices.data(), GetVertexBufferSize());
+		contentHash = Engine::Hash::HashBytes64(indices.data(), GetIndexBufferSize(), vertexHash);
+	}
+
 	// Pre-allocates storage to avoid reallocations during mesh building
 	void Reserve(uint32 vertexCount, uint32 indexCount)
 	{
@@ -91,3 +152,20 @@ struct MeshData
 		indices.reserve(indexCount);
 	}
 };
+
+// =============================================================================
+// MeshGeometryHandle
+// =============================================================================
+
+// Shared, immutable CPU geometry. Copying a handle only bumps a reference
+// count, so any number of meshes (glTF instances, identical primitives) can
+// point at one MeshData. Never mutate through a handle — build a new one.
+using MeshGeometryHandle = std::shared_ptr<const MeshData>;
+
+// Computes bounds and content hash once, then freezes the data behind a shared handle.
+[[nodiscard]] inline MeshGeometryHandle MakeMeshGeometry(MeshData&& meshData)
+{
+	meshData.ComputeBounds();
+	meshData.ComputeContentHash();
+	return std::make_shared<const MeshData>(std::move(meshData));
+}
@@ -0,0 +1,73 @@
+// =============================================================================
+// PrimitiveGeometryCache.h — Shared geometry for procedural primitives
+// =============================================================================
+//
+// Procedural primitives of the same shape and tessellation produce identical
+// vertex/index data. This cache generates it once and hands every instance
+// the same MeshGeometryHandle, so a cluster of N boxes holds one MeshData on
+// the CPU and (because GPUMeshCache keys by geometry content) one GPUMesh on
+// the GPU.
+//
+// USAGE:
+//   const PrimitiveGeometryKey key{MeshFactory::Shape::Sphere, 16, 16};
+//   MeshGeometryHandle geometry = PrimitiveGeometryCache::GetOrCreate(key,
+//       [](MeshData& out) { /* generate */ });
+//
+// DESIGN:
+//   - Entries are weak: geometry lives as long as at least one mesh uses it,
+//     so unloading a level frees it without an explicit clear
+//   - Thread-safe; geometry is generated under the lock, so concurrent
+//     requests for the same key never build it twice
+//
+// =============================================================================
+
+#pragma once
+
+#include "GameFramework/Public/GameFrameworkAPI.h"
+#include "GameFramework/Public/Scene/MeshData.h"
+#include "GameFramework/Public/Scene/MeshFactory.h"
+
+#include <functional>
+
+// =============================================================================
+// PrimitiveGeometryKey
+// =============================================================================
+
+/// Identifies one generated primitive shape. Tessellation fields are
+/// shape-specific segment counts (unused fields stay 0).
+struct PrimitiveGeometryKey
+{
+	MeshFactory::Shape shape = MeshFactory::Shape::Box;
+	uint32 tessellationU = 0;
+	uint32 tessellationV = 0;
+	uint32 tessellationW = 0;
+
+	[[nodiscard]] bool operator==(const PrimitiveGeometryKey&) const noexcept = default;
+};
+
+// =============================================================================
+// PrimitiveGeometryCache
+// =============================================================================
+
+class SPARKLE_ENGINE_API PrimitiveGeometryCache final
+{
+  public:
+	using GenerateFn = std::function<void(MeshData&)>;
+
+	struct Stats
+	{
+		uint64 hits = 0;          // Requests served by existing geometry
+		uint64 misses = 0;        // Requests that generated new geometry
+		uint32 liveEntries = 0;   // Geometries currently referenced by a mesh
+		uint64 residentBytes = 0; // Vertex + index bytes held by live entries
+	};
+
+	/// Returns the shared geometry for key, calling generate on a miss.
+	[[nodiscard]] static MeshGeometryHandle GetOrCreate(const PrimitiveGeometryKey& key, const GenerateFn& generate);
+
+	[[nodiscard]] static Stats GetStats();
+
+	// Static utility — no instantiation
+	PrimitiveGeometryCache() = delete;
+	~PrimitiveGeometryCache() = delete;
+};
@@ -21,4 +21,8 @@ class SPARKLE_ENGINE_API PrimitiveBox : public Mesh
   protected:
 	// Generate the geometry data for the box.
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Box};
+	}
 };
@@ -17,6 +17,15 @@ class SPARKLE_ENGINE_API PrimitiveCapsule : public Mesh
 	    const DirectX::XMFLOAT3& rotation = {0.0f, 0.0f, 0.0f},
 	    const DirectX::XMFLOAT3& scale = {1.0f, 1.0f, 1.0f});
 
+	// Tessellation — part of the geometry cache key
+	static constexpr uint32 kLonSegments = 32;
+	static constexpr uint32 kHemiStacks = 8;
+	static constexpr uint32 kCylStacks = 4;
+
   protected:
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Capsule, kLonSegments, kHemiStacks, kCylStacks};
+	}
 };
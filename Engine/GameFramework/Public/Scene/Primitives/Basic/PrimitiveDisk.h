@@ -17,6 +17,13 @@ class SPARKLE_ENGINE_API PrimitiveDisk : public Mesh
 	    const DirectX::XMFLOAT3& rotation = {0.0f, 0.0f, 0.0f},
 	    const DirectX::XMFLOAT3& scale = {1.0f, 1.0f, 1.0f});
 
+	// Tessellation — part of the geometry cache key
+	static constexpr uint32 kSlices = 32;
+
   protected:
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Disk, kSlices};
+	}
 };
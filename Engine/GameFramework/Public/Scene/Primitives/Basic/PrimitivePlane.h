@@ -20,4 +20,8 @@ class SPARKLE_ENGINE_API PrimitivePlane : public Mesh
   protected:
 	// Generate the geometry data for the plane.
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Plane};
+	}
 };
@@ -17,7 +17,15 @@ class SPARKLE_ENGINE_API PrimitiveSphere : public Mesh
 	    const DirectX::XMFLOAT3& rotation = {0.0f, 0.0f, 0.0f},
 	    const DirectX::XMFLOAT3& scale = {1.0f, 1.0f, 1.0f});
 
+	// Tessellation — part of the geometry cache key
+	static constexpr uint32 kLatSegments = 16;
+	static constexpr uint32 kLonSegments = 16;
+
   protected:
 	// Generate the geometry data for the sphere.
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Sphere, kLatSegments, kLonSegments};
+	}
 };
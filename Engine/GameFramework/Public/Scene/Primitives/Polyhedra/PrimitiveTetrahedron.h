@@ -19,4 +19,8 @@ class SPARKLE_ENGINE_API PrimitiveTetrahedron : public Mesh
 
   protected:
 	void GenerateGeometry(MeshData& outMeshData) const override;
+	[[nodiscard]] std::optional<PrimitiveGeometryKey> GetGeometryKey() const noexcept override
+	{
+		return PrimitiveGeometryKey{MeshFactory::Shape::Tetrahedron};
+	}
 };
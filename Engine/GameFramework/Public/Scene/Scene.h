@@ -15,6 +15,11 @@
 //   - Camera and mesh data created in constructor
 //   - Scene owns its objects, external systems configure them
 //   - GPU resource upload handled externally by GPUMeshCache
+//   - Mesh transforms live in one SoA TransformStore; meshes are attached to
+//     it when added and release their entry when destroyed
+//   - Generation counters let render-side caches apply deltas: the mesh list
+//     generation changes when meshes are added/removed (or NotifyMeshesChanged
+//     is called), the material generation when materials change
 //
 // ============================================================================
 
@@ -22,6 +27,7 @@
 
 #include "GameFramework/Public/GameFrameworkAPI.h"
 #include "GameFramework/Public/Assets/MaterialDesc.h"
+#include "GameFramework/Public/Scene/TransformStore.h"
 
 #include <cstdint>
 #include <filesystem>
@@ -89,6 +95,9 @@ class SPARKLE_ENGINE_API Scene final
 	// ========================================================================
 
 	/// Takes ownership of externally-created meshes (e.g., from MeshFactory or glTF).
+	/// The only way meshes enter the scene: attaches their transforms and bumps
+	/// the mesh list generation, so appends on top of existing content are seen
+	/// by delta caches without a Clear().
 	void AddMeshes(std::vector<std::unique_ptr<Mesh>> meshes);
 
 	// ========================================================================
@@ -98,12 +107,26 @@ class SPARKLE_ENGINE_API Scene final
 	[[nodiscard]] const std::vector<std::unique_ptr<Mesh>>& GetMeshes() const noexcept { return m_meshes; }
 	[[nodiscard]] bool HasMeshes() const noexcept { return !m_meshes.empty(); }
 
+	/// Bumps the mesh list generation after editing mesh properties other than
+	/// transforms (e.g. SetMaterialId) so cached views pick the change up.
+	void NotifyMeshesChanged() noexcept { ++m_meshListGeneration; }
+
+	[[nodiscard]] uint64_t GetMeshListGeneration() const noexcept { return m_meshListGeneration; }
+	[[nodiscard]] uint64_t GetMaterialGeneration() const noexcept { return m_materialGeneration; }
+
+	/// Transforms of all meshes. Call UpdateDirty() before reading matrices.
+	[[nodiscard]] TransformStore& GetTransforms() noexcept { return m_transforms; }
+	[[nodiscard]] const TransformStore& GetTransforms() const noexcept { return m_transforms; }
+
   private:
 	void LoadMeshRequests(const LevelDesc& desc, AssetSystem& assetSystem);
 	void LoadImportedMeshRequest(const MeshRequest& request, AssetSystem& assetSystem);
 	void LoadProceduralMeshRequest(const MeshRequest& request);
 	void AppendProceduralMeshes(const PrimitiveRequest& request);
-	bool AppendGltf(const std::filesystem::path& filePath);
+	/// Appends a glTF file's meshes/materials through AddMeshes. When
+	/// cacheDirectory is set, a valid cooked .smesh is preferred over parsing
+	/// the source (see MeshCache).
+	bool AppendGltf(const std::filesystem::path& filePath, const std::filesystem::path& cacheDirectory = {});
 
 	// ------------------------------------------------------------------------
 	// Owned Objects
@@ -111,6 +134,9 @@ class SPARKLE_ENGINE_API Scene final
 
 	std::unique_ptr<GameCamera> m_camera;
 
+	// Declared before m_meshes: meshes release their entries on destruction
+	TransformStore m_transforms;
+
 	// All meshes in the scene (procedural, imported, etc.)
 	std::vector<std::unique_ptr<Mesh>> m_meshes;
 	std::vector<MaterialDesc> m_loadedMaterials;
@@ -120,4 +146,7 @@ class SPARKLE_ENGINE_API Scene final
 	// ------------------------------------------------------------------------
 
 	std::string m_currentLevelName;
+
+	uint64_t m_meshListGeneration = 0;
+	uint64_t m_materialGeneration = 0;
 };
@@ -0,0 +1,165 @@
+// =============================================================================
+// TransformStore.h — Contiguous SoA storage for object transforms
+// =============================================================================
+//
+// Holds translation / rotation / scale and the derived world and
+// world-inverse-transpose matrices of every scene object in parallel dense
+// arrays. Objects reference their entry through a stable TransformHandle.
+//
+// USAGE:
+//   TransformStore store;
+//   TransformHandle h = store.Allocate({0,0,5}, {0,0,0}, {1,1,1});
+//   store.SetTranslation(h, {1,0,5});
+//   store.UpdateDirty();                       // once per frame
+//   const auto worlds = store.GetWorldMatrices();
+//
+// DESIGN:
+//   - Dense arrays are kept packed (swap-remove on release); handles go
+//     through a slot table with generation counters, so a stale handle is
+//     detected instead of silently aliasing a new object
+//   - Setters only flip a bit in the dirty bitset; UpdateDirty() walks the
+//     bitset a word at a time and recomputes just the dirty entries, and
+//     records their dense indices (GetLastUpdated) for consumers that keep
+//     derived per-entry data, e.g. the renderer's world bounds
+//   - Entries may carry an explicit world matrix (imported nodes) instead of
+//     TRS — only the inverse transpose is derived for those
+//   - World-inverse-transpose is stored as XMFLOAT3X4 (the layout the GPU
+//     consumes) so the render walk is a straight copy
+//
+// NOTES:
+//   - Not thread-safe; owned and mutated by Scene on the game thread
+//
+// =============================================================================
+
+#pragma once
+
+#include "GameFramework/Public/GameFrameworkAPI.h"
+#include "Core/Public/CoreTypes.h"
+
+#include <DirectXMath.h>
+#include <cassert>
+#include <span>
+#include <vector>
+
+// =============================================================================
+// TransformHandle
+// =============================================================================
+
+struct TransformHandle
+{
+	static constexpr uint32 kInvalidIndex = ~0u;
+
+	uint32 index = kInvalidIndex;  // Slot index (stable for the entry's lifetime)
+	uint32 generation = 0;
+
+	[[nodiscard]] bool IsValid() const noexcept { return index != kInvalidIndex; }
+	[[nodiscard]] bool operator==(const TransformHandle&) const noexcept = default;
+};
+
+// =============================================================================
+// TransformStore
+// =============================================================================
+
+class SPARKLE_ENGINE_API TransformStore final
+{
+  public:
+	TransformStore() = default;
+	~TransformStore() = default;
+
+	TransformStore(const TransformStore&) = delete;
+	TransformStore& operator=(const TransformStore&) = delete;
+	TransformStore(TransformStore&&) noexcept = default;
+	TransformStore& operator=(TransformStore&&) noexcept = default;
+
+	// -------------------------------------------------------------------------
+	// Allocation
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] TransformHandle Allocate(
+	    const DirectX::XMFLOAT3& translation,
+	    const DirectX::XMFLOAT3& rotationEuler,
+	    const DirectX::XMFLOAT3& scale);
+
+	/// Allocates an entry driven by an explicit world matrix instead of TRS.
+	[[nodiscard]] TransformHandle AllocateExplicit(const DirectX::XMFLOAT4X4& world);
+
+	void Release(TransformHandle handle) noexcept;
+	void Reserve(uint32 count);
+	void Clear() noexcept;
+
+	[[nodiscard]] bool IsValid(TransformHandle handle) const noexcept;
+
+	// -------------------------------------------------------------------------
+	// Mutation (marks the entry dirty)
+	// -------------------------------------------------------------------------
+
+	void SetTranslation(TransformHandle handle, const DirectX::XMFLOAT3& translation) noexcept;
+	void SetRotationEuler(TransformHandle handle, const DirectX::XMFLOAT3& rotationEuler) noexcept;
+	void SetScale(TransformHandle handle, const DirectX::XMFLOAT3& scale) noexcept;
+	void SetWorldMatrix(TransformHandle handle, const DirectX::XMFLOAT4X4& world) noexcept;
+
+	/// Recomputes world matrices of all dirty entries.
+	/// @return number of entries recomputed
+	uint32 UpdateDirty();
+
+	/// Dense indices recomputed by the last UpdateDirty() call.
+	[[nodiscard]] std::span<const uint32> GetLastUpdated() const noexcept { return m_lastUpdated; }
+
+	// -------------------------------------------------------------------------
+	// Per-Entry Queries
+	// -------------------------------------------------------------------------
+
+	/// Dense array index of a live handle (valid until the next Release/Clear).
+	/// Asserts on stale or unattached handles; every per-handle setter/getter goes through here.
+	[[nodiscard]] uint32 GetDenseIndex(TransformHandle handle) const noexcept
+	{
+		assert(IsValid(handle) && "TransformStore: stale or unattached handle");
+		return m_slotToDense[handle.index];
+	}
+
+	[[nodiscard]] bool IsDirty(TransformHandle handle) const noexcept;
+
+	/// World matrix of the entry; computed on the fly if the entry is dirty.
+	[[nodiscard]] DirectX::XMMATRIX GetWorldMatrix(TransformHandle handle) const noexcept;
+
+	// -------------------------------------------------------------------------
+	// Bulk Access (dense, index with GetDenseIndex)
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] uint32 GetCount() const noexcept { return static_cast<uint32>(m_translations.size()); }
+	[[nodiscard]] uint32 GetDirtyCount() const noexcept { return m_dirtyCount; }
+
+	[[nodiscard]] std::span<const DirectX::XMFLOAT4X4> GetWorldMatrices() const noexcept { return m_worlds; }
+	[[nodiscard]] std::span<const DirectX::XMFLOAT3X4> GetWorldInverseTransposes() const noexcept { return m_worldInvTransposes; }
+
+  private:
+	TransformHandle AllocateSlot();
+	void MarkDirty(uint32 denseIndex) noexcept;
+	void ClearDirty(uint32 denseIndex) noexcept;
+	[[nodiscard]] bool IsDenseDirty(uint32 denseIndex) const noexcept;
+	[[nodiscard]] DirectX::XMMATRIX ComputeWorld(uint32 denseIndex) const noexcept;
+	void Recompute(uint32 denseIndex) noexcept;
+
+	// -------------------------------------------------------------------------
+	// Dense SoA (one element per live entry)
+	// -------------------------------------------------------------------------
+
+	std::vector<DirectX::XMFLOAT3> m_translations;
+	std::vector<DirectX::XMFLOAT3> m_rotations;  // Euler radians (pitch, yaw, roll)
+	std::vector<DirectX::XMFLOAT3> m_scales;
+	std::vector<DirectX::XMFLOAT4X4> m_worlds;
+	std::vector<DirectX::XMFLOAT3X4> m_worldInvTransposes;
+	std::vector<uint8> m_bExplicitWorld;  // 1 = m_worlds is authored, not derived from TRS
+	std::vector<uint32> m_denseToSlot;
+	std::vector<uint64> m_dirtyBits;
+	uint32 m_dirtyCount = 0;
+	std::vector<uint32> m_lastUpdated;  // Capacity reused across frames
+
+	// -------------------------------------------------------------------------
+	// Slot Table (handle -> dense index)
+	// -------------------------------------------------------------------------
+
+	std::vector<uint32> m_slotToDense;
+	std::vector<uint32> m_slotGenerations;
+	std::vector<uint32> m_freeSlots;
+};
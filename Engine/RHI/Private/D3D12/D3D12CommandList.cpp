@@ -0,0 +1,217 @@
+#include "PCH.h"
+#include "D3D12CommandList.h"
+
+// =============================================================================
+// Pipeline State
+// =============================================================================
+
+void D3D12CommandList::SetPipelineState(RHINativeObject pipelineState) noexcept
+{
+	m_cmdList->SetPipelineState(static_cast<ID3D12PipelineState*>(pipelineState.ptr));
+}
+
+void D3D12CommandList::SetRootSignature(RHINativeObject rootSignature) noexcept
+{
+	m_cmdList->SetGraphicsRootSignature(static_cast<ID3D12RootSignature*>(rootSignature.ptr));
+}
+
+// =============================================================================
+// Input Assembly
+// =============================================================================
+
+void D3D12CommandList::SetPrimitiveTopology(RHIPrimitiveTopology topology) noexcept
+{
+	D3D12_PRIMITIVE_TOPOLOGY d3dTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	switch (topology)
+	{
+		case RHIPrimitiveTopology::TriangleList:
+			d3dTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+			break;
+		case RHIPrimitiveTopology::TriangleStrip:
+			d3dTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP;
+			break;
+		case RHIPrimitiveTopology::LineList:
+			d3dTopology = D3D_PRIMITIVE_TOPOLOGY_LINELIST;
+			break;
+		case RHIPrimitiveTopology::PointList:
+			d3dTopology = D3D_PRIMITIVE_TOPOLOGY_POINTLIST;
+			break;
+	}
+	m_cmdList->IASetPrimitiveTopology(d3dTopology);
+}
+
+void D3D12CommandList::BindVertexBuffer(const RHIVertexBufferView& view) noexcept
+{
+	const D3D12_VERTEX_BUFFER_VIEW d3dView{view.address, view.sizeInBytes, view.strideInBytes};
+	m_cmdList->IASetVertexBuffers(0, 1, &d3dView);
+}
+
+void D3D12CommandList::BindIndexBuffer(const RHIIndexBufferView& view) noexcept
+{
+	const D3D12_INDEX_BUFFER_VIEW d3dView{
+	    view.address,
+	    view.sizeInBytes,
+	    view.format == RHIIndexFormat::UInt16 ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT};
+	m_cmdList->IASetIndexBuffer(&d3dView);
+}
+
+// =============================================================================
+// Resource Binding
+// =============================================================================
+
+void D3D12CommandList::SetDescriptorHeaps(RHINativeObject resourceHeap, RHINativeObject samplerHeap) noexcept
+{
+	ID3D12DescriptorHeap* heaps[] = {static_cast<ID3D12DescriptorHeap*>(resourceHeap.ptr), static_cast<ID3D12DescriptorHeap*>(samplerHeap.ptr)};
+	m_cmdList->SetDescriptorHeaps(samplerHeap ? 2u : 1u, heaps);
+}
+
+void D3D12CommandList::BindConstantBuffer(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+{
+	m_cmdList->SetGraphicsRootConstantBufferView(rootParameterIndex, gpuAddress);
+}
+
+void D3D12CommandList::BindShaderResource(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+{
+	m_cmdList->SetGraphicsRootShaderResourceView(rootParameterIndex, gpuAddress);
+}
+
+void D3D12CommandList::BindDescriptorTable(std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept
+{
+	m_cmdList->SetGraphicsRootDescriptorTable(rootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE{baseDescriptor.ptr});
+}
+
+void D3D12CommandList::SetRootConstant(std::uint32_t rootParameterIndex, std::uint32_t value, std::uint32_t destOffset) noexcept
+{
+	m_cmdList->SetGraphicsRoot32BitConstant(rootParameterIndex, value, destOffset);
+}
+
+// =============================================================================
+// Render Targets
+// =============================================================================
+
+void D3D12CommandList::SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv) noexcept
+{
+	std::array<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT> d3dRtvs{};
+	numRTVs = std::min<std::uint32_t>(numRTVs, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT);
+	for (std::uint32_t i = 0; i < numRTVs; ++i)
+	{
+		d3dRtvs[i].ptr = static_cast<SIZE_T>(rtvs[i].ptr);
+	}
+
+	D3D12_CPU_DESCRIPTOR_HANDLE d3dDsv{};
+	if (dsv)
+	{
+		d3dDsv.ptr = static_cast<SIZE_T>(dsv->ptr);
+	}
+
+	m_cmdList->OMSetRenderTargets(numRTVs, d3dRtvs.data(), FALSE, dsv ? &d3dDsv : nullptr);
+}
+
+void D3D12CommandList::ClearRenderTarget(RHICpuDescriptor rtv, const float color[4]) noexcept
+{
+	m_cmdList->ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE{static_cast<SIZE_T>(rtv.ptr)}, color, 0, nullptr);
+}
+
+void D3D12CommandList::ClearDepthStencil(RHICpuDescriptor dsv, float depth, std::uint8_t stencil) noexcept
+{
+	m_cmdList->ClearDepthStencilView(
+	    D3D12_CPU_DESCRIPTOR_HANDLE{static_cast<SIZE_T>(dsv.ptr)},
+	    D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL,
+	    depth,
+	    stencil,
+	    0,
+	    nullptr);
+}
+
+// =============================================================================
+// Viewport & Scissor
+// =============================================================================
+
+void D3D12CommandList::SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) noexcept
+{
+	const D3D12_VIEWPORT viewport{x, y, width, height, minDepth, maxDepth};
+	m_cmdList->RSSetViewports(1, &viewport);
+}
+
+void D3D12CommandList::SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept
+{
+	const D3D12_RECT scissor{static_cast<LONG>(left), static_cast<LONG>(top), static_cast<LONG>(right), static_cast<LONG>(bottom)};
+	m_cmdList->RSSetScissorRects(1, &scissor);
+}
+
+// =============================================================================
+// Draw Commands
+// =============================================================================
+
+void D3D12CommandList::DrawIndexedInstanced(
+    std::uint32_t indexCountPerInstance,
+    std::uint32_t instanceCount,
+    std::uint32_t startIndexLocation,
+    std::int32_t baseVertexLocation,
+    std::uint32_t startInstanceLocation) noexcept
+{
+	m_cmdList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+}
+
+void D3D12CommandList::DrawInstanced(
+    std::uint32_t vertexCountPerInstance,
+    std::uint32_t instanceCount,
+    std::uint32_t startVertexLocation,
+    std::uint32_t startInstanceLocation) noexcept
+{
+	m_cmdList->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+}
+
+// =============================================================================
+// Resource Barriers
+// =============================================================================
+
+void D3D12CommandList::TransitionResource(RHINativeObject resource, ResourceState before, ResourceState after) noexcept
+{
+	D3D12_RESOURCE_BARRIER barrier{};
+	barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+	barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+	barrier.Transition.pResource = static_cast<ID3D12Resource*>(resource.ptr);
+	barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+	barrier.Transition.StateBefore = MapToD3D12State(before);
+	barrier.Transition.StateAfter = MapToD3D12State(after);
+
+	m_cmdList->ResourceBarrier(1, &barrier);
+}
+
+void D3D12CommandList::CopyBufferRegion(
+    RHINativeObject dst,
+    std::uint64_t dstOffset,
+    RHINativeObject src,
+    std::uint64_t srcOffset,
+    std::uint64_t numBytes) noexcept
+{
+	m_cmdList->CopyBufferRegion(static_cast<ID3D12Resource*>(dst.ptr), dstOffset, static_cast<ID3D12Resource*>(src.ptr), srcOffset, numBytes);
+}
+
+D3D12_RESOURCE_STATES D3D12CommandList::MapToD3D12State(ResourceState state) noexcept
+{
+	switch (state)
+	{
+		case ResourceState::Common:
+			return D3D12_RESOURCE_STATE_COMMON;
+		case ResourceState::RenderTarget:
+			return D3D12_RESOURCE_STATE_RENDER_TARGET;
+		case ResourceState::DepthWrite:
+			return D3D12_RESOURCE_STATE_DEPTH_WRITE;
+		case ResourceState::DepthRead:
+			return D3D12_RESOURCE_STATE_DEPTH_READ;
+		case ResourceState::ShaderResource:
+			return D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+		case ResourceState::UnorderedAccess:
+			return D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+		case ResourceState::CopySource:
+			return D3D12_RESOURCE_STATE_COPY_SOURCE;
+		case ResourceState::CopyDest:
+			return D3D12_RESOURCE_STATE_COPY_DEST;
+		case ResourceState::Present:
+			return D3D12_RESOURCE_STATE_PRESENT;
+		default:
+			return D3D12_RESOURCE_STATE_COMMON;
+	}
+}
@@ -1,5 +1,6 @@
 #include "PCH.h"
 #include "D3D12Rhi.h"
+#include "D3D12CommandList.h"
 #include "D3D12DebugLayer.h"
 #include "Window.h"
 #include "DebugUtils.h"
@@ -149,9 +150,32 @@ void D3D12Rhi::CreateCommandLists()
 		// Close immediately - command lists are created in recording state,
 		// but we want them closed so BeginFrame can reset allocator then reopen.
 		CHECK(m_cmdList[i]->Close());
+
+		m_rhiCmdList[i] = std::make_unique<D3D12CommandList>(m_cmdList[i].Get());
+
+		for (UINT worker = 0; worker < kMaxWorkerCommandLists; ++worker)
+		{
+			CHECK(m_device->CreateCommandAllocator(
+			    D3D12_COMMAND_LIST_TYPE_DIRECT,
+			    IID_PPV_ARGS(m_workerAllocators[i][worker].ReleaseAndGetAddressOf())));
+			CHECK(m_device->CreateCommandList(
+			    0,
+			    D3D12_COMMAND_LIST_TYPE_DIRECT,
+			    m_workerAllocators[i][worker].Get(),
+			    nullptr,
+			    IID_PPV_ARGS(m_workerCmdLists[i][worker].ReleaseAndGetAddressOf())));
+			CHECK(m_workerCmdLists[i][worker]->Close());
+
+			m_rhiWorkerCmdLists[i][worker] = std::make_unique<D3D12CommandList>(m_workerCmdLists[i][worker].Get());
+		}
 	}
 }
 
+RHICommandList& D3D12Rhi::GetRHICommandList(uint32_t frameInFlightIndex) noexcept
+{
+	return *m_rhiCmdList[frameInFlightIndex];
+}
+
 void D3D12Rhi::CreateFenceAndEvent()
 {
 	for (UINT i = 0; i < RHISettings::FramesInFlight; ++i)
@@ -201,6 +225,45 @@ void D3D12Rhi::ResetCommandList(uint32_t frameInFlightIndex) noexcept
 	CHECK(m_cmdList[frameInFlightIndex]->Reset(m_cmdAllocator[frameInFlightIndex].Get(), nullptr));
 }
 
+// -----------------------------------------------------------------------------
+// Worker Command Lists
+// -----------------------------------------------------------------------------
+
+void D3D12Rhi::BeginWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept
+{
+	CHECK(m_workerAllocators[frameInFlightIndex][worker]->Reset());
+	CHECK(m_workerCmdLists[frameInFlightIndex][worker]->Reset(m_workerAllocators[frameInFlightIndex][worker].Get(), nullptr));
+}
+
+void D3D12Rhi::CloseWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept
+{
+	CHECK(m_workerCmdLists[frameInFlightIndex][worker]->Close());
+}
+
+RHICommandList& D3D12Rhi::GetWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept
+{
+	return *m_rhiWorkerCmdLists[frameInFlightIndex][worker];
+}
+
+void D3D12Rhi::SubmitWorkerCommandLists(uint32_t frameInFlightIndex, uint32_t workerCount) noexcept
+{
+	workerCount = std::min(workerCount, kMaxWorkerCommandLists);
+
+	std::array<ID3D12CommandList*, kMaxWorkerCommandLists + 1> lists{};
+	lists[0] = m_cmdList[frameInFlightIndex].Get();
+	for (uint32_t worker = 0; worker < workerCount; ++worker)
+	{
+		lists[worker + 1] = m_workerCmdLists[frameInFlightIndex][worker].Get();
+	}
+
+	CHECK(m_cmdList[frameInFlightIndex]->Close());
+	m_cmdQueue->ExecuteCommandLists(workerCount + 1, lists.data());
+
+	// Reopen on the same allocator: its earlier commands are in flight, so it
+	// is only reset next time this frame index comes around
+	CHECK(m_cmdList[frameInFlightIndex]->Reset(m_cmdAllocator[frameInFlightIndex].Get(), nullptr));
+}
+
 void D3D12Rhi::ExecuteCommandList(uint32_t frameInFlightIndex) noexcept
 {
 	if (!m_cmdList[frameInFlightIndex] || !m_cmdQueue)
@@ -238,17 +301,20 @@ void D3D12Rhi::SetBarrier(
 void D3D12Rhi::WaitForGPU(uint32_t frameInFlightIndex) noexcept
 {
 	// TODO: Implement WaitForMultipleObjects for correct frame buffering & pacing
+	WaitForFenceValue(m_fenceValues[frameInFlightIndex]);
+}
 
-	const uint64_t fenceCurrentValue = m_fenceValues[frameInFlightIndex];
+void D3D12Rhi::WaitForFenceValue(uint64_t fenceValue) noexcept
+{
 	if (!m_fence)
 	{
-		LOG_FATAL("WaitForGPU called without a fence");
+		LOG_FATAL("WaitForFenceValue called without a fence");
 	}
 
 	const uint64_t fenceCompletedValue = m_fence->GetCompletedValue();
-	if (fenceCompletedValue < fenceCurrentValue)
+	if (fenceCompletedValue < fenceValue)
 	{
-		CHECK(m_fence->SetEventOnCompletion(fenceCurrentValue, m_fenceEvent));
+		CHECK(m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent));
 		WaitForSingleObject(m_fenceEvent, INFINITE);
 	}
 }
@@ -268,6 +334,11 @@ void D3D12Rhi::Signal(uint32_t frameInFlightIndex) noexcept
 	m_fenceValues[frameInFlightIndex] = currentFenceValue;
 }
 
+uint64_t D3D12Rhi::GetCompletedFenceValue() const noexcept
+{
+	return m_fence ? m_fence->GetCompletedValue() : 0;
+}
+
 void D3D12Rhi::Flush() noexcept
 {
 	// Signal and wait for all frames to complete
@@ -280,8 +351,19 @@ void D3D12Rhi::Flush() noexcept
 
 D3D12Rhi::~D3D12Rhi() noexcept
 {
+	// Anything still registered here leaked past its owner; release before the device
+	m_buffers.clear();
+	m_freeBufferSlots.clear();
+
 	for (UINT i = 0; i < RHISettings::FramesInFlight; ++i)
 	{
+		m_rhiCmdList[i].reset();
+		for (uint32_t worker = 0; worker < kMaxWorkerCommandLists; ++worker)
+		{
+			m_rhiWorkerCmdLists[i][worker].reset();
+			m_workerCmdLists[i][worker].Reset();
+			m_workerAllocators[i][worker].Reset();
+		}
 		m_cmdList[i].Reset();
 		m_cmdAllocator[i].Reset();
 		m_fenceValues[i] = 0;
@@ -310,4 +392,107 @@ D3D12Rhi::~D3D12Rhi() noexcept
 #if ENGINE_GPU_VALIDATION
 	m_debugLayer.reset();  // Destroy after device to report live objects
 #endif
-}
\ No newline at end of file
+}
+
+// =============================================================================
+// Buffers (RHIDevice)
+// =============================================================================
+
+RHIBufferHandle D3D12Rhi::CreateBuffer(const RHIBufferDesc& desc)
+{
+	if (desc.size == 0)
+	{
+		LOG_ERROR("CreateBuffer: size must be greater than zero");
+		return {};
+	}
+
+	const bool bUpload = desc.heap == RHIHeapType::Upload;
+	const CD3DX12_HEAP_PROPERTIES heapProps(bUpload ? D3D12_HEAP_TYPE_UPLOAD : D3D12_HEAP_TYPE_DEFAULT);
+	const CD3DX12_RESOURCE_DESC resourceDesc = CD3DX12_RESOURCE_DESC::Buffer(desc.size);
+
+	ComPtr<ID3D12Resource> resource;
+	HRESULT hr = m_device->CreateCommittedResource(
+	    &heapProps,
+	    D3D12_HEAP_FLAG_NONE,
+	    &resourceDesc,
+	    bUpload ? D3D12_RESOURCE_STATE_GENERIC_READ : D3D12_RESOURCE_STATE_COMMON,
+	    nullptr,
+	    IID_PPV_ARGS(resource.ReleaseAndGetAddressOf()));
+	if (FAILED(hr))
+	{
+		LOG_ERROR("CreateBuffer: CreateCommittedResource failed");
+		return {};
+	}
+	if (desc.debugName)
+	{
+		DebugUtils::SetDebugName(resource, desc.debugName);
+	}
+
+	// Upload buffers are persistently mapped; the CPU never reads them back
+	void* mapped = nullptr;
+	if (bUpload)
+	{
+		const D3D12_RANGE readRange{0, 0};
+		if (FAILED(resource->Map(0, &readRange, &mapped)))
+		{
+			LOG_ERROR("CreateBuffer: Map failed");
+			return {};
+		}
+	}
+
+	uint32_t slot = 0;
+	if (!m_freeBufferSlots.empty())
+	{
+		slot = m_freeBufferSlots.back();
+		m_freeBufferSlots.pop_back();
+	}
+	else
+	{
+		slot = static_cast<uint32_t>(m_buffers.size());
+		m_buffers.emplace_back();
+	}
+
+	BufferSlot& buffer = m_buffers[slot];
+	buffer.resource = std::move(resource);
+	buffer.mapped = mapped;
+	return RHIBufferHandle{slot, buffer.generation};
+}
+
+void D3D12Rhi::DestroyBuffer(RHIBufferHandle handle) noexcept
+{
+	if (!GetBufferResource(handle))
+	{
+		LOG_ERROR("DestroyBuffer: stale or invalid handle");
+		return;
+	}
+
+	BufferSlot& buffer = m_buffers[handle.index];
+	if (buffer.mapped)
+	{
+		buffer.resource->Unmap(0, nullptr);
+	}
+	buffer.resource.Reset();
+	buffer.mapped = nullptr;
+	++buffer.generation;
+	m_freeBufferSlots.push_back(handle.index);
+}
+
+ID3D12Resource* D3D12Rhi::GetBufferResource(RHIBufferHandle handle) const noexcept
+{
+	if (!handle.IsValid() || handle.index >= m_buffers.size())
+		return nullptr;
+
+	const BufferSlot& buffer = m_buffers[handle.index];
+	return buffer.generation == handle.generation ? buffer.resource.Get() : nullptr;
+}
+
+void* D3D12Rhi::GetMappedData(RHIBufferHandle handle) const noexcept
+{
+	return GetBufferResource(handle) ? m_buffers[handle.index].mapped : nullptr;
+}
+
+RHIGpuAddress D3D12Rhi::GetGPUAddress(RHIBufferHandle handle) const noexcept
+{
+	ID3D12Resource* resource = GetBufferResource(handle);
+	return resource ? resource->GetGPUVirtualAddress() : 0;
+}
@@ -66,8 +66,7 @@ void D3D12SwapChain::Create()
 // Clears the current render target view with a solid color
 void D3D12SwapChain::Clear()
 {
-	float clearColor[4] = {0.0f, 0.00f, 0.00f, 1.0f};
-	m_rhi.GetCommandList()->ClearRenderTargetView(GetCPUHandle(), clearColor, 0, nullptr);
+	m_rhi.GetCommandList()->ClearRenderTargetView(GetCPUHandle(), kClearColor, 0, nullptr);
 }
 
 // Resizes the swap chain buffers and recreates render target views
@@ -10,6 +10,25 @@
 
 // Implements graphics pipeline state setup and configuration for D3D12.
 
+namespace D3D12PipelineStateInternal
+{
+	[[nodiscard]] D3D12_COMPARISON_FUNC ToD3D12ComparisonFunc(RHIComparisonFunc func) noexcept
+	{
+		switch (func)
+		{
+			case RHIComparisonFunc::Less:
+				return D3D12_COMPARISON_FUNC_LESS;
+			case RHIComparisonFunc::LessEqual:
+				return D3D12_COMPARISON_FUNC_LESS_EQUAL;
+			case RHIComparisonFunc::Greater:
+				return D3D12_COMPARISON_FUNC_GREATER;
+			case RHIComparisonFunc::GreaterEqual:
+				return D3D12_COMPARISON_FUNC_GREATER_EQUAL;
+		}
+		return D3D12_COMPARISON_FUNC_LESS_EQUAL;
+	}
+}  // namespace D3D12PipelineStateInternal
+
 void D3D12PipelineState::SetStreamOutput(D3D12_GRAPHICS_PIPELINE_STATE_DESC& psoDesc) noexcept
 {
 	psoDesc.StreamOutput = {};
@@ -121,7 +140,7 @@ D3D12PipelineState::D3D12PipelineState(
 	DepthTestDesc depthTestDesc = {};
 	depthTestDesc.DepthEnable = true;
 	depthTestDesc.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-	depthTestDesc.DepthFunc = DepthConvention::GetDepthComparisonFuncEqual();
+	depthTestDesc.DepthFunc = D3D12PipelineStateInternal::ToD3D12ComparisonFunc(DepthConvention::GetDepthComparisonFuncEqual());
 	SetDepthTestState(psoDesc, depthTestDesc);
 
 	// Stencil state
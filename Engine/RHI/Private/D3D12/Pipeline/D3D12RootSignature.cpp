@@ -23,7 +23,7 @@ void D3D12RootSignature::Create()
 	// Sampler table is a single contiguous range starting at s0.
 	samplerRange.Init(D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, RootBindings::SamplerRegister::Count, 0);
 
-	// Root CBVs (b0-b3)
+	// Root CBVs (b0, b1)
 	rootParameters[RootBindings::RootParam::PerFrame].InitAsConstantBufferView(
 	    RootBindings::CBRegister::PerFrame,
 	    0,
@@ -34,15 +34,18 @@ void D3D12RootSignature::Create()
 	    0,
 	    RootBindings::Visibility::PerView);
 
-	rootParameters[RootBindings::RootParam::PerObjectVS].InitAsConstantBufferView(
-	    RootBindings::CBRegister::PerObjectVS,
+	// Material index (b3) — one root constant, set per instanced batch
+	rootParameters[RootBindings::RootParam::MaterialIndex].InitAsConstants(
+	    1,
+	    RootBindings::CBRegister::MaterialIndex,
 	    0,
-	    RootBindings::Visibility::PerObjectVS);
+	    RootBindings::Visibility::MaterialIndex);
 
-	rootParameters[RootBindings::RootParam::PerObjectPS].InitAsConstantBufferView(
-	    RootBindings::CBRegister::PerObjectPS,
+	// Per-object structured buffer (t1) — root SRV, bound once per pass
+	rootParameters[RootBindings::RootParam::ObjectData].InitAsShaderResourceView(
+	    RootBindings::SRVRegister::ObjectData,
 	    0,
-	    RootBindings::Visibility::PerObjectPS);
+	    RootBindings::Visibility::ObjectData);
 
 	// Texture SRV table (t0+)
 	rootParameters[RootBindings::RootParam::TextureSRV].InitAsDescriptorTable(1, &srvRange, RootBindings::Visibility::TextureSRV);
@@ -50,6 +53,18 @@ void D3D12RootSignature::Create()
 	// Sampler table (s0-sN)
 	rootParameters[RootBindings::RootParam::SamplerTable].InitAsDescriptorTable(1, &samplerRange, RootBindings::Visibility::SamplerTable);
 
+	// Instance -> object ID structured buffer (t2) — root SRV, rebound per instanced batch
+	rootParameters[RootBindings::RootParam::InstanceObjectIds].InitAsShaderResourceView(
+	    RootBindings::SRVRegister::InstanceObjectIds,
+	    0,
+	    RootBindings::Visibility::InstanceObjectIds);
+
+	// Material table structured buffer (t3) — root SRV, bound once per pass
+	rootParameters[RootBindings::RootParam::MaterialTable].InitAsShaderResourceView(
+	    RootBindings::SRVRegister::MaterialTable,
+	    0,
+	    RootBindings::Visibility::MaterialTable);
+
 	// Create root signature
 	CD3DX12_ROOT_SIGNATURE_DESC rootSignatureDesc = {};
 	rootSignatureDesc
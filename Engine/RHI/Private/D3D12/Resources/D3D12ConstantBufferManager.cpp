@@ -1,6 +1,5 @@
 #include "PCH.h"
 #include "D3D12ConstantBufferManager.h"
-#include "D3D12FrameResource.h"
 #include "Timer.h"
 #include "Window.h"
 #include "UI.h"
@@ -12,10 +11,9 @@ D3D12ConstantBufferManager::D3D12ConstantBufferManager(
     D3D12Rhi& rhi,
     Window& window,
     D3D12DescriptorHeapManager& descriptorHeapManager,
-    D3D12FrameResourceManager& frameResourceManager,
     D3D12SwapChain& swapChain,
     UI& ui) :
-    m_timer(&timer), m_window(&window), m_frameResourceManager(&frameResourceManager), m_swapChain(&swapChain), m_ui(&ui)
+    m_timer(&timer), m_window(&window), m_swapChain(&swapChain), m_ui(&ui)
 {
 	for (uint32_t i = 0; i < RHISettings::FramesInFlight; ++i)
 	{
@@ -78,27 +76,3 @@ void D3D12ConstantBufferManager::UpdatePerView(const PerViewConstantBufferData&
 	const uint32_t frameInFlightIndex = m_swapChain->GetFrameInFlightIndex();
 	m_perViewCB[frameInFlightIndex]->Update(data);
 }
-
-//------------------------------------------------------------------------------
-// Per-Object VS Update (per draw call - uses ring buffer)
-//------------------------------------------------------------------------------
-// This is the critical path for scaling to many objects:
-//   - Each call allocates from the per-frame linear allocator
-//   - Returns a unique GPU VA that won't be overwritten until next frame
-//   - Thread-safe allocation allows future multithreaded recording
-//------------------------------------------------------------------------------
-
-D3D12_GPU_VIRTUAL_ADDRESS D3D12ConstantBufferManager::UpdatePerObjectVS(const PerObjectVSConstantBufferData& data)
-{
-	// Allocate from ring buffer and copy data - returns unique GPU VA
-	return m_frameResourceManager->AllocateConstantBuffer(data);
-}
-
-//------------------------------------------------------------------------------
-// Per-Object PS Update (per draw call - uses ring buffer)
-//------------------------------------------------------------------------------
-
-D3D12_GPU_VIRTUAL_ADDRESS D3D12ConstantBufferManager::UpdatePerObjectPS(const PerObjectPSConstantBufferData& data)
-{
-	return m_frameResourceManager->AllocateConstantBuffer(data);
-}
@@ -0,0 +1,284 @@
+// ============================================================================
+// NullCommandList.cpp
+// ----------------------------------------------------------------------------
+// Validating, counting RHICommandList for the Null backend.
+// ============================================================================
+
+#include "PCH.h"
+#include "Null/NullCommandList.h"
+#include "Null/NullRhi.h"
+
+namespace NullCommandListInternal
+{
+	constexpr std::uint64_t kMaxErrorLogs = 8;
+}  // namespace NullCommandListInternal
+
+NullCommandList::NullCommandList(const NullRhi& device) noexcept : m_device(&device) {}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+void NullCommandList::Begin() noexcept
+{
+	m_bRecording = true;
+	m_bPipelineBound = false;
+	m_bRootSignatureBound = false;
+	m_bDescriptorHeapsSet = false;
+	m_bViewportSet = false;
+	m_bScissorSet = false;
+	m_renderTargetCount = 0;
+	m_bDepthBound = false;
+	m_vertexBuffer = {};
+	m_indexBuffer = {};
+}
+
+void NullCommandList::End() noexcept
+{
+	m_bRecording = false;
+}
+
+// ============================================================================
+// Pipeline State
+// ============================================================================
+
+void NullCommandList::SetPipelineState(RHINativeObject pipelineState) noexcept
+{
+	Validate(m_bRecording, "SetPipelineState outside recording");
+	m_bPipelineBound = Validate(static_cast<bool>(pipelineState), "SetPipelineState: null pipeline");
+	++m_stats.pipelineBinds;
+}
+
+void NullCommandList::SetRootSignature(RHINativeObject rootSignature) noexcept
+{
+	Validate(m_bRecording, "SetRootSignature outside recording");
+	m_bRootSignatureBound = Validate(static_cast<bool>(rootSignature), "SetRootSignature: null root signature");
+	++m_stats.pipelineBinds;
+}
+
+// ============================================================================
+// Input Assembly
+// ============================================================================
+
+void NullCommandList::SetPrimitiveTopology([[maybe_unused]] RHIPrimitiveTopology topology) noexcept
+{
+	Validate(m_bRecording, "SetPrimitiveTopology outside recording");
+}
+
+void NullCommandList::BindVertexBuffer(const RHIVertexBufferView& view) noexcept
+{
+	Validate(m_bRecording, "BindVertexBuffer outside recording");
+	if (Validate(view.strideInBytes > 0 && m_device->IsAddressRangeValid(view.address, view.sizeInBytes), "BindVertexBuffer: view outside a live buffer"))
+	{
+		m_vertexBuffer = view;
+	}
+	++m_stats.bufferBinds;
+}
+
+void NullCommandList::BindIndexBuffer(const RHIIndexBufferView& view) noexcept
+{
+	Validate(m_bRecording, "BindIndexBuffer outside recording");
+	if (Validate(m_device->IsAddressRangeValid(view.address, view.sizeInBytes), "BindIndexBuffer: view outside a live buffer"))
+	{
+		m_indexBuffer = view;
+	}
+	++m_stats.bufferBinds;
+}
+
+// ============================================================================
+// Resource Binding
+// ============================================================================
+
+// Root CBV/SRV addresses are checked for a live buffer only; the bound size is
+// defined by the shader, which the Null backend does not see.
+
+void NullCommandList::BindConstantBuffer([[maybe_unused]] std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+{
+	Validate(m_bRecording && m_bRootSignatureBound, "BindConstantBuffer without recording root signature");
+	Validate(gpuAddress != 0, "BindConstantBuffer: null address");
+	++m_stats.bufferBinds;
+}
+
+void NullCommandList::BindShaderResource([[maybe_unused]] std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+{
+	Validate(m_bRecording && m_bRootSignatureBound, "BindShaderResource without recording root signature");
+	Validate(m_device->IsAddressRangeValid(gpuAddress, 0), "BindShaderResource: address outside a live buffer");
+	++m_stats.bufferBinds;
+}
+
+void NullCommandList::SetDescriptorHeaps(RHINativeObject resourceHeap, [[maybe_unused]] RHINativeObject samplerHeap) noexcept
+{
+	Validate(m_bRecording, "SetDescriptorHeaps outside recording");
+	m_bDescriptorHeapsSet = Validate(static_cast<bool>(resourceHeap), "SetDescriptorHeaps: null resource heap");
+	++m_stats.descriptorHeapBinds;
+}
+
+void NullCommandList::BindDescriptorTable([[maybe_unused]] std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept
+{
+	Validate(m_bRecording && m_bRootSignatureBound, "BindDescriptorTable without recording root signature");
+	Validate(m_bDescriptorHeapsSet, "BindDescriptorTable before SetDescriptorHeaps");
+	Validate(baseDescriptor.ptr != 0, "BindDescriptorTable: null descriptor");
+	++m_stats.descriptorTableBinds;
+}
+
+void NullCommandList::SetRootConstant(
+    [[maybe_unused]] std::uint32_t rootParameterIndex,
+    [[maybe_unused]] std::uint32_t value,
+    [[maybe_unused]] std::uint32_t destOffset) noexcept
+{
+	Validate(m_bRecording && m_bRootSignatureBound, "SetRootConstant without recording root signature");
+	++m_stats.rootConstants;
+}
+
+// ============================================================================
+// Render Targets
+// ============================================================================
+
+void NullCommandList::SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv) noexcept
+{
+	Validate(m_bRecording, "SetRenderTargets outside recording");
+	Validate(numRTVs == 0 || rtvs != nullptr, "SetRenderTargets: missing RTV array");
+	m_renderTargetCount = numRTVs;
+	m_bDepthBound = dsv != nullptr && dsv->ptr != 0;
+}
+
+void NullCommandList::ClearRenderTarget(RHICpuDescriptor rtv, [[maybe_unused]] const float color[4]) noexcept
+{
+	Validate(m_bRecording && rtv.ptr != 0, "ClearRenderTarget: not recording or null RTV");
+	++m_stats.clears;
+}
+
+void NullCommandList::ClearDepthStencil(RHICpuDescriptor dsv, float depth, [[maybe_unused]] std::uint8_t stencil) noexcept
+{
+	Validate(m_bRecording && dsv.ptr != 0, "ClearDepthStencil: not recording or null DSV");
+	Validate(depth >= 0.0f && depth <= 1.0f, "ClearDepthStencil: depth outside [0, 1]");
+	++m_stats.clears;
+}
+
+// ============================================================================
+// Viewport & Scissor
+// ============================================================================
+
+void NullCommandList::SetViewport(
+    [[maybe_unused]] float x,
+    [[maybe_unused]] float y,
+    float width,
+    float height,
+    float minDepth,
+    float maxDepth) noexcept
+{
+	Validate(m_bRecording, "SetViewport outside recording");
+	m_bViewportSet = Validate(width > 0.0f && height > 0.0f && minDepth <= maxDepth, "SetViewport: empty viewport");
+}
+
+void NullCommandList::SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept
+{
+	Validate(m_bRecording, "SetScissorRect outside recording");
+	m_bScissorSet = Validate(right > left && bottom > top, "SetScissorRect: empty rect");
+}
+
+// ============================================================================
+// Draw Commands
+// ============================================================================
+
+bool NullCommandList::ValidateDrawState() noexcept
+{
+	bool bValid = Validate(m_bRecording, "Draw outside recording");
+	bValid &= Validate(m_bPipelineBound && m_bRootSignatureBound, "Draw without pipeline state / root signature");
+	bValid &= Validate(m_renderTargetCount > 0 || m_bDepthBound, "Draw without render targets");
+	bValid &= Validate(m_bViewportSet && m_bScissorSet, "Draw without viewport / scissor");
+	return bValid;
+}
+
+void NullCommandList::DrawIndexedInstanced(
+    std::uint32_t indexCountPerInstance,
+    std::uint32_t instanceCount,
+    std::uint32_t startIndexLocation,
+    [[maybe_unused]] std::int32_t baseVertexLocation,
+    [[maybe_unused]] std::uint32_t startInstanceLocation) noexcept
+{
+	ValidateDrawState();
+	Validate(m_vertexBuffer.address != 0, "DrawIndexedInstanced without vertex buffer");
+
+	const std::uint64_t indexSize = GetIndexFormatSize(m_indexBuffer.format);
+	const std::uint64_t indexEnd = (static_cast<std::uint64_t>(startIndexLocation) + indexCountPerInstance) * indexSize;
+	Validate(m_indexBuffer.address != 0 && indexEnd <= m_indexBuffer.sizeInBytes, "DrawIndexedInstanced: index range outside bound index buffer");
+	Validate(indexCountPerInstance > 0 && instanceCount > 0, "DrawIndexedInstanced: empty draw");
+
+	++m_stats.drawCalls;
+	m_stats.instances += instanceCount;
+	m_stats.indices += indexCountPerInstance;
+	m_stats.indexBytesRead += indexCountPerInstance * indexSize;
+}
+
+void NullCommandList::DrawInstanced(
+    std::uint32_t vertexCountPerInstance,
+    std::uint32_t instanceCount,
+    [[maybe_unused]] std::uint32_t startVertexLocation,
+    [[maybe_unused]] std::uint32_t startInstanceLocation) noexcept
+{
+	ValidateDrawState();
+	Validate(vertexCountPerInstance > 0 && instanceCount > 0, "DrawInstanced: empty draw");
+
+	++m_stats.drawCalls;
+	m_stats.instances += instanceCount;
+	m_stats.vertices += vertexCountPerInstance;
+}
+
+// ============================================================================
+// Resource Barriers
+// ============================================================================
+
+void NullCommandList::TransitionResource(RHINativeObject resource, ResourceState before, ResourceState after) noexcept
+{
+	Validate(m_bRecording && static_cast<bool>(resource), "TransitionResource: not recording or null resource");
+	Validate(before != after, "TransitionResource: redundant barrier");
+
+	// First sighting establishes the state; afterwards "before" must match
+	const auto [it, bInserted] = m_resourceStates.try_emplace(resource.ptr, before);
+	Validate(bInserted || it->second == before, "TransitionResource: 'before' does not match tracked state");
+	it->second = after;
+
+	++m_stats.barriers;
+}
+
+// ============================================================================
+// Copies
+// ============================================================================
+
+void NullCommandList::CopyBufferRegion(
+    RHINativeObject dst,
+    std::uint64_t dstOffset,
+    RHINativeObject src,
+    std::uint64_t srcOffset,
+    std::uint64_t numBytes) noexcept
+{
+	Validate(m_bRecording, "CopyBufferRegion outside recording");
+	Validate(numBytes > 0 && dst.ptr != src.ptr, "CopyBufferRegion: empty or in-place copy");
+
+	// Native buffers are synthetic GPU addresses (NullRhi::GetNativeBuffer)
+	const auto dstAddress = static_cast<RHIGpuAddress>(reinterpret_cast<std::uintptr_t>(dst.ptr));
+	const auto srcAddress = static_cast<RHIGpuAddress>(reinterpret_cast<std::uintptr_t>(src.ptr));
+	Validate(m_device->IsAddressRangeValid(dstAddress + dstOffset, numBytes), "CopyBufferRegion: destination out of range");
+	Validate(m_device->IsAddressRangeValid(srcAddress + srcOffset, numBytes), "CopyBufferRegion: source out of range");
+
+	const auto it = m_resourceStates.find(dst.ptr);
+	Validate(it == m_resourceStates.end() || it->second == ResourceState::CopyDest || it->second == ResourceState::Common,
+	    "CopyBufferRegion: destination not in CopyDest");
+
+	++m_stats.copies;
+	m_stats.bytesCopied += numBytes;
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+bool NullCommandList::Validate(bool condition, const char* message) noexcept
+{
+	if (!condition && m_stats.validationErrors++ < NullCommandListInternal::kMaxErrorLogs)
+	{
+		LOG_ERROR(std::string("[NullCommandList] ") + message);
+	}
+	return condition;
+}
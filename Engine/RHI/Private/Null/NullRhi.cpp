@@ -0,0 +1,310 @@
+// ============================================================================
+// NullRhi.cpp
+// ----------------------------------------------------------------------------
+// GPU-less RHIDevice: host-memory buffers, instant fences, validated lists.
+// ============================================================================
+
+#include "PCH.h"
+#include "Null/NullRhi.h"
+
+#include <algorithm>
+
+namespace NullRhiInternal
+{
+	constexpr std::uint64_t kMaxErrorLogs = 8;
+	constexpr std::uint64_t kOffsetMask = (std::uint64_t{1} << NullRhi::kAddressSlotShift) - 1;
+}  // namespace NullRhiInternal
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+NullRhi::NullRhi()
+{
+	for (auto& commandList : m_commandLists)
+	{
+		commandList = std::make_unique<NullCommandList>(*this);
+	}
+	for (auto& frameWorkers : m_workerCommandLists)
+	{
+		for (auto& commandList : frameWorkers)
+		{
+			commandList = std::make_unique<NullCommandList>(*this);
+		}
+	}
+	LOG_INFO("NullRhi: Created (no GPU)");
+}
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+RHIBufferHandle NullRhi::CreateBuffer(const RHIBufferDesc& desc)
+{
+	if (desc.size == 0 || desc.size > NullRhiInternal::kOffsetMask)
+	{
+		ReportError("CreateBuffer: size must be in (0, 1 TiB]");
+		return {};
+	}
+
+	std::uint32_t slot = 0;
+	if (!m_freeSlots.empty())
+	{
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = static_cast<std::uint32_t>(m_buffers.size());
+		m_buffers.emplace_back();
+	}
+
+	Buffer& buffer = m_buffers[slot];
+	buffer.size = desc.size;
+	buffer.bLive = true;
+	if (desc.heap == RHIHeapType::Upload)
+	{
+		buffer.data = std::make_unique<std::byte[]>(static_cast<std::size_t>(desc.size));
+	}
+
+	++m_stats.buffersCreated;
+	++m_stats.buffersLive;
+	m_stats.bufferBytesLive += desc.size;
+	m_stats.bufferBytesPeak = std::max(m_stats.bufferBytesPeak, m_stats.bufferBytesLive);
+
+	return RHIBufferHandle{slot, buffer.generation};
+}
+
+void NullRhi::DestroyBuffer(RHIBufferHandle handle) noexcept
+{
+	if (!Resolve(handle))
+	{
+		ReportError("DestroyBuffer: stale or invalid handle");
+		return;
+	}
+
+	Buffer& buffer = m_buffers[handle.index];
+	m_stats.bufferBytesLive -= buffer.size;
+	--m_stats.buffersLive;
+
+	buffer.data.reset();
+	buffer.size = 0;
+	buffer.bLive = false;
+	++buffer.generation;
+	m_freeSlots.push_back(handle.index);
+}
+
+void* NullRhi::GetMappedData(RHIBufferHandle handle) const noexcept
+{
+	const Buffer* buffer = Resolve(handle);
+	return buffer ? buffer->data.get() : nullptr;
+}
+
+RHIGpuAddress NullRhi::GetGPUAddress(RHIBufferHandle handle) const noexcept
+{
+	return Resolve(handle) ? (static_cast<RHIGpuAddress>(handle.index) + 1) << kAddressSlotShift : 0;
+}
+
+RHINativeObject NullRhi::GetNativeBuffer(RHIBufferHandle handle) const noexcept
+{
+	return {reinterpret_cast<void*>(static_cast<std::uintptr_t>(GetGPUAddress(handle)))};
+}
+
+bool NullRhi::IsAddressRangeValid(RHIGpuAddress address, std::uint64_t size) const noexcept
+{
+	const std::uint64_t slotPlusOne = address >> kAddressSlotShift;
+	if (slotPlusOne == 0 || slotPlusOne > m_buffers.size())
+		return false;
+
+	const Buffer& buffer = m_buffers[slotPlusOne - 1];
+	const std::uint64_t offset = address & NullRhiInternal::kOffsetMask;
+	return buffer.bLive && offset <= buffer.size && size <= buffer.size - offset;
+}
+
+const NullRhi::Buffer* NullRhi::Resolve(RHIBufferHandle handle) const noexcept
+{
+	if (!handle.IsValid() || handle.index >= m_buffers.size())
+		return nullptr;
+
+	const Buffer& buffer = m_buffers[handle.index];
+	return buffer.bLive && buffer.generation == handle.generation ? &buffer : nullptr;
+}
+
+// ============================================================================
+// Command Recording
+// ============================================================================
+
+void NullRhi::ResetCommandAllocator(std::uint32_t frameInFlightIndex) noexcept
+{
+	if (m_commandLists[frameInFlightIndex]->IsRecording())
+	{
+		ReportError("ResetCommandAllocator: command list still recording");
+	}
+}
+
+void NullRhi::ResetCommandList(std::uint32_t frameInFlightIndex) noexcept
+{
+	if (m_commandLists[frameInFlightIndex]->IsRecording())
+	{
+		ReportError("ResetCommandList: command list was not closed");
+	}
+	m_commandLists[frameInFlightIndex]->Begin();
+}
+
+void NullRhi::CloseCommandList(std::uint32_t frameInFlightIndex) noexcept
+{
+	if (!m_commandLists[frameInFlightIndex]->IsRecording())
+	{
+		ReportError("CloseCommandList: command list is not recording");
+	}
+	m_commandLists[frameInFlightIndex]->End();
+}
+
+void NullRhi::ExecuteCommandList(std::uint32_t frameInFlightIndex) noexcept
+{
+	if (m_commandLists[frameInFlightIndex]->IsRecording())
+	{
+		ReportError("ExecuteCommandList: command list must be closed first");
+		return;
+	}
+	++m_stats.submissions;
+	if (m_bLogSubmissions)
+	{
+		m_submissionLog.push_back({false, 0, m_commandLists[frameInFlightIndex]->GetStats()});
+	}
+}
+
+RHICommandList& NullRhi::GetRHICommandList(std::uint32_t frameInFlightIndex) noexcept
+{
+	return *m_commandLists[frameInFlightIndex];
+}
+
+// ============================================================================
+// Worker Command Lists
+// ============================================================================
+
+void NullRhi::BeginWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept
+{
+	NullCommandList& commandList = *m_workerCommandLists[frameInFlightIndex][worker];
+	if (commandList.IsRecording())
+	{
+		ReportError("BeginWorkerCommandList: worker list was not closed");
+	}
+	commandList.Begin();
+}
+
+void NullRhi::CloseWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept
+{
+	NullCommandList& commandList = *m_workerCommandLists[frameInFlightIndex][worker];
+	if (!commandList.IsRecording())
+	{
+		ReportError("CloseWorkerCommandList: worker list is not recording");
+	}
+	commandList.End();
+}
+
+RHICommandList& NullRhi::GetWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept
+{
+	return *m_workerCommandLists[frameInFlightIndex][worker];
+}
+
+void NullRhi::SubmitWorkerCommandLists(std::uint32_t frameInFlightIndex, std::uint32_t workerCount) noexcept
+{
+	if (workerCount > kMaxWorkerCommandLists)
+	{
+		ReportError("SubmitWorkerCommandLists: too many worker lists");
+		return;
+	}
+	for (std::uint32_t worker = 0; worker < workerCount; ++worker)
+	{
+		if (m_workerCommandLists[frameInFlightIndex][worker]->IsRecording())
+		{
+			ReportError("SubmitWorkerCommandLists: worker list must be closed first");
+			return;
+		}
+	}
+
+	// Same sequence as D3D12: close + submit the frame list, then reopen it
+	CloseCommandList(frameInFlightIndex);
+	ExecuteCommandList(frameInFlightIndex);
+	if (m_bLogSubmissions)
+	{
+		for (std::uint32_t worker = 0; worker < workerCount; ++worker)
+		{
+			m_submissionLog.push_back({true, worker, m_workerCommandLists[frameInFlightIndex][worker]->GetStats()});
+		}
+	}
+	ResetCommandList(frameInFlightIndex);
+}
+
+// ============================================================================
+// Synchronization
+// ============================================================================
+
+void NullRhi::Signal(std::uint32_t frameInFlightIndex) noexcept
+{
+	// Nothing is queued, so the GPU "finishes" the moment it is signaled
+	m_fenceValues[frameInFlightIndex] = m_nextFenceValue++;
+	if (!m_bManualFenceCompletion)
+	{
+		m_completedFenceValue = m_fenceValues[frameInFlightIndex];
+	}
+}
+
+void NullRhi::WaitForGPU(std::uint32_t frameInFlightIndex) noexcept
+{
+	WaitForFenceValue(m_fenceValues[frameInFlightIndex]);
+}
+
+void NullRhi::Flush() noexcept
+{
+	for (std::uint32_t i = 0; i < RHISettings::FramesInFlight; ++i)
+	{
+		Signal(i);
+		WaitForGPU(i);
+	}
+}
+
+void NullRhi::WaitForFenceValue(std::uint64_t fenceValue) noexcept
+{
+	CompleteFenceValue(fenceValue);
+}
+
+void NullRhi::CompleteFenceValue(std::uint64_t fenceValue) noexcept
+{
+	if (fenceValue >= m_nextFenceValue)
+	{
+		ReportError("CompleteFenceValue: fence value was never signaled");
+		return;
+	}
+	m_completedFenceValue = std::max(m_completedFenceValue, fenceValue);
+}
+
+// ============================================================================
+// Stats
+// ============================================================================
+
+std::uint64_t NullRhi::GetValidationErrorCount() const noexcept
+{
+	std::uint64_t count = m_stats.validationErrors;
+	for (const auto& commandList : m_commandLists)
+	{
+		count += commandList->GetStats().validationErrors;
+	}
+	for (const auto& frameWorkers : m_workerCommandLists)
+	{
+		for (const auto& commandList : frameWorkers)
+		{
+			count += commandList->GetStats().validationErrors;
+		}
+	}
+	return count;
+}
+
+void NullRhi::ReportError(const char* message) noexcept
+{
+	if (m_stats.validationErrors++ < NullRhiInternal::kMaxErrorLogs)
+	{
+		LOG_ERROR(std::string("[NullRhi] ") + message);
+	}
+}
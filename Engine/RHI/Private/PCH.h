@@ -7,6 +7,7 @@
 // - Only STL, Windows, and DirectX headers (stable, rarely change)
 // - RHIConfig.h for compile-time feature toggles
 // - Headers must be used in 50%+ of this module's .cpp files
+// - Windows/DirectX headers are guarded: off Windows only the Null backend builds
 // ============================================================================
 
 #pragma once
@@ -19,10 +20,12 @@
 // ============================================================================
 // Windows Configuration
 // ============================================================================
+#if defined(_WIN32)
 #define NOMINMAX
 #ifndef WIN32_LEAN_AND_MEAN
 	#define WIN32_LEAN_AND_MEAN
 #endif
+#endif
 
 // ============================================================================
 // C++ Standard Library - Commonly used across RHI
@@ -39,8 +42,10 @@
 // ============================================================================
 // Windows - Required for D3D12
 // ============================================================================
+#if defined(_WIN32)
 #include <Windows.h>
 #include <wrl/client.h>
+#endif
 
 // ============================================================================
 // Engine Logging - Available everywhere via PCH
@@ -48,8 +53,9 @@
 #include "Log.h"
 
 // ============================================================================
-// DirectX 12 - Core RHI dependency (used in 100% of .cpp files)
+// DirectX 12 - D3D12 backend dependency (everything outside Null/)
 // ============================================================================
+#if defined(_WIN32)
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include <DirectXMath.h>
@@ -68,3 +74,4 @@
 // Convenience Aliases
 // ============================================================================
 using Microsoft::WRL::ComPtr;
+#endif  // _WIN32
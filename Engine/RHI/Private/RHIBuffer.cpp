@@ -0,0 +1,55 @@
+// ============================================================================
+// RHIBuffer.cpp
+// ----------------------------------------------------------------------------
+// Owning wrapper around a buffer created through RHIDevice.
+// ============================================================================
+
+#include "PCH.h"
+#include "RHIDevice.h"
+
+#include <utility>
+
+RHIBuffer::RHIBuffer(RHIDevice& device, const RHIBufferDesc& desc) : m_device(&device), m_handle(device.CreateBuffer(desc))
+{
+	if (m_handle.IsValid())
+	{
+		m_size = desc.size;
+		m_mapped = device.GetMappedData(m_handle);
+		m_gpuAddress = device.GetGPUAddress(m_handle);
+	}
+}
+
+RHIBuffer::RHIBuffer(RHIBuffer&& other) noexcept :
+    m_device(std::exchange(other.m_device, nullptr)),
+    m_handle(std::exchange(other.m_handle, RHIBufferHandle{})),
+    m_size(std::exchange(other.m_size, 0)),
+    m_mapped(std::exchange(other.m_mapped, nullptr)),
+    m_gpuAddress(std::exchange(other.m_gpuAddress, 0))
+{
+}
+
+RHIBuffer& RHIBuffer::operator=(RHIBuffer&& other) noexcept
+{
+	if (this != &other)
+	{
+		Reset();
+		m_device = std::exchange(other.m_device, nullptr);
+		m_handle = std::exchange(other.m_handle, RHIBufferHandle{});
+		m_size = std::exchange(other.m_size, 0);
+		m_mapped = std::exchange(other.m_mapped, nullptr);
+		m_gpuAddress = std::exchange(other.m_gpuAddress, 0);
+	}
+	return *this;
+}
+
+void RHIBuffer::Reset() noexcept
+{
+	if (m_device && m_handle.IsValid())
+	{
+		m_device->DestroyBuffer(m_handle);
+	}
+	m_handle = {};
+	m_size = 0;
+	m_mapped = nullptr;
+	m_gpuAddress = 0;
+}
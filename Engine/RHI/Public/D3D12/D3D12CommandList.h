@@ -0,0 +1,89 @@
+// =============================================================================
+// D3D12CommandList.h — RHICommandList backed by an ID3D12GraphicsCommandList
+// =============================================================================
+//
+// Translates RHI commands 1:1 into D3D12 calls. D3D12Rhi owns one per frame
+// in flight, wrapping that frame's command list.
+//
+// USAGE:
+//   RHICommandList& cmd = rhi.GetRHICommandList(frameIndex);
+//   RenderContext context(cmd);
+//
+// NOTES:
+//   - Non-owning: the ID3D12GraphicsCommandList stays owned by D3D12Rhi
+//   - RHINativeObject arguments are ID3D12PipelineState*, ID3D12RootSignature*,
+//     ID3D12DescriptorHeap* and ID3D12Resource* respectively
+//
+// =============================================================================
+
+#pragma once
+
+#include "RHICommandList.h"
+
+#include <d3d12.h>
+
+// =============================================================================
+// D3D12CommandList
+// =============================================================================
+
+class D3D12CommandList final : public RHICommandList
+{
+  public:
+	explicit D3D12CommandList(ID3D12GraphicsCommandList* cmdList) noexcept : m_cmdList(cmdList) {}
+	~D3D12CommandList() noexcept override = default;
+
+	D3D12CommandList(const D3D12CommandList&) = delete;
+	D3D12CommandList& operator=(const D3D12CommandList&) = delete;
+	D3D12CommandList(D3D12CommandList&&) = delete;
+	D3D12CommandList& operator=(D3D12CommandList&&) = delete;
+
+	void SetPipelineState(RHINativeObject pipelineState) noexcept override;
+	void SetRootSignature(RHINativeObject rootSignature) noexcept override;
+
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) noexcept override;
+	void BindVertexBuffer(const RHIVertexBufferView& view) noexcept override;
+	void BindIndexBuffer(const RHIIndexBufferView& view) noexcept override;
+
+	void SetDescriptorHeaps(RHINativeObject resourceHeap, RHINativeObject samplerHeap) noexcept override;
+	void BindConstantBuffer(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept override;
+	void BindShaderResource(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept override;
+	void BindDescriptorTable(std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept override;
+	void SetRootConstant(std::uint32_t rootParameterIndex, std::uint32_t value, std::uint32_t destOffset) noexcept override;
+
+	void SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv) noexcept override;
+	void ClearRenderTarget(RHICpuDescriptor rtv, const float color[4]) noexcept override;
+	void ClearDepthStencil(RHICpuDescriptor dsv, float depth, std::uint8_t stencil) noexcept override;
+
+	void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) noexcept override;
+	void SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept override;
+
+	void DrawIndexedInstanced(
+	    std::uint32_t indexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startIndexLocation,
+	    std::int32_t baseVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept override;
+
+	void DrawInstanced(
+	    std::uint32_t vertexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept override;
+
+	void TransitionResource(RHINativeObject resource, ResourceState before, ResourceState after) noexcept override;
+
+	void CopyBufferRegion(
+	    RHINativeObject dst,
+	    std::uint64_t dstOffset,
+	    RHINativeObject src,
+	    std::uint64_t srcOffset,
+	    std::uint64_t numBytes) noexcept override;
+
+	[[nodiscard]] void* GetNative() const noexcept override { return m_cmdList; }
+
+	/// Maps ResourceState to D3D12_RESOURCE_STATES.
+	[[nodiscard]] static D3D12_RESOURCE_STATES MapToD3D12State(ResourceState state) noexcept;
+
+  private:
+	ID3D12GraphicsCommandList* m_cmdList = nullptr;
+};
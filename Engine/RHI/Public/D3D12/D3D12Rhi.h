@@ -18,6 +18,7 @@
 //   // destructor releases all resources
 //
 // DESIGN:
+//   - D3D12 backend of RHIDevice: buffers, per-frame RHICommandLists, fences
 //   - RAII: constructor initializes, destructor cleans up
 //   - Getters return const& to internal ComPtr to avoid refcount churn
 //   - Per-frame command allocators for FramesInFlight buffering
@@ -36,10 +37,13 @@
 #include <dxgi1_6.h>
 #include <wrl/client.h>
 #include <memory>
+#include <vector>
 #include "RHIConfig.h"
+#include "RHIDevice.h"
 
 using Microsoft::WRL::ComPtr;
 
+class D3D12CommandList;
 #ifdef ENGINE_GPU_VALIDATION
 class D3D12DebugLayer;
 #endif
@@ -48,35 +52,61 @@ class D3D12DebugLayer;
 // D3D12Rhi
 // =============================================================================
 
-class D3D12Rhi final
+class D3D12Rhi final : public RHIDevice
 {
   public:
 	// Constructs and initializes device, command queue, allocators, and fences.
 	explicit D3D12Rhi(bool requireDXRSupport = false) noexcept;
 
 	// Releases all D3D12 resources.
-	~D3D12Rhi() noexcept;
+	~D3D12Rhi() noexcept override;
 
 	D3D12Rhi(const D3D12Rhi&) = delete;
 	D3D12Rhi& operator=(const D3D12Rhi&) = delete;
 	D3D12Rhi(D3D12Rhi&&) = delete;
 	D3D12Rhi& operator=(D3D12Rhi&&) = delete;
 
+	[[nodiscard]] RHIBackend GetBackend() const noexcept override { return RHIBackend::D3D12; }
+
+	// =========================================================================
+	// Buffers (RHIDevice)
+	// =========================================================================
+
+	// Creates a committed buffer. Upload buffers stay mapped until destroyed.
+	[[nodiscard]] RHIBufferHandle CreateBuffer(const RHIBufferDesc& desc) override;
+	void DestroyBuffer(RHIBufferHandle handle) noexcept override;
+	[[nodiscard]] void* GetMappedData(RHIBufferHandle handle) const noexcept override;
+	[[nodiscard]] RHIGpuAddress GetGPUAddress(RHIBufferHandle handle) const noexcept override;
+	[[nodiscard]] RHINativeObject GetNativeBuffer(RHIBufferHandle handle) const noexcept override { return {GetBufferResource(handle)}; }
+
+	// Underlying resource of a buffer (nullptr for stale handles).
+	[[nodiscard]] ID3D12Resource* GetBufferResource(RHIBufferHandle handle) const noexcept;
+
 	// =========================================================================
 	// Command Recording
 	// =========================================================================
 
 	// Resets the command allocator for the specified frame. Call at frame start.
-	void ResetCommandAllocator(uint32_t frameInFlightIndex) noexcept;
+	void ResetCommandAllocator(uint32_t frameInFlightIndex) noexcept override;
 
 	// Resets and reopens the command list for recording.
-	void ResetCommandList(uint32_t frameInFlightIndex) noexcept;
+	void ResetCommandList(uint32_t frameInFlightIndex) noexcept override;
 
 	// Closes the command list. Must be called before ExecuteCommandList().
-	void CloseCommandList(uint32_t frameInFlightIndex) noexcept;
+	void CloseCommandList(uint32_t frameInFlightIndex) noexcept override;
 
 	// Submits the closed command list to the GPU queue.
-	void ExecuteCommandList(uint32_t frameInFlightIndex) noexcept;
+	void ExecuteCommandList(uint32_t frameInFlightIndex) noexcept override;
+
+	// Backend-agnostic recording interface over the frame's command list.
+	[[nodiscard]] RHICommandList& GetRHICommandList(uint32_t frameInFlightIndex) noexcept override;
+
+	// Worker lists for parallel recording (own allocator each), spliced into
+	// the frame by SubmitWorkerCommandLists.
+	void BeginWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept override;
+	void CloseWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept override;
+	[[nodiscard]] RHICommandList& GetWorkerCommandList(uint32_t frameInFlightIndex, uint32_t worker) noexcept override;
+	void SubmitWorkerCommandLists(uint32_t frameInFlightIndex, uint32_t workerCount) noexcept override;
 
 	// Records a resource barrier for state transition.
 	void SetBarrier(
@@ -103,13 +133,19 @@ class D3D12Rhi final
 	// =========================================================================
 
 	// Signals the fence with the next value. Call at end of frame.
-	void Signal(uint32_t frameInFlightIndex) noexcept;
+	void Signal(uint32_t frameInFlightIndex) noexcept override;
 
 	// Blocks CPU until GPU completes work for specified frame.
-	void WaitForGPU(uint32_t frameInFlightIndex) noexcept;
+	void WaitForGPU(uint32_t frameInFlightIndex) noexcept override;
+
+	// Blocks CPU until GPU reaches the given fence value.
+	void WaitForFenceValue(uint64_t fenceValue) noexcept override;
 
 	// Signal and wait (convenience for shutdown/resize).
-	void Flush() noexcept;
+	void Flush() noexcept override;
+
+	// Highest fence value the GPU has reached.
+	[[nodiscard]] uint64_t GetCompletedFenceValue() const noexcept override;
 
 	// =========================================================================
 	// Device Capabilities
@@ -140,7 +176,10 @@ class D3D12Rhi final
 	// D3D12-Specific Fence Management
 	// =========================================================================
 
-	[[nodiscard]] uint64_t GetFenceValueForFrame(uint32_t frameInFlightIndex) const noexcept { return m_fenceValues[frameInFlightIndex]; }
+	[[nodiscard]] uint64_t GetFenceValueForFrame(uint32_t frameInFlightIndex) const noexcept override
+	{
+		return m_fenceValues[frameInFlightIndex];
+	}
 	void SetFenceValueForFrame(uint32_t frameInFlightIndex, uint64_t value) noexcept { m_fenceValues[frameInFlightIndex] = value; }
 	[[nodiscard]] HANDLE GetFenceEvent() const noexcept { return m_fenceEvent; }
 	[[nodiscard]] uint64_t GetNextFenceValue() const noexcept { return m_nextFenceValue; }
@@ -173,8 +212,27 @@ class D3D12Rhi final
 	ComPtr<ID3D12CommandQueue> m_cmdQueue = nullptr;
 	ComPtr<ID3D12CommandAllocator> m_cmdAllocator[RHISettings::FramesInFlight] = {};
 	ComPtr<ID3D12GraphicsCommandList7> m_cmdList[RHISettings::FramesInFlight] = {};
+	std::unique_ptr<D3D12CommandList> m_rhiCmdList[RHISettings::FramesInFlight];  // RHICommandList over m_cmdList
+
+	// Parallel recording: [frame][worker]
+	ComPtr<ID3D12CommandAllocator> m_workerAllocators[RHISettings::FramesInFlight][kMaxWorkerCommandLists] = {};
+	ComPtr<ID3D12GraphicsCommandList7> m_workerCmdLists[RHISettings::FramesInFlight][kMaxWorkerCommandLists] = {};
+	std::unique_ptr<D3D12CommandList> m_rhiWorkerCmdLists[RHISettings::FramesInFlight][kMaxWorkerCommandLists];
 	uint32_t m_currentFrameIndex = 0;  // Tracks current frame for methods that don't take frame index
 
+	// -------------------------------------------------------------------------
+	// Buffers created through RHIDevice (slot = handle index)
+	// -------------------------------------------------------------------------
+
+	struct BufferSlot
+	{
+		ComPtr<ID3D12Resource> resource;
+		void* mapped = nullptr;
+		uint32_t generation = 0;
+	};
+	std::vector<BufferSlot> m_buffers;
+	std::vector<uint32_t> m_freeBufferSlots;
+
 	// -------------------------------------------------------------------------
 	// Synchronization State
 	// -------------------------------------------------------------------------
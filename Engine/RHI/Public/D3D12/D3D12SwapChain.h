@@ -72,6 +72,9 @@ class D3D12SwapChain final
 	/// Clears the current render target view with the clear color.
 	void Clear();
 
+	/// Color the back buffer is cleared to.
+	static constexpr float kClearColor[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+
 	/// Transitions current buffer to render target state.
 	void SetRenderTargetState();
 
@@ -91,6 +94,9 @@ class D3D12SwapChain final
 	/// Returns the CPU descriptor handle for the current back buffer.
 	[[nodiscard]] D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle() const { return GetCPUHandle(m_frameInFlightIndex); }
 
+	/// Returns the current back buffer resource (for externally issued barriers).
+	[[nodiscard]] ID3D12Resource* GetCurrentBackBuffer() const noexcept { return m_buffers[m_frameInFlightIndex].Get(); }
+
 	/// Returns the current frame-in-flight index (0 to FramesInFlight-1).
 	[[nodiscard]] UINT GetFrameInFlightIndex() const { return m_frameInFlightIndex; }
 
@@ -1,118 +1,27 @@
 // ============================================================================
 // D3D12RootBindings.h
 // ----------------------------------------------------------------------------
-// Single source of truth for shader resource binding layout.
+// D3D12 additions to the binding layout in RHIRootBindings.h: the shader
+// visibility of each root parameter.
 //
 // USAGE:
-//   cmdList->SetGraphicsRootConstantBufferView(
-//       RootBindings::RootParam::PerFrame, gpuAddress);
+//   rootParameters[RootBindings::RootParam::PerFrame].InitAsConstantBufferView(
+//       RootBindings::CBRegister::PerFrame, 0, RootBindings::Visibility::PerFrame);
 //
 // SYNC WITH:
+//   - RHIRootBindings.h (root parameter indices and registers)
 //   - D3D12RootSignature.cpp (root signature creation)
-//   - ConstantBuffers.hlsli (HLSL register declarations)
-//   - Samplers.hlsli (sampler register declarations)
-//
-// LAYOUT:
-//   Root Param 0: PerFrame CBV (b0)
-//   Root Param 1: PerView CBV (b1)
-//   Root Param 2: PerObjectVS CBV (b2)
-//   Root Param 3: PerObjectPS CBV (b3)
-//   Root Param 4: Texture SRV table (t0)
-//   Root Param 5: Sampler table (s0-s26)
 // ============================================================================
 
 #pragma once
 
-#include <cstdint>
+#include "RHIRootBindings.h"
+
 #include <d3d12.h>
 
 namespace RootBindings
 {
 
-	// ========================================================================
-	// Root Parameter Indices
-	// ========================================================================
-
-	namespace RootParam
-	{
-		constexpr uint32_t PerFrame = 0;
-		constexpr uint32_t PerView = 1;
-		constexpr uint32_t PerObjectVS = 2;
-		constexpr uint32_t PerObjectPS = 3;
-		constexpr uint32_t TextureSRV = 4;
-		constexpr uint32_t SamplerTable = 5;
-
-		constexpr uint32_t Count = 6;
-	}  // namespace RootParam
-
-	// -----------------------------------------------------------------------------
-	// Constant Buffer Registers
-	// -----------------------------------------------------------------------------
-	namespace CBRegister
-	{
-		constexpr uint32_t PerFrame = 0;
-		constexpr uint32_t PerView = 1;
-		constexpr uint32_t PerObjectVS = 2;
-		constexpr uint32_t PerObjectPS = 3;
-	}  // namespace CBRegister
-
-	// -----------------------------------------------------------------------------
-	// Texture Registers
-	// -----------------------------------------------------------------------------
-	namespace SRVRegister
-	{
-		constexpr uint32_t BaseTexture = 0;
-	}  // namespace SRVRegister
-
-	// -----------------------------------------------------------------------------
-	// Sampler Registers
-	// -----------------------------------------------------------------------------
-	// Layout: [Point MinMag][Linear MinMag][Anisotropic]
-	// Each group: [MipPoint/MipLinear/NoMip] × [Wrap/Clamp/Mirror]
-	namespace SamplerRegister
-	{
-		// Point MinMag (s0-s8)
-		constexpr uint32_t PointMipPointWrap = 0;
-		constexpr uint32_t PointMipPointClamp = 1;
-		constexpr uint32_t PointMipPointMirror = 2;
-		constexpr uint32_t PointMipLinearWrap = 3;
-		constexpr uint32_t PointMipLinearClamp = 4;
-		constexpr uint32_t PointMipLinearMirror = 5;
-		constexpr uint32_t PointNoMipWrap = 6;
-		constexpr uint32_t PointNoMipClamp = 7;
-		constexpr uint32_t PointNoMipMirror = 8;
-
-		// Linear MinMag (s9-s17)
-		constexpr uint32_t LinearMipPointWrap = 9;
-		constexpr uint32_t LinearMipPointClamp = 10;
-		constexpr uint32_t LinearMipPointMirror = 11;
-		constexpr uint32_t LinearMipLinearWrap = 12;
-		constexpr uint32_t LinearMipLinearClamp = 13;
-		constexpr uint32_t LinearMipLinearMirror = 14;
-		constexpr uint32_t LinearNoMipWrap = 15;
-		constexpr uint32_t LinearNoMipClamp = 16;
-		constexpr uint32_t LinearNoMipMirror = 17;
-
-		// Anisotropic (s18-s32)
-		constexpr uint32_t Aniso1xWrap = 18;
-		constexpr uint32_t Aniso1xClamp = 19;
-		constexpr uint32_t Aniso1xMirror = 20;
-		constexpr uint32_t Aniso2xWrap = 21;
-		constexpr uint32_t Aniso2xClamp = 22;
-		constexpr uint32_t Aniso2xMirror = 23;
-		constexpr uint32_t Aniso4xWrap = 24;
-		constexpr uint32_t Aniso4xClamp = 25;
-		constexpr uint32_t Aniso4xMirror = 26;
-		constexpr uint32_t Aniso8xWrap = 27;
-		constexpr uint32_t Aniso8xClamp = 28;
-		constexpr uint32_t Aniso8xMirror = 29;
-		constexpr uint32_t Aniso16xWrap = 30;
-		constexpr uint32_t Aniso16xClamp = 31;
-		constexpr uint32_t Aniso16xMirror = 32;
-
-		constexpr uint32_t Count = 33;
-	}  // namespace SamplerRegister
-
 	// -----------------------------------------------------------------------------
 	// Shader Visibility
 	// -----------------------------------------------------------------------------
@@ -120,10 +29,12 @@ namespace RootBindings
 	{
 		constexpr D3D12_SHADER_VISIBILITY PerFrame = D3D12_SHADER_VISIBILITY_ALL;
 		constexpr D3D12_SHADER_VISIBILITY PerView = D3D12_SHADER_VISIBILITY_ALL;
-		constexpr D3D12_SHADER_VISIBILITY PerObjectVS = D3D12_SHADER_VISIBILITY_VERTEX;
-		constexpr D3D12_SHADER_VISIBILITY PerObjectPS = D3D12_SHADER_VISIBILITY_PIXEL;
+		constexpr D3D12_SHADER_VISIBILITY ObjectData = D3D12_SHADER_VISIBILITY_VERTEX;
+		constexpr D3D12_SHADER_VISIBILITY MaterialIndex = D3D12_SHADER_VISIBILITY_PIXEL;
 		constexpr D3D12_SHADER_VISIBILITY TextureSRV = D3D12_SHADER_VISIBILITY_PIXEL;
 		constexpr D3D12_SHADER_VISIBILITY SamplerTable = D3D12_SHADER_VISIBILITY_PIXEL;
+		constexpr D3D12_SHADER_VISIBILITY InstanceObjectIds = D3D12_SHADER_VISIBILITY_VERTEX;
+		constexpr D3D12_SHADER_VISIBILITY MaterialTable = D3D12_SHADER_VISIBILITY_PIXEL;
 	}  // namespace Visibility
 
 }  // namespace RootBindings
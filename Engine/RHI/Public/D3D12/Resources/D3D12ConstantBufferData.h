@@ -11,8 +11,10 @@
 // HLSL REGISTER CONVENTIONS:
 //   b0 -> PerFrameConstantBufferData   (once per CPU frame)
 //   b1 -> PerViewConstantBufferData    (per camera/view)
-//   b2 -> PerObjectVSConstantBufferData (per draw call, transforms)
-//   b3 -> PerObjectPSConstantBufferData (per draw call, materials)
+//   b3 -> uint material index          (root constant, per instanced draw)
+//   t1 -> PerObjectData[]              (structured buffer, indexed by object ID)
+//   t2 -> uint[]                       (structured buffer, instance -> object ID)
+//   t3 -> MaterialRecord[]             (structured buffer, indexed by material ID)
 //
 // NOTES:
 //   - Keep parity with Common.hlsli when modifying
@@ -81,33 +83,30 @@ struct alignas(256) PerViewConstantBufferData
 CBV_CHECK(PerViewConstantBufferData);
 
 //------------------------------------------------------------------------------
-// Per-Object VS CB (b2) — updated per draw call (transforms)
+// Material Record (t3, structured buffer element) — one per material
 //------------------------------------------------------------------------------
-struct alignas(256) PerObjectVSConstantBufferData
+// Indexed by material ID; the draw selects one through the b3 root constant.
+struct MaterialRecord
 {
-	DirectX::XMFLOAT4X4 WorldMTX;              // Local -> World
-	DirectX::XMFLOAT3X4 WorldInvTransposeMTX;  // Normal matrix (inverse-transpose, 3x4 = 48 bytes matches HLSL float3x3 cbuffer packing)
+	DirectX::XMFLOAT4 BaseColor;     // RGBA base/albedo color or tint
 
-	// remaining space in the 256-byte slot is reserved for future use
+	float Metallic;                  // PBR metallic [0,1]
+	float Roughness;                 // PBR roughness [0,1]
+	float F0;                        // PBR reflectance at normal incidence
+	std::uint32_t AlbedoTextureIdx;  // UINT32_MAX = no texture bound
 };
-CBV_CHECK(PerObjectVSConstantBufferData);
+static_assert(std::is_trivially_copyable_v<MaterialRecord>, "MaterialRecord must be trivially-copyable");
+static_assert(sizeof(MaterialRecord) == 32, "MaterialRecord must match HLSL StructuredBuffer stride");
+
 //------------------------------------------------------------------------------
-// Per-Object PS CB (b3) — updated per draw call (material scalars)
+// Per-Object Data (t1, structured buffer element) — one per scene object
 //------------------------------------------------------------------------------
-struct alignas(256) PerObjectPSConstantBufferData
+// Indexed by object ID; the instance ID buffer (t2) maps SV_InstanceID to it.
+struct PerObjectData
 {
-	DirectX::XMFLOAT4 BaseColor;  // RGBA base/albedo color or tint
-
-	float Metallic;          // PBR metallic [0,1]
-	float Roughness;         // PBR roughness [0,1]
-	float F0;                // PBR reflectance at normal incidence
-	float _padPerObjectPS0;  // pad to 16 bytes
-
-	// remaining space reserved
+	DirectX::XMFLOAT4X4 WorldMTX;              // Local -> World
+	DirectX::XMFLOAT3X4 WorldInvTransposeMTX;  // Normal matrix (inverse-transpose; HLSL float3x4, upper 3x3 used)
 };
-CBV_CHECK(PerObjectPSConstantBufferData);
-
-//------------------------------------------------------------------------------
-// Per-Instance Data (structured buffer element) — updated per instance
-// TODO: Implement when instanced rendering is needed
-//------------------------------------------------------------------------------
+static_assert(std::is_trivially_copyable_v<PerObjectData>, "PerObjectData must be trivially-copyable");
+static_assert(sizeof(PerObjectData) == 112, "PerObjectData must match HLSL StructuredBuffer stride");
+static_assert(sizeof(PerObjectData) % 16 == 0, "PerObjectData must keep 16-byte element alignment");
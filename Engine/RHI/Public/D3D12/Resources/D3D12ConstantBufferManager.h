@@ -12,12 +12,11 @@
 //     Use persistent ConstantBuffer<T> instances (one per frame-in-flight).
 //     Updated once per frame, bound to root CBV slots.
 //
-//   Per-Object CBs:
-//     Use FrameResourceManager's linear allocator for suballocation per-draw.
-//     UpdatePerObjectXXX() returns a unique GPU VA per call.
+//   Per-object data is not in CBs: transforms live in the renderer's
+//   persistent object buffer (PerObjectData, t1) and materials in its
+//   material table (MaterialRecord, t3), selected by a root constant (b3).
 //
 // NOTES:
-//   - Per-object allocations are thread-safe (atomic linear allocator)
 //   - Per-frame/per-view updates should be called from main thread
 // ============================================================================
 #pragma once
@@ -33,7 +32,6 @@ class Timer;
 class Window;
 class D3D12Rhi;
 class D3D12DescriptorHeapManager;
-class D3D12FrameResourceManager;
 class D3D12SwapChain;
 class UI;
 
@@ -45,7 +43,6 @@ class D3D12ConstantBufferManager final
 	    D3D12Rhi& rhi,
 	    Window& window,
 	    D3D12DescriptorHeapManager& descriptorHeapManager,
-	    D3D12FrameResourceManager& frameResourceManager,
 	    D3D12SwapChain& swapChain,
 	    UI& ui);
 	~D3D12ConstantBufferManager() noexcept;
@@ -75,13 +72,6 @@ class D3D12ConstantBufferManager final
 	// Update per-view constant buffer. Call once per camera/view.
 	void UpdatePerView(const PerViewConstantBufferData& data);
 
-	// Update per-object VS constant buffer for a draw.
-	// Any system can provide this data (Primitive, SkeletalMesh, etc.) without coupling.
-	[[nodiscard]] D3D12_GPU_VIRTUAL_ADDRESS UpdatePerObjectVS(const PerObjectVSConstantBufferData& data);
-
-	// Update per-object PS constant buffer (material data).
-	[[nodiscard]] D3D12_GPU_VIRTUAL_ADDRESS UpdatePerObjectPS(const PerObjectPSConstantBufferData& data);
-
   private:
 	// Per-Frame constant buffers (persistent, one per frame-in-flight)
 	std::unique_ptr<D3D12ConstantBuffer<PerFrameConstantBufferData>> m_perFrameCB[RHISettings::FramesInFlight];
@@ -91,7 +81,6 @@ class D3D12ConstantBufferManager final
 
 	Timer* m_timer = nullptr;
 	Window* m_window = nullptr;
-	D3D12FrameResourceManager* m_frameResourceManager = nullptr;
 	D3D12SwapChain* m_swapChain = nullptr;
 	UI* m_ui = nullptr;
 };
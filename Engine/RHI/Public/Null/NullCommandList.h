@@ -0,0 +1,160 @@
+// ============================================================================
+// NullCommandList.h
+// ----------------------------------------------------------------------------
+// RHICommandList that records nothing: it validates and counts commands.
+//
+// PURPOSE:
+//   Lets FrameGraph and pass recording run without a GPU. Every command is
+//   checked against the state a real command list would need (recording
+//   open, pipeline and targets bound, index range inside the bound buffer,
+//   barrier "before" state matching the tracked state) and tallied.
+//
+// USAGE:
+//   NullRhi rhi;
+//   rhi.ResetCommandList(0);
+//   RenderContext context(rhi.GetRHICommandList(0));
+//   frameGraph.Execute(context);
+//   rhi.CloseCommandList(0);
+//   const NullCommandStats& stats = rhi.GetCommandStats(0);
+//
+// NOTES:
+//   - Counters accumulate until ResetStats(); validation state is cleared on
+//     every ResetCommandList, like a real command list
+//   - The first few validation failures are logged, later ones only counted
+// ============================================================================
+
+#pragma once
+
+#include "RHICommandList.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+class NullRhi;
+
+// ============================================================================
+// NullCommandStats
+// ============================================================================
+
+struct NullCommandStats
+{
+	std::uint64_t drawCalls = 0;
+	std::uint64_t instances = 0;           // Sum of instanceCount over all draws
+	std::uint64_t indices = 0;             // Indices per instance, summed over draws
+	std::uint64_t vertices = 0;            // Non-indexed vertices per instance, summed over draws
+	std::uint64_t indexBytesRead = 0;      // indices * index size
+	std::uint64_t pipelineBinds = 0;       // Pipeline state + root signature
+	std::uint64_t bufferBinds = 0;         // VB / IB / CBV / SRV root binds
+	std::uint64_t descriptorHeapBinds = 0;  // SetDescriptorHeaps calls
+	std::uint64_t descriptorTableBinds = 0;
+	std::uint64_t rootConstants = 0;       // 32-bit root constants set
+	std::uint64_t barriers = 0;
+	std::uint64_t copies = 0;             // CopyBufferRegion calls
+	std::uint64_t bytesCopied = 0;
+	std::uint64_t clears = 0;
+	std::uint64_t validationErrors = 0;
+};
+
+// ============================================================================
+// NullCommandList
+// ============================================================================
+
+class NullCommandList final : public RHICommandList
+{
+  public:
+	explicit NullCommandList(const NullRhi& device) noexcept;
+	~NullCommandList() noexcept override = default;
+
+	NullCommandList(const NullCommandList&) = delete;
+	NullCommandList& operator=(const NullCommandList&) = delete;
+	NullCommandList(NullCommandList&&) = delete;
+	NullCommandList& operator=(NullCommandList&&) = delete;
+
+	// -------------------------------------------------------------------------
+	// Lifetime (driven by NullRhi)
+	// -------------------------------------------------------------------------
+
+	void Begin() noexcept;
+	void End() noexcept;
+	[[nodiscard]] bool IsRecording() const noexcept { return m_bRecording; }
+
+	// -------------------------------------------------------------------------
+	// RHICommandList
+	// -------------------------------------------------------------------------
+
+	void SetPipelineState(RHINativeObject pipelineState) noexcept override;
+	void SetRootSignature(RHINativeObject rootSignature) noexcept override;
+
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) noexcept override;
+	void BindVertexBuffer(const RHIVertexBufferView& view) noexcept override;
+	void BindIndexBuffer(const RHIIndexBufferView& view) noexcept override;
+
+	void SetDescriptorHeaps(RHINativeObject resourceHeap, RHINativeObject samplerHeap) noexcept override;
+	void BindConstantBuffer(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept override;
+	void BindShaderResource(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept override;
+	void BindDescriptorTable(std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept override;
+	void SetRootConstant(std::uint32_t rootParameterIndex, std::uint32_t value, std::uint32_t destOffset) noexcept override;
+
+	void SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv) noexcept override;
+	void ClearRenderTarget(RHICpuDescriptor rtv, const float color[4]) noexcept override;
+	void ClearDepthStencil(RHICpuDescriptor dsv, float depth, std::uint8_t stencil) noexcept override;
+
+	void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) noexcept override;
+	void SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept override;
+
+	void DrawIndexedInstanced(
+	    std::uint32_t indexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startIndexLocation,
+	    std::int32_t baseVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept override;
+
+	void DrawInstanced(
+	    std::uint32_t vertexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept override;
+
+	void TransitionResource(RHINativeObject resource, ResourceState before, ResourceState after) noexcept override;
+
+	void CopyBufferRegion(
+	    RHINativeObject dst,
+	    std::uint64_t dstOffset,
+	    RHINativeObject src,
+	    std::uint64_t srcOffset,
+	    std::uint64_t numBytes) noexcept override;
+
+	[[nodiscard]] void* GetNative() const noexcept override { return nullptr; }
+
+	// -------------------------------------------------------------------------
+	// Stats
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] const NullCommandStats& GetStats() const noexcept { return m_stats; }
+	void ResetStats() noexcept { m_stats = {}; }
+
+	/// Resource states as last transitioned (persist across command lists).
+	[[nodiscard]] const std::unordered_map<void*, ResourceState>& GetTrackedStates() const noexcept { return m_resourceStates; }
+
+  private:
+	/// Counts (and logs the first few) failed checks. Returns condition.
+	bool Validate(bool condition, const char* message) noexcept;
+	bool ValidateDrawState() noexcept;
+
+	const NullRhi* m_device = nullptr;
+	NullCommandStats m_stats;
+
+	// Bound state (cleared by Begin)
+	bool m_bRecording = false;
+	bool m_bPipelineBound = false;
+	bool m_bRootSignatureBound = false;
+	bool m_bDescriptorHeapsSet = false;
+	bool m_bViewportSet = false;
+	bool m_bScissorSet = false;
+	std::uint32_t m_renderTargetCount = 0;
+	bool m_bDepthBound = false;
+	RHIVertexBufferView m_vertexBuffer;
+	RHIIndexBufferView m_indexBuffer;
+
+	std::unordered_map<void*, ResourceState> m_resourceStates;
+};
@@ -0,0 +1,185 @@
+// ============================================================================
+// NullRhi.h
+// ----------------------------------------------------------------------------
+// RHIDevice without a GPU, for headless runs, CI and CPU profiling.
+//
+// PURPOSE:
+//   Stands in for D3D12Rhi wherever renderer code only needs buffers,
+//   command recording and fences. Upload buffers are plain host memory, GPU
+//   addresses are synthetic but resolvable, and fences complete as soon as
+//   they are signaled — or, with manual fence completion, only when told
+//   to, which stands in for GPU latency when testing fence-tracked retirement.
+//
+// USAGE:
+//   NullRhi rhi;
+//   RHIBuffer buffer(rhi, {1024, RHIHeapType::Upload, L"Test"});
+//   rhi.ResetCommandList(frameIndex);
+//   ... record through rhi.GetRHICommandList(frameIndex) ...
+//   rhi.CloseCommandList(frameIndex);
+//   rhi.ExecuteCommandList(frameIndex);
+//   rhi.Signal(frameIndex);
+//
+// DESIGN:
+//   - GPU address = (slot + 1) << kAddressSlotShift | offset, so any bound
+//     address can be traced back to a live buffer and range-checked
+//   - Default-heap buffers get an address range but no backing memory
+//   - Byte counters track live / peak buffer memory for memory budgeting
+// ============================================================================
+
+#pragma once
+
+#include "RHIDevice.h"
+#include "RHIConfig.h"
+#include "Null/NullCommandList.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+// ============================================================================
+// NullDeviceStats
+// ============================================================================
+
+struct NullDeviceStats
+{
+	std::uint64_t buffersCreated = 0;
+	std::uint64_t buffersLive = 0;
+	std::uint64_t bufferBytesLive = 0;
+	std::uint64_t bufferBytesPeak = 0;
+	std::uint64_t submissions = 0;       // ExecuteCommandList / SubmitWorkerCommandLists calls
+	std::uint64_t validationErrors = 0;  // Device-level misuse (bad handles, submit while recording)
+};
+
+/// One command list handed to the queue (see NullRhi::SetSubmissionLogging).
+struct NullSubmission
+{
+	bool bWorker = false;       // Worker list, or the frame's own list
+	std::uint32_t worker = 0;   // Worker index when bWorker
+	NullCommandStats stats;     // The list's counters at submission
+};
+
+// ============================================================================
+// NullRhi
+// ============================================================================
+
+class NullRhi final : public RHIDevice
+{
+  public:
+	/// Bits of a synthetic GPU address that hold the byte offset (1 TiB per buffer).
+	static constexpr std::uint32_t kAddressSlotShift = 40;
+
+	NullRhi();
+	~NullRhi() noexcept override = default;
+
+	NullRhi(const NullRhi&) = delete;
+	NullRhi& operator=(const NullRhi&) = delete;
+	NullRhi(NullRhi&&) = delete;
+	NullRhi& operator=(NullRhi&&) = delete;
+
+	[[nodiscard]] RHIBackend GetBackend() const noexcept override { return RHIBackend::Null; }
+
+	// -------------------------------------------------------------------------
+	// Buffers
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] RHIBufferHandle CreateBuffer(const RHIBufferDesc& desc) override;
+	void DestroyBuffer(RHIBufferHandle handle) noexcept override;
+	[[nodiscard]] void* GetMappedData(RHIBufferHandle handle) const noexcept override;
+	[[nodiscard]] RHIGpuAddress GetGPUAddress(RHIBufferHandle handle) const noexcept override;
+
+	/// The buffer's synthetic GPU address, reinterpreted: stable per slot and
+	/// resolvable by NullCommandList through IsAddressRangeValid.
+	[[nodiscard]] RHINativeObject GetNativeBuffer(RHIBufferHandle handle) const noexcept override;
+
+	/// True when [address, address + size) lies inside one live buffer.
+	[[nodiscard]] bool IsAddressRangeValid(RHIGpuAddress address, std::uint64_t size) const noexcept;
+
+	// -------------------------------------------------------------------------
+	// Command Recording
+	// -------------------------------------------------------------------------
+
+	void ResetCommandAllocator(std::uint32_t frameInFlightIndex) noexcept override;
+	void ResetCommandList(std::uint32_t frameInFlightIndex) noexcept override;
+	void CloseCommandList(std::uint32_t frameInFlightIndex) noexcept override;
+	void ExecuteCommandList(std::uint32_t frameInFlightIndex) noexcept override;
+	[[nodiscard]] RHICommandList& GetRHICommandList(std::uint32_t frameInFlightIndex) noexcept override;
+
+	void BeginWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept override;
+	void CloseWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept override;
+	[[nodiscard]] RHICommandList& GetWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept override;
+	void SubmitWorkerCommandLists(std::uint32_t frameInFlightIndex, std::uint32_t workerCount) noexcept override;
+
+	// -------------------------------------------------------------------------
+	// Synchronization (fences complete immediately unless manual)
+	// -------------------------------------------------------------------------
+
+	void Signal(std::uint32_t frameInFlightIndex) noexcept override;
+	void WaitForGPU(std::uint32_t frameInFlightIndex) noexcept override;
+	void Flush() noexcept override;
+
+	/// With manual completion this is the "GPU" catching up to fenceValue.
+	void WaitForFenceValue(std::uint64_t fenceValue) noexcept override;
+
+	/// When enabled, Signal only stamps values; CompleteFenceValue (or a wait)
+	/// advances the completed value.
+	void SetManualFenceCompletion(bool bManual) noexcept { m_bManualFenceCompletion = bManual; }
+	void CompleteFenceValue(std::uint64_t fenceValue) noexcept;
+	[[nodiscard]] std::uint64_t GetCompletedFenceValue() const noexcept override { return m_completedFenceValue; }
+	[[nodiscard]] std::uint64_t GetFenceValueForFrame(std::uint32_t frameInFlightIndex) const noexcept override
+	{
+		return m_fenceValues[frameInFlightIndex];
+	}
+
+	// -------------------------------------------------------------------------
+	// Stats
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] const NullDeviceStats& GetDeviceStats() const noexcept { return m_stats; }
+	[[nodiscard]] const NullCommandStats& GetCommandStats(std::uint32_t frameInFlightIndex) const noexcept
+	{
+		return m_commandLists[frameInFlightIndex]->GetStats();
+	}
+	[[nodiscard]] const NullCommandStats& GetWorkerCommandStats(std::uint32_t frameInFlightIndex, std::uint32_t worker) const noexcept
+	{
+		return m_workerCommandLists[frameInFlightIndex][worker]->GetStats();
+	}
+
+	/// When enabled, every submitted command list is appended to the
+	/// submission log in queue order (off by default: the log only grows).
+	void SetSubmissionLogging(bool bEnabled) noexcept { m_bLogSubmissions = bEnabled; }
+	[[nodiscard]] std::span<const NullSubmission> GetSubmissionLog() const noexcept { return m_submissionLog; }
+	void ClearSubmissionLog() noexcept { m_submissionLog.clear(); }
+
+	/// Device plus all command list validation failures.
+	[[nodiscard]] std::uint64_t GetValidationErrorCount() const noexcept;
+
+  private:
+	struct Buffer
+	{
+		std::unique_ptr<std::byte[]> data;  // Upload heap only
+		std::uint64_t size = 0;
+		std::uint32_t generation = 0;
+		bool bLive = false;
+	};
+
+	[[nodiscard]] const Buffer* Resolve(RHIBufferHandle handle) const noexcept;
+	void ReportError(const char* message) noexcept;
+
+	std::vector<Buffer> m_buffers;
+	std::vector<std::uint32_t> m_freeSlots;
+	std::array<std::unique_ptr<NullCommandList>, RHISettings::FramesInFlight> m_commandLists;
+	std::array<std::array<std::unique_ptr<NullCommandList>, kMaxWorkerCommandLists>, RHISettings::FramesInFlight> m_workerCommandLists;
+
+	std::array<std::uint64_t, RHISettings::FramesInFlight> m_fenceValues{};
+	std::uint64_t m_nextFenceValue = 1;
+	std::uint64_t m_completedFenceValue = 0;
+	bool m_bManualFenceCompletion = false;
+
+	std::vector<NullSubmission> m_submissionLog;
+	bool m_bLogSubmissions = false;
+
+	NullDeviceStats m_stats;
+};
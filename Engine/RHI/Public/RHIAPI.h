@@ -2,7 +2,9 @@
 #pragma once
 
 // DLL export/import configuration
-#ifdef SPARKLE_RHI_EXPORTS
+#if !defined(_WIN32)
+	#define SPARKLE_RHI_API __attribute__((visibility("default")))
+#elif defined(SPARKLE_RHI_EXPORTS)
 	#define SPARKLE_RHI_API __declspec(dllexport)
 #else
 	#define SPARKLE_RHI_API __declspec(dllimport)
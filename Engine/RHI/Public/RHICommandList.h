@@ -0,0 +1,125 @@
+// ============================================================================
+// RHICommandList.h
+// ----------------------------------------------------------------------------
+// Backend-agnostic graphics command recording interface.
+//
+// PURPOSE:
+//   The command surface render passes actually use, with one implementation
+//   per backend. RenderContext forwards to it, so pass recording code runs
+//   unchanged on D3D12 and on the Null backend.
+//
+// USAGE:
+//   RHICommandList& cmd = device.GetRHICommandList(frameIndex);
+//   cmd.SetRootSignature(RHINativeObject{rootSig});
+//   cmd.BindVertexBuffer(mesh.GetVertexBufferView());
+//   cmd.DrawIndexedInstanced(indexCount, 1, 0, 0, 0);
+//
+// DESIGN:
+//   - Mirrors the subset of ID3D12GraphicsCommandList the renderer records
+//   - Lifetime (reset / close / submit) is driven through RHIDevice
+//   - GetNative() is the escape hatch for backend-specific code (ImGui, etc.)
+// ============================================================================
+
+#pragma once
+
+#include "RHITypes.h"
+#include "RHIResourceState.h"
+
+#include <cstdint>
+
+// ============================================================================
+// RHICommandList
+// ============================================================================
+
+class RHICommandList
+{
+  public:
+	virtual ~RHICommandList() noexcept = default;
+
+	// -------------------------------------------------------------------------
+	// Pipeline State
+	// -------------------------------------------------------------------------
+
+	virtual void SetPipelineState(RHINativeObject pipelineState) noexcept = 0;
+	virtual void SetRootSignature(RHINativeObject rootSignature) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Input Assembly
+	// -------------------------------------------------------------------------
+
+	virtual void SetPrimitiveTopology(RHIPrimitiveTopology topology) noexcept = 0;
+	virtual void BindVertexBuffer(const RHIVertexBufferView& view) noexcept = 0;
+	virtual void BindIndexBuffer(const RHIIndexBufferView& view) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Resource Binding
+	// -------------------------------------------------------------------------
+
+	/// Makes the shader-visible heaps current; descriptor tables index into them.
+	/// @param samplerHeap Sampler heap, or null for none
+	virtual void SetDescriptorHeaps(RHINativeObject resourceHeap, RHINativeObject samplerHeap) noexcept = 0;
+
+	virtual void BindConstantBuffer(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept = 0;
+	virtual void BindShaderResource(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept = 0;
+	virtual void BindDescriptorTable(std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept = 0;
+	virtual void SetRootConstant(std::uint32_t rootParameterIndex, std::uint32_t value, std::uint32_t destOffset) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Render Targets
+	// -------------------------------------------------------------------------
+
+	/// @param dsv Depth-stencil view, or nullptr for none
+	virtual void SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv) noexcept = 0;
+	virtual void ClearRenderTarget(RHICpuDescriptor rtv, const float color[4]) noexcept = 0;
+	virtual void ClearDepthStencil(RHICpuDescriptor dsv, float depth, std::uint8_t stencil) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Viewport & Scissor
+	// -------------------------------------------------------------------------
+
+	virtual void SetViewport(float x, float y, float width, float height, float minDepth, float maxDepth) noexcept = 0;
+	virtual void SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Draw Commands
+	// -------------------------------------------------------------------------
+
+	virtual void DrawIndexedInstanced(
+	    std::uint32_t indexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startIndexLocation,
+	    std::int32_t baseVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept = 0;
+
+	virtual void DrawInstanced(
+	    std::uint32_t vertexCountPerInstance,
+	    std::uint32_t instanceCount,
+	    std::uint32_t startVertexLocation,
+	    std::uint32_t startInstanceLocation) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Resource Barriers
+	// -------------------------------------------------------------------------
+
+	virtual void TransitionResource(RHINativeObject resource, ResourceState before, ResourceState after) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Copies
+	// -------------------------------------------------------------------------
+
+	/// Copies numBytes between buffers (see RHIDevice::GetNativeBuffer). The
+	/// destination must be in CopyDest (or Common, promoted implicitly).
+	virtual void CopyBufferRegion(
+	    RHINativeObject dst,
+	    std::uint64_t dstOffset,
+	    RHINativeObject src,
+	    std::uint64_t srcOffset,
+	    std::uint64_t numBytes) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Native Access
+	// -------------------------------------------------------------------------
+
+	/// Backend command list (ID3D12GraphicsCommandList* on D3D12, nullptr on Null).
+	[[nodiscard]] virtual void* GetNative() const noexcept = 0;
+};
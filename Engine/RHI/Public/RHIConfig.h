@@ -15,7 +15,9 @@
 
 #pragma once
 
-#include <dxgi1_6.h>
+#if defined(_WIN32)
+	#include <dxgi1_6.h>
+#endif
 
 // ============================================================================
 // Compile-Time Feature Toggles
@@ -51,11 +53,13 @@ namespace RHISettings
 	/// Higher values reduce CPU-GPU sync but increase latency and memory.
 	inline constexpr unsigned FramesInFlight = 2u;
 
+#if defined(_WIN32)
 	/// Back buffer pixel format.
 	inline constexpr DXGI_FORMAT BackBufferFormat = DXGI_FORMAT_R8G8B8A8_UNORM;
 
 	/// Depth stencil buffer format.
 	inline constexpr DXGI_FORMAT DepthStencilFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+#endif
 
 	/// Enable vertical sync. False allows uncapped presents or tearing.
 	inline bool VSync = true;
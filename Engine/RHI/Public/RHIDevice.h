@@ -0,0 +1,145 @@
+// ============================================================================
+// RHIDevice.h
+// ----------------------------------------------------------------------------
+// Backend-agnostic device interface: buffers, command lists and fences.
+//
+// PURPOSE:
+//   Lets renderer code that only needs buffers, command recording and frame
+//   synchronization run on any backend. D3D12Rhi implements it for the GPU;
+//   NullRhi implements it without one, so the CPU side of the renderer can be
+//   built, profiled and validated headless.
+//
+// USAGE:
+//   RHIBuffer buffer(device, {size, RHIHeapType::Upload, L"MyBuffer"});
+//   std::memcpy(buffer.GetMappedData(), data, size);
+//   device.GetRHICommandList(frameIndex).BindShaderResource(slot, buffer.GetGPUAddress());
+//
+// DESIGN:
+//   - One command list per frame in flight, driven through Reset/Close/Execute
+//   - Plus kMaxWorkerCommandLists worker lists per frame, each with its own
+//     allocator, for recording on several threads. SubmitWorkerCommandLists
+//     splices them into the frame: frame list so far, workers in index order,
+//     then the frame list continues
+//   - Fences follow the existing per-frame model: Signal(frame) stamps the
+//     frame's fence value, WaitForGPU(frame) blocks until it completed.
+//     WaitForFenceValue waits for any stamped value (upload tickets)
+//   - Buffers are addressed by generational handles; RHIBuffer owns one
+//
+// NOTES:
+//   - DestroyBuffer releases immediately; callers only destroy buffers whose
+//     last GPU use has completed (same rule as before the interface)
+// ============================================================================
+
+#pragma once
+
+#include "RHITypes.h"
+
+#include <cstdint>
+
+class RHICommandList;
+
+// ============================================================================
+// RHIDevice
+// ============================================================================
+
+class RHIDevice
+{
+  public:
+	virtual ~RHIDevice() noexcept = default;
+
+	[[nodiscard]] virtual RHIBackend GetBackend() const noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Buffers
+	// -------------------------------------------------------------------------
+
+	/// Creates a buffer. Upload buffers are mapped until destroyed.
+	/// @return Invalid handle on failure (logged)
+	[[nodiscard]] virtual RHIBufferHandle CreateBuffer(const RHIBufferDesc& desc) = 0;
+	virtual void DestroyBuffer(RHIBufferHandle handle) noexcept = 0;
+
+	/// CPU pointer of an upload buffer (nullptr for default-heap buffers).
+	[[nodiscard]] virtual void* GetMappedData(RHIBufferHandle handle) const noexcept = 0;
+	[[nodiscard]] virtual RHIGpuAddress GetGPUAddress(RHIBufferHandle handle) const noexcept = 0;
+
+	/// Backend object of a buffer for barriers and copies (null for stale handles).
+	[[nodiscard]] virtual RHINativeObject GetNativeBuffer(RHIBufferHandle handle) const noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Command Recording
+	// -------------------------------------------------------------------------
+
+	virtual void ResetCommandAllocator(std::uint32_t frameInFlightIndex) noexcept = 0;
+	virtual void ResetCommandList(std::uint32_t frameInFlightIndex) noexcept = 0;
+	virtual void CloseCommandList(std::uint32_t frameInFlightIndex) noexcept = 0;
+	virtual void ExecuteCommandList(std::uint32_t frameInFlightIndex) noexcept = 0;
+
+	[[nodiscard]] virtual RHICommandList& GetRHICommandList(std::uint32_t frameInFlightIndex) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Worker Command Lists (parallel recording)
+	// -------------------------------------------------------------------------
+
+	static constexpr std::uint32_t kMaxWorkerCommandLists = 8;
+
+	/// Resets a worker list's allocator and opens the list. The frame's previous
+	/// submission of it must have completed (same rule as the frame list).
+	virtual void BeginWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept = 0;
+	virtual void CloseWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept = 0;
+
+	/// A worker list may be recorded on any thread, by one thread at a time.
+	[[nodiscard]] virtual RHICommandList& GetWorkerCommandList(std::uint32_t frameInFlightIndex, std::uint32_t worker) noexcept = 0;
+
+	/// Closes and submits the frame list recorded so far, then closed worker
+	/// lists [0, workerCount) in order, and reopens the frame list. Worker lists
+	/// inherit no state: each must bind its own pipeline, targets and heaps.
+	virtual void SubmitWorkerCommandLists(std::uint32_t frameInFlightIndex, std::uint32_t workerCount) noexcept = 0;
+
+	// -------------------------------------------------------------------------
+	// Synchronization
+	// -------------------------------------------------------------------------
+
+	virtual void Signal(std::uint32_t frameInFlightIndex) noexcept = 0;
+	virtual void WaitForGPU(std::uint32_t frameInFlightIndex) noexcept = 0;
+	virtual void Flush() noexcept = 0;
+
+	/// Blocks until the GPU has finished fenceValue (one stamped by Signal).
+	virtual void WaitForFenceValue(std::uint64_t fenceValue) noexcept = 0;
+
+	/// Highest fence value the GPU has finished.
+	[[nodiscard]] virtual std::uint64_t GetCompletedFenceValue() const noexcept = 0;
+	[[nodiscard]] virtual std::uint64_t GetFenceValueForFrame(std::uint32_t frameInFlightIndex) const noexcept = 0;
+};
+
+// ============================================================================
+// RHIBuffer — owning, move-only wrapper around an RHIBufferHandle
+// ============================================================================
+
+class RHIBuffer final
+{
+  public:
+	RHIBuffer() noexcept = default;
+	RHIBuffer(RHIDevice& device, const RHIBufferDesc& desc);
+	~RHIBuffer() noexcept { Reset(); }
+
+	RHIBuffer(const RHIBuffer&) = delete;
+	RHIBuffer& operator=(const RHIBuffer&) = delete;
+	RHIBuffer(RHIBuffer&& other) noexcept;
+	RHIBuffer& operator=(RHIBuffer&& other) noexcept;
+
+	/// Destroys the buffer (no-op when empty).
+	void Reset() noexcept;
+
+	[[nodiscard]] bool IsValid() const noexcept { return m_handle.IsValid(); }
+	[[nodiscard]] RHIBufferHandle GetHandle() const noexcept { return m_handle; }
+	[[nodiscard]] std::uint64_t GetSize() const noexcept { return m_size; }
+	[[nodiscard]] void* GetMappedData() const noexcept { return m_mapped; }
+	[[nodiscard]] RHIGpuAddress GetGPUAddress() const noexcept { return m_gpuAddress; }
+
+  private:
+	RHIDevice* m_device = nullptr;
+	RHIBufferHandle m_handle;
+	std::uint64_t m_size = 0;
+	void* m_mapped = nullptr;  // Cached — stable for the buffer's lifetime
+	RHIGpuAddress m_gpuAddress = 0;
+};
@@ -1,12 +1,13 @@
 // ============================================================================
-// ResourceState.h
+// RHIResourceState.h
 // ----------------------------------------------------------------------------
-// API-agnostic resource state enumeration for the Frame Graph system.
+// API-agnostic resource state enumeration shared by the RHI backends and the
+// Frame Graph.
 //
 // PURPOSE:
 //   Abstracts GPU resource states away from D3D12 specifics, providing a clean
-//   boundary for render passes. The RenderContext translates these states to
-//   the appropriate D3D12_RESOURCE_STATES when issuing barriers.
+//   boundary for render passes. Each RHICommandList backend translates these
+//   states when issuing barriers (the Null backend only tracks them).
 //
 // USAGE:
 //   RenderContext::TransitionResource(resource, ResourceState::Common, ResourceState::RenderTarget);
@@ -16,7 +17,7 @@
 //   - Maps 1:1 to common D3D12 states used in rendering
 //   - Extensible for future Vulkan/Metal backends
 //
-// MAPPING (for reference):
+// MAPPING (D3D12 backend):
 //   Common          -> D3D12_RESOURCE_STATE_COMMON
 //   RenderTarget    -> D3D12_RESOURCE_STATE_RENDER_TARGET
 //   DepthWrite      -> D3D12_RESOURCE_STATE_DEPTH_WRITE
@@ -37,7 +38,7 @@
 // ============================================================================
 
 /// GPU resource state for barrier transitions.
-/// Used by RenderContext to abstract D3D12 resource barriers.
+/// Used by RHICommandList backends to abstract resource barriers.
 enum class ResourceState : std::uint8_t
 {
 	Common,           ///< Initial/final state, general purpose
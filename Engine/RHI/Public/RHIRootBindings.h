@@ -0,0 +1,127 @@
+// ============================================================================
+// RHIRootBindings.h
+// ----------------------------------------------------------------------------
+// Single source of truth for shader resource binding layout.
+//
+// USAGE:
+//   context.BindConstantBuffer(RootBindings::RootParam::PerFrame, gpuAddress);
+//
+// SYNC WITH:
+//   - D3D12RootBindings.h (shader visibility per root parameter)
+//   - D3D12RootSignature.cpp (root signature creation)
+//   - ConstantBuffers.hlsli (HLSL register declarations)
+//   - ObjectData.hlsli (per-object / per-instance structured buffers)
+//   - Material.hlsli (material table and index)
+//   - Samplers.hlsli (sampler register declarations)
+//
+// LAYOUT:
+//   Root Param 0: PerFrame CBV (b0)
+//   Root Param 1: PerView CBV (b1)
+//   Root Param 2: ObjectData SRV (t1, StructuredBuffer<ObjectData>)
+//   Root Param 3: MaterialIndex root constant (b3, 1 x uint)
+//   Root Param 4: Texture SRV table (t0)
+//   Root Param 5: Sampler table (s0-s26)
+//   Root Param 6: InstanceObjectIds SRV (t2, StructuredBuffer<uint>)
+//   Root Param 7: MaterialTable SRV (t3, StructuredBuffer<MaterialRecord>)
+//
+// NOTES:
+//   - Indices and registers only, no API types: render passes record
+//     against it on every backend
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+
+namespace RootBindings
+{
+
+	// ========================================================================
+	// Root Parameter Indices
+	// ========================================================================
+
+	namespace RootParam
+	{
+		constexpr uint32_t PerFrame = 0;
+		constexpr uint32_t PerView = 1;
+		constexpr uint32_t ObjectData = 2;
+		constexpr uint32_t MaterialIndex = 3;
+		constexpr uint32_t TextureSRV = 4;
+		constexpr uint32_t SamplerTable = 5;
+		constexpr uint32_t InstanceObjectIds = 6;
+		constexpr uint32_t MaterialTable = 7;
+
+		constexpr uint32_t Count = 8;
+	}  // namespace RootParam
+
+	// -----------------------------------------------------------------------------
+	// Constant Buffer Registers
+	// -----------------------------------------------------------------------------
+	namespace CBRegister
+	{
+		constexpr uint32_t PerFrame = 0;
+		constexpr uint32_t PerView = 1;
+		constexpr uint32_t MaterialIndex = 3;  // Root constants, not a CBV
+	}  // namespace CBRegister
+
+	// -----------------------------------------------------------------------------
+	// Shader Resource Registers
+	// -----------------------------------------------------------------------------
+	namespace SRVRegister
+	{
+		constexpr uint32_t BaseTexture = 0;
+		constexpr uint32_t ObjectData = 1;
+		constexpr uint32_t InstanceObjectIds = 2;
+		constexpr uint32_t MaterialTable = 3;
+	}  // namespace SRVRegister
+
+	// -----------------------------------------------------------------------------
+	// Sampler Registers
+	// -----------------------------------------------------------------------------
+	// Layout: [Point MinMag][Linear MinMag][Anisotropic]
+	// Each group: [MipPoint/MipLinear/NoMip] × [Wrap/Clamp/Mirror]
+	namespace SamplerRegister
+	{
+		// Point MinMag (s0-s8)
+		constexpr uint32_t PointMipPointWrap = 0;
+		constexpr uint32_t PointMipPointClamp = 1;
+		constexpr uint32_t PointMipPointMirror = 2;
+		constexpr uint32_t PointMipLinearWrap = 3;
+		constexpr uint32_t PointMipLinearClamp = 4;
+		constexpr uint32_t PointMipLinearMirror = 5;
+		constexpr uint32_t PointNoMipWrap = 6;
+		constexpr uint32_t PointNoMipClamp = 7;
+		constexpr uint32_t PointNoMipMirror = 8;
+
+		// Linear MinMag (s9-s17)
+		constexpr uint32_t LinearMipPointWrap = 9;
+		constexpr uint32_t LinearMipPointClamp = 10;
+		constexpr uint32_t LinearMipPointMirror = 11;
+		constexpr uint32_t LinearMipLinearWrap = 12;
+		constexpr uint32_t LinearMipLinearClamp = 13;
+		constexpr uint32_t LinearMipLinearMirror = 14;
+		constexpr uint32_t LinearNoMipWrap = 15;
+		constexpr uint32_t LinearNoMipClamp = 16;
+		constexpr uint32_t LinearNoMipMirror = 17;
+
+		// Anisotropic (s18-s32)
+		constexpr uint32_t Aniso1xWrap = 18;
+		constexpr uint32_t Aniso1xClamp = 19;
+		constexpr uint32_t Aniso1xMirror = 20;
+		constexpr uint32_t Aniso2xWrap = 21;
+		constexpr uint32_t Aniso2xClamp = 22;
+		constexpr uint32_t Aniso2xMirror = 23;
+		constexpr uint32_t Aniso4xWrap = 24;
+		constexpr uint32_t Aniso4xClamp = 25;
+		constexpr uint32_t Aniso4xMirror = 26;
+		constexpr uint32_t Aniso8xWrap = 27;
+		constexpr uint32_t Aniso8xClamp = 28;
+		constexpr uint32_t Aniso8xMirror = 29;
+		constexpr uint32_t Aniso16xWrap = 30;
+		constexpr uint32_t Aniso16xClamp = 31;
+		constexpr uint32_t Aniso16xMirror = 32;
+
+		constexpr uint32_t Count = 33;
+	}  // namespace SamplerRegister
+
+}  // namespace RootBindings
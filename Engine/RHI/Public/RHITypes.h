@@ -0,0 +1,153 @@
+// ============================================================================
+// RHITypes.h
+// ----------------------------------------------------------------------------
+// Backend-agnostic value types shared by RHIDevice and RHICommandList.
+//
+// DESIGN:
+//   - Plain structs and enums, no API headers — usable on any platform
+//   - Descriptor handles and GPU addresses are carried as raw 64-bit values;
+//     only the backend that produced them interprets them
+//   - RHINativeObject passes backend-owned objects (pipeline state, root
+//     signature, texture resource) through the RHI without wrapping them
+//
+// NOTES:
+//   - Buffers are the only resource the RHI creates itself (RHIDevice::CreateBuffer);
+//     textures, pipelines and descriptors still come from the backend directly
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+/// GPU virtual address (D3D12_GPU_VIRTUAL_ADDRESS on D3D12).
+using RHIGpuAddress = std::uint64_t;
+
+// ============================================================================
+// Enumerations
+// ============================================================================
+
+enum class RHIBackend : std::uint8_t
+{
+	D3D12,  ///< Direct3D 12 (Windows)
+	Null    ///< No GPU — validates and counts commands (headless runs, CI)
+};
+
+/// Memory a buffer lives in.
+enum class RHIHeapType : std::uint8_t
+{
+	Default,  ///< GPU-local, not CPU-visible (filled by copies)
+	Upload    ///< CPU-writable, persistently mapped for its whole lifetime
+};
+
+enum class RHIPrimitiveTopology : std::uint8_t
+{
+	TriangleList,
+	TriangleStrip,
+	LineList,
+	PointList
+};
+
+enum class RHIIndexFormat : std::uint8_t
+{
+	UInt16,
+	UInt32
+};
+
+[[nodiscard]] constexpr std::uint32_t GetIndexFormatSize(RHIIndexFormat format) noexcept
+{
+	return format == RHIIndexFormat::UInt16 ? 2u : 4u;
+}
+
+/// Depth test comparison (D3D12_COMPARISON_FUNC on D3D12).
+enum class RHIComparisonFunc : std::uint8_t
+{
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual
+};
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+/// Generational handle to a buffer created by an RHIDevice.
+struct RHIBufferHandle
+{
+	static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t index = INVALID_INDEX;
+	std::uint32_t generation = 0;
+
+	[[nodiscard]] constexpr bool IsValid() const noexcept { return index != INVALID_INDEX; }
+	constexpr bool operator==(const RHIBufferHandle&) const noexcept = default;
+};
+
+struct RHIBufferDesc
+{
+	std::uint64_t size = 0;                      ///< Bytes (> 0)
+	RHIHeapType heap = RHIHeapType::Upload;
+	const wchar_t* debugName = nullptr;          ///< Optional, must outlive the call only
+};
+
+// ============================================================================
+// Textures
+// ============================================================================
+
+enum class RHITextureFormat : std::uint8_t
+{
+	RGBA8_UNorm,
+	RGBA16_Float,
+	R11G11B10_Float,
+	R32_Float,
+	RG16_Float,
+	D32_Float
+};
+
+[[nodiscard]] constexpr std::uint32_t GetTextureFormatSize(RHITextureFormat format) noexcept
+{
+	return format == RHITextureFormat::RGBA16_Float ? 8u : 4u;
+}
+
+/// Placement alignment for resources sub-allocated from a shared heap
+/// (D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT on D3D12).
+constexpr std::uint64_t RHIPlacementAlignment = 64ull * 1024ull;
+
+// ============================================================================
+// Views and Handles
+// ============================================================================
+
+struct RHIVertexBufferView
+{
+	RHIGpuAddress address = 0;
+	std::uint32_t sizeInBytes = 0;
+	std::uint32_t strideInBytes = 0;
+};
+
+struct RHIIndexBufferView
+{
+	RHIGpuAddress address = 0;
+	std::uint32_t sizeInBytes = 0;
+	RHIIndexFormat format = RHIIndexFormat::UInt32;
+};
+
+/// CPU descriptor (render target / depth-stencil view).
+struct RHICpuDescriptor
+{
+	std::uint64_t ptr = 0;
+};
+
+/// Shader-visible descriptor (base of a descriptor table).
+struct RHIGpuDescriptor
+{
+	std::uint64_t ptr = 0;
+};
+
+/// Backend-owned object handed through the RHI untouched.
+struct RHINativeObject
+{
+	void* ptr = nullptr;
+
+	[[nodiscard]] explicit operator bool() const noexcept { return ptr != nullptr; }
+};
@@ -60,6 +60,8 @@ void RenderCamera::RebuildMatrices() noexcept
 
 	// Extract frustum planes from combined view-projection matrix
 	m_frustum.ExtractFromViewProjection(m_viewProjMatrix);
+
+	++m_generation;
 }
 
 XMMATRIX RenderCamera::GetViewMatrix() const noexcept
@@ -45,16 +45,16 @@ float DepthConvention::GetClearDepth() noexcept
 	return IsReversedZ() ? 0.0f : 1.0f;
 }
 
-D3D12_COMPARISON_FUNC DepthConvention::GetDepthComparisonLessEqualFunc() noexcept
+RHIComparisonFunc DepthConvention::GetDepthComparisonLessEqualFunc() noexcept
 {
 	// Reversed-Z: closer pixels have GREATER depth values
 	// Standard:   closer pixels have LESS depth values
-	return IsReversedZ() ? D3D12_COMPARISON_FUNC_GREATER : D3D12_COMPARISON_FUNC_LESS;
+	return IsReversedZ() ? RHIComparisonFunc::Greater : RHIComparisonFunc::Less;
 }
 
-D3D12_COMPARISON_FUNC DepthConvention::GetDepthComparisonFuncEqual() noexcept
+RHIComparisonFunc DepthConvention::GetDepthComparisonFuncEqual() noexcept
 {
-	return IsReversedZ() ? D3D12_COMPARISON_FUNC_GREATER_EQUAL : D3D12_COMPARISON_FUNC_LESS_EQUAL;
+	return IsReversedZ() ? RHIComparisonFunc::GreaterEqual : RHIComparisonFunc::LessEqual;
 }
 
 //------------------------------------------------------------------------------
@@ -3,10 +3,33 @@
 #include "Renderer/Public/RenderContext.h"
 #include "Renderer/Public/SceneData/SceneView.h"
 
+#include "RHIDevice.h"
+#include "RHICommandList.h"
+
 #include "Core/Public/Diagnostics/Log.h"
+#include "Core/Public/Hash/HashUtils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
-FrameGraph::FrameGraph(D3D12SwapChain* swapChain, D3D12DepthStencil* depthStencil) : m_swapChain(swapChain), m_depthStencil(depthStencil)
+FrameGraph::FrameGraph()
 {
+	m_resources.resize(ResourceHandle::FIRST_TRANSIENT_INDEX);
+
+	// Back buffer: presented last frame, UI still draws into it after the graph
+	FrameGraphResourceInfo& backBuffer = m_resources[ResourceHandle::BACKBUFFER_INDEX];
+	backBuffer.initialState = ResourceState::Present;
+	backBuffer.finalState = ResourceState::RenderTarget;
+	backBuffer.bImported = true;
+	backBuffer.bOutput = true;
+
+	// Depth buffer: kept in depth-read between frames
+	FrameGraphResourceInfo& depthBuffer = m_resources[ResourceHandle::DEPTH_BUFFER_INDEX];
+	depthBuffer.initialState = ResourceState::DepthRead;
+	depthBuffer.finalState = ResourceState::DepthRead;
+	depthBuffer.bImported = true;
+
 	LOG_INFO("FrameGraph created");
 }
 
@@ -17,22 +40,237 @@ FrameGraph::~FrameGraph()
 
 void FrameGraph::Setup(const SceneView& sceneView)
 {
-	for (auto& pass : m_passes)
+	m_builder.Reset(m_passes.size());
+	for (std::size_t i = 0; i < m_passes.size(); ++i)
+	{
+		m_builder.BeginPass(i);
+		m_passes[i]->Setup(m_builder, sceneView);
+	}
+
+	// Transients start undefined every frame and are not handed back to anyone
+	m_resources.resize(ResourceHandle::FIRST_TRANSIENT_INDEX + m_builder.GetTransientTextures().size());
+	std::fill(m_resources.begin() + ResourceHandle::FIRST_TRANSIENT_INDEX, m_resources.end(), FrameGraphResourceInfo{});
+}
+
+void FrameGraph::SetImportedResource(ResourceHandle handle, RHINativeObject resource) noexcept
+{
+	if (handle.IsValid() && !handle.IsTransient())
 	{
-		pass->Setup(m_builder, sceneView);
+		m_importedResources[handle.index] = resource;
 	}
 }
 
 void FrameGraph::Compile()
 {
-	// MVP: No-op
-	// Future: Analyze dependencies, insert resource barriers, optimize pass ordering
+	const std::uint64_t hash = HashDeclarations();
+	if (m_bCompiled && hash == m_compiledHash)
+	{
+		++m_compileStats.cacheHits;
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	const std::uint32_t previousCulled = m_compiled.culledPassCount;
+	m_compiler.Compile(m_builder.GetDeclarations(), m_resources, m_compiled);
+	PlaceTransients();
+
+	m_compiledHash = hash;
+	m_bCompiled = true;
+	m_compileStats.lastCompileMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	m_compileStats.totalCompileMs += m_compileStats.lastCompileMs;
+	++m_compileStats.compiles;
+
+	if (m_compiled.culledPassCount != previousCulled)
+	{
+		LOG_INFO("FrameGraph: " + std::to_string(m_compiled.passes.size()) + " passes scheduled, " + std::to_string(m_compiled.culledPassCount) + " culled");
+	}
+	if (m_compiled.stateConflicts > 0)
+	{
+		LOG_WARNING("FrameGraph: " + std::to_string(m_compiled.stateConflicts) + " conflicting resource states within a pass");
+	}
 }
 
 void FrameGraph::Execute(RenderContext& context)
 {
-	for (auto& pass : m_passes)
+	const auto start = std::chrono::steady_clock::now();
+
+	const std::span<const ResourceTransition> transitions = m_compiled.transitions;
+	for (const CompiledPass& compiled : m_compiled.passes)
+	{
+		IssueTransitions(context, transitions.subspan(compiled.firstTransition, compiled.transitionCount));
+		m_passes[compiled.passIndex]->Execute(context);
+	}
+	IssueTransitions(context, m_compiled.finalTransitions);
+
+	m_recordStats.jobs = 1;
+	m_recordStats.threads = 1;
+	m_recordStats.recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void FrameGraph::ExecuteParallel(RenderContext& context, RHIDevice& rhi, std::uint32_t frameInFlightIndex, std::uint32_t maxThreads)
+{
+	BuildRecordJobs(RHIDevice::kMaxWorkerCommandLists);
+	const auto jobCount = static_cast<std::uint32_t>(m_recordJobs.size());
+	if (jobCount <= 1 || maxThreads <= 1)
+	{
+		Execute(context);
+		return;
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+
+	// Single-threaded preparation (uploads, cache lookups) before any range records
+	for (const RecordJob& job : m_recordJobs)
+	{
+		if (job.range == 0)
+		{
+			m_passes[m_compiled.passes[job.compiledPass].passIndex]->PrepareRanges(job.rangeCount);
+		}
+	}
+
+	for (std::uint32_t job = 0; job < jobCount; ++job)
+	{
+		rhi.BeginWorkerCommandList(frameInFlightIndex, job);
+	}
+
+	// Job i records into worker list i; a pass's transitions lead its first range
+	const std::span<const ResourceTransition> transitions = m_compiled.transitions;
+	const auto recordJob = [&](std::uint32_t job)
+	{
+		const RecordJob& entry = m_recordJobs[job];
+		const CompiledPass& compiled = m_compiled.passes[entry.compiledPass];
+
+		RenderContext jobContext(rhi.GetWorkerCommandList(frameInFlightIndex, job));
+		if (entry.range == 0)
+		{
+			IssueTransitions(jobContext, transitions.subspan(compiled.firstTransition, compiled.transitionCount));
+		}
+		m_passes[compiled.passIndex]->ExecuteRange(jobContext, entry.range, entry.rangeCount);
+	};
+
+	const std::uint32_t threadCount = std::min(jobCount, maxThreads);
+	const auto recordStride = [&](std::uint32_t thread)
+	{
+		for (std::uint32_t job = thread; job < jobCount; job += threadCount)
+		{
+			recordJob(job);
+		}
+	};
+
+	{
+		// Calling thread is thread 0; jthreads join on scope exit
+		std::vector<std::jthread> threads;
+		threads.reserve(threadCount - 1);
+		for (std::uint32_t thread = 1; thread < threadCount; ++thread)
+		{
+			threads.emplace_back(recordStride, thread);
+		}
+		recordStride(0);
+	}
+
+	for (std::uint32_t job = 0; job < jobCount; ++job)
+	{
+		rhi.CloseWorkerCommandList(frameInFlightIndex, job);
+	}
+
+	m_recordStats.jobs = jobCount;
+	m_recordStats.threads = threadCount;
+	m_recordStats.recordMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	// Frame list so far, then the jobs in schedule order; context keeps recording after them
+	rhi.SubmitWorkerCommandLists(frameInFlightIndex, jobCount);
+	IssueTransitions(context, m_compiled.finalTransitions);
+}
+
+// =============================================================================
+// Internals
+// =============================================================================
+
+// Pass identities and the epoch seed the hash of the declarations themselves:
+// a replaced pass or an Invalidate() misses even with equal declarations.
+std::uint64_t FrameGraph::HashDeclarations() const noexcept
+{
+	std::uint64_t seed = Engine::Hash::Mix64(m_epoch);
+	for (const auto& pass : m_passes)
+	{
+		seed = Engine::Hash::Mix64(seed ^ reinterpret_cast<std::uintptr_t>(pass.get()));
+	}
+	return HashFrameGraphDeclarations(m_builder.GetDeclarations(), m_resources, m_builder.GetTransientTextures(), seed);
+}
+
+void FrameGraph::PlaceTransients()
+{
+	const std::span<const TransientTextureDesc> textures = m_builder.GetTransientTextures();
+
+	m_transientRequests.clear();
+	for (std::size_t i = 0; i < textures.size(); ++i)
+	{
+		// Unused (or culled-only) transients get no memory
+		const ResourceLifetime& lifetime = m_compiled.lifetimes[ResourceHandle::FIRST_TRANSIENT_INDEX + i];
+		TransientAllocationRequest& request = m_transientRequests.emplace_back();
+		if (lifetime.IsUsed())
+		{
+			request.size = textures[i].GetAllocationSize();
+			request.firstPass = lifetime.firstPass;
+			request.lastPass = lifetime.lastPass;
+		}
+	}
+
+	const TransientMemoryStats previous = m_transientAllocator.GetStats();
+	m_transientAllocator.Place(m_transientRequests, m_transientPlacements);
+
+	const TransientMemoryStats& stats = m_transientAllocator.GetStats();
+	if (stats != previous && stats.resourceCount > 0)
+	{
+		LOG_INFO(
+		    "FrameGraph: " + std::to_string(stats.resourceCount) + " transients in " + std::to_string(stats.heapCount) + " heaps, " +
+		    std::to_string(stats.bytesWithAliasing / 1024) + " KB aliased vs " + std::to_string(stats.bytesWithoutAliasing / 1024) +
+		    " KB dedicated (peak live " + std::to_string(stats.peakLiveBytes / 1024) + " KB)");
+	}
+}
+
+// Every scheduled pass gets one job; passes that split share out the rest of
+// the budget in schedule order.
+void FrameGraph::BuildRecordJobs(std::uint32_t maxJobs)
+{
+	m_recordJobs.clear();
+
+	const auto passCount = static_cast<std::uint32_t>(m_compiled.passes.size());
+	if (passCount > maxJobs)
+		return;  // More passes than command lists: record serially
+
+	std::uint32_t spare = maxJobs - passCount;
+	for (std::uint32_t compiledPass = 0; compiledPass < passCount; ++compiledPass)
+	{
+		const RenderPass& pass = *m_passes[m_compiled.passes[compiledPass].passIndex];
+		const std::uint32_t rangeCount = std::clamp(pass.GetRecordRangeCount(spare + 1), 1u, spare + 1);
+		spare -= rangeCount - 1;
+
+		for (std::uint32_t range = 0; range < rangeCount; ++range)
+		{
+			m_recordJobs.push_back({compiledPass, range, rangeCount});
+		}
+	}
+}
+
+void FrameGraph::IssueTransitions(RenderContext& context, std::span<const ResourceTransition> transitions) const
+{
+	for (const ResourceTransition& transition : transitions)
+	{
+		if (const RHINativeObject resource = GetNativeResource(transition.handle))
+		{
+			context.TransitionResource(resource.ptr, transition.before, transition.after);
+		}
+	}
+}
+
+// Transients have no GPU resource yet (see NOTES in FrameGraph.h)
+RHINativeObject FrameGraph::GetNativeResource(ResourceHandle handle) const noexcept
+{
+	if (handle.IsValid() && !handle.IsTransient())
 	{
-		pass->Execute(context);
+		return m_importedResources[handle.index];
 	}
+	return {};
 }
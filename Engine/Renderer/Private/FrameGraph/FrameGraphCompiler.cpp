@@ -0,0 +1,315 @@
+// =============================================================================
+// FrameGraphCompiler.cpp — Dependency DAG, scheduling, culling and transitions
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/FrameGraph/FrameGraphCompiler.h"
+
+#include "Core/Public/Hash/HashUtils.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace FrameGraphCompilerInternal
+{
+	constexpr std::uint32_t kNoPass = UINT32_MAX;
+
+	// Adds value unless already present (adjacency lists stay tiny)
+	bool PushUnique(std::vector<std::uint32_t>& list, std::uint32_t value)
+	{
+		if (std::find(list.begin(), list.end(), value) != list.end())
+			return false;
+		list.push_back(value);
+		return true;
+	}
+
+	// FNV-1a step over one 64-bit value
+	constexpr void HashValue(std::uint64_t& hash, std::uint64_t value) noexcept
+	{
+		hash ^= value;
+		hash *= Engine::Hash::kFnv64Prime;
+	}
+}  // namespace FrameGraphCompilerInternal
+
+void CompiledFrameGraph::Clear() noexcept
+{
+	passes.clear();
+	transitions.clear();
+	finalTransitions.clear();
+	lifetimes.clear();
+	edgeCount = 0;
+	culledPassCount = 0;
+	stateConflicts = 0;
+}
+
+// =============================================================================
+// Compile
+// =============================================================================
+
+void FrameGraphCompiler::Compile(
+    std::span<const PassDeclaration> passes,
+    std::span<const FrameGraphResourceInfo> resources,
+    CompiledFrameGraph& out)
+{
+	using namespace FrameGraphCompilerInternal;
+
+	out.Clear();
+
+	const auto passCount = static_cast<std::uint32_t>(passes.size());
+	const auto resourceCount = static_cast<std::uint32_t>(resources.size());
+	const auto isTracked = [resourceCount](ResourceHandle handle) { return handle.IsValid() && handle.index < resourceCount; };
+
+	m_successors.resize(passCount);
+	m_producers.resize(passCount);
+	for (std::uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		m_successors[pass].clear();
+		m_producers[pass].clear();
+	}
+	m_inDegree.assign(passCount, 0);
+	m_bAlive.assign(passCount, 0);
+	m_lastWriter.assign(resourceCount, kNoPass);
+	m_readersSinceWrite.resize(resourceCount);
+	for (auto& readers : m_readersSinceWrite)
+	{
+		readers.clear();
+	}
+
+	// Producer edges (read-after-write, write-after-write) also carry liveness:
+	// a live consumer keeps whatever produced its input alive
+	const auto addEdge = [&](std::uint32_t from, std::uint32_t to, bool bProducer) {
+		if (from == to)
+			return;
+		if (PushUnique(m_successors[from], to))
+		{
+			++m_inDegree[to];
+			++out.edgeCount;
+		}
+		if (bProducer)
+		{
+			PushUnique(m_producers[to], from);
+		}
+	};
+
+	// -------------------------------------------------------------------------
+	// 1. Dependency edges, in declaration order per resource
+	// -------------------------------------------------------------------------
+
+	for (std::uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		// Reads first, so a read-modify-write pass depends on the previous writer
+		for (const ResourceAccess& access : passes[pass].accesses)
+		{
+			if (access.bWrite || !isTracked(access.handle))
+				continue;
+
+			const std::uint32_t resource = access.handle.index;
+			if (m_lastWriter[resource] != kNoPass)
+			{
+				addEdge(m_lastWriter[resource], pass, true);
+			}
+			PushUnique(m_readersSinceWrite[resource], pass);
+		}
+
+		for (const ResourceAccess& access : passes[pass].accesses)
+		{
+			if (!access.bWrite || !isTracked(access.handle))
+				continue;
+
+			const std::uint32_t resource = access.handle.index;
+			if (m_lastWriter[resource] != kNoPass)
+			{
+				addEdge(m_lastWriter[resource], pass, true);
+			}
+			for (const std::uint32_t reader : m_readersSinceWrite[resource])
+			{
+				addEdge(reader, pass, false);
+			}
+			m_readersSinceWrite[resource].clear();
+			m_lastWriter[resource] = pass;
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// 2. Liveness — flood from output writers and side-effect passes
+	// -------------------------------------------------------------------------
+
+	m_stack.clear();
+	for (std::uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		bool bRoot = passes[pass].bHasSideEffects;
+		for (const ResourceAccess& access : passes[pass].accesses)
+		{
+			bRoot = bRoot || (access.bWrite && isTracked(access.handle) && resources[access.handle.index].bOutput);
+		}
+		if (bRoot)
+		{
+			m_bAlive[pass] = 1;
+			m_stack.push_back(pass);
+		}
+	}
+
+	while (!m_stack.empty())
+	{
+		const std::uint32_t pass = m_stack.back();
+		m_stack.pop_back();
+		for (const std::uint32_t producer : m_producers[pass])
+		{
+			if (!m_bAlive[producer])
+			{
+				m_bAlive[producer] = 1;
+				m_stack.push_back(producer);
+			}
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// 3. Topological order (Kahn, lowest declaration index first) + transitions
+	// -------------------------------------------------------------------------
+
+	out.lifetimes.assign(resourceCount, ResourceLifetime{});
+	m_currentStates.resize(resourceCount);
+	for (std::uint32_t resource = 0; resource < resourceCount; ++resource)
+	{
+		m_currentStates[resource] = resources[resource].initialState;
+	}
+
+	// Min-heap of ready passes. Culled passes are still walked so ordering
+	// constraints that run through them are respected
+	m_stack.clear();
+	for (std::uint32_t pass = 0; pass < passCount; ++pass)
+	{
+		if (m_inDegree[pass] == 0)
+		{
+			m_stack.push_back(pass);
+		}
+	}
+	std::make_heap(m_stack.begin(), m_stack.end(), std::greater<>{});
+
+	while (!m_stack.empty())
+	{
+		std::pop_heap(m_stack.begin(), m_stack.end(), std::greater<>{});
+		const std::uint32_t pass = m_stack.back();
+		m_stack.pop_back();
+
+		for (const std::uint32_t successor : m_successors[pass])
+		{
+			if (--m_inDegree[successor] == 0)
+			{
+				m_stack.push_back(successor);
+				std::push_heap(m_stack.begin(), m_stack.end(), std::greater<>{});
+			}
+		}
+
+		if (!m_bAlive[pass])
+		{
+			++out.culledPassCount;
+			continue;
+		}
+
+		const auto position = static_cast<std::uint32_t>(out.passes.size());
+		CompiledPass compiled;
+		compiled.passIndex = pass;
+		compiled.firstTransition = static_cast<std::uint32_t>(out.transitions.size());
+
+		const auto& accesses = passes[pass].accesses;
+		for (std::size_t i = 0; i < accesses.size(); ++i)
+		{
+			const ResourceHandle handle = accesses[i].handle;
+			if (!isTracked(handle))
+				continue;
+
+			ResourceLifetime& lifetime = out.lifetimes[handle.index];
+			lifetime.firstPass = std::min(lifetime.firstPass, position);
+			lifetime.lastPass = position;
+
+			// Each resource is transitioned once per pass, at its first access
+			const auto firstUse = std::find_if(accesses.begin(), accesses.end(), [handle](const ResourceAccess& other) { return other.handle == handle; });
+			if (static_cast<std::size_t>(firstUse - accesses.begin()) != i)
+				continue;
+
+			// A write's state wins over reads of the same resource in this pass
+			ResourceState required = accesses[i].state;
+			for (std::size_t j = i; j < accesses.size(); ++j)
+			{
+				if (accesses[j].handle == handle && accesses[j].bWrite)
+				{
+					required = accesses[j].state;
+					break;
+				}
+			}
+			for (std::size_t j = i; j < accesses.size(); ++j)
+			{
+				if (accesses[j].handle == handle && accesses[j].state != required)
+				{
+					++out.stateConflicts;
+				}
+			}
+
+			ResourceState& current = m_currentStates[handle.index];
+			if (current != required)
+			{
+				out.transitions.push_back({handle, current, required});
+				current = required;
+			}
+		}
+
+		compiled.transitionCount = static_cast<std::uint32_t>(out.transitions.size()) - compiled.firstTransition;
+		out.passes.push_back(compiled);
+	}
+
+	// -------------------------------------------------------------------------
+	// 4. Hand imported resources back in the state their owner expects
+	// -------------------------------------------------------------------------
+
+	for (std::uint32_t resource = 0; resource < resourceCount; ++resource)
+	{
+		const FrameGraphResourceInfo& info = resources[resource];
+		if (info.bImported && m_currentStates[resource] != info.finalState)
+		{
+			out.finalTransitions.push_back({ResourceHandle{resource}, m_currentStates[resource], info.finalState});
+		}
+	}
+}
+
+// =============================================================================
+// Declaration Hash
+// =============================================================================
+
+std::uint64_t HashFrameGraphDeclarations(
+    std::span<const PassDeclaration> passes,
+    std::span<const FrameGraphResourceInfo> resources,
+    std::span<const TransientTextureDesc> transients,
+    std::uint64_t seed) noexcept
+{
+	using FrameGraphCompilerInternal::HashValue;
+
+	std::uint64_t hash = seed;
+	HashValue(hash, passes.size());
+	for (const PassDeclaration& pass : passes)
+	{
+		HashValue(hash, pass.bHasSideEffects ? 1u : 0u);
+		HashValue(hash, pass.accesses.size());
+		for (const ResourceAccess& access : pass.accesses)
+		{
+			HashValue(hash, (static_cast<std::uint64_t>(access.handle.index) << 16) | (static_cast<std::uint64_t>(access.state) << 1) | (access.bWrite ? 1u : 0u));
+		}
+	}
+
+	HashValue(hash, resources.size());
+	for (const FrameGraphResourceInfo& info : resources)
+	{
+		HashValue(
+		    hash,
+		    (static_cast<std::uint64_t>(info.initialState) << 16) | (static_cast<std::uint64_t>(info.finalState) << 8) | (info.bImported ? 2u : 0u) |
+		        (info.bOutput ? 1u : 0u));
+	}
+
+	for (const TransientTextureDesc& desc : transients)
+	{
+		HashValue(hash, (static_cast<std::uint64_t>(desc.width) << 32) | desc.height);
+		HashValue(hash, static_cast<std::uint64_t>(desc.format));
+	}
+
+	return hash;
+}
@@ -0,0 +1,159 @@
+// =============================================================================
+// TransientResourceAllocator.cpp — Lifetime-based heap placement for transients
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/FrameGraph/TransientResourceAllocator.h"
+
+#include <algorithm>
+
+namespace TransientResourceAllocatorInternal
+{
+	[[nodiscard]] constexpr bool LifetimesOverlap(const TransientAllocationRequest& a, const TransientAllocationRequest& b) noexcept
+	{
+		return a.firstPass <= b.lastPass && b.firstPass <= a.lastPass;
+	}
+
+	[[nodiscard]] constexpr std::uint64_t AlignUp(std::uint64_t value) noexcept
+	{
+		return (value + RHIPlacementAlignment - 1) & ~(RHIPlacementAlignment - 1);
+	}
+}  // namespace TransientResourceAllocatorInternal
+
+// =============================================================================
+// Place
+// =============================================================================
+
+void TransientResourceAllocator::Place(std::span<const TransientAllocationRequest> requests, std::vector<TransientPlacement>& outPlacements)
+{
+	const auto requestCount = static_cast<std::uint32_t>(requests.size());
+
+	outPlacements.assign(requestCount, TransientPlacement{});
+	m_stats = {};
+	m_heapSizes.clear();
+	for (auto& members : m_heapMembers)
+	{
+		members.clear();
+	}
+
+	// Largest first keeps big resources at low offsets and fills gaps with small ones
+	m_order.clear();
+	std::uint32_t lastPass = 0;
+	for (std::uint32_t request = 0; request < requestCount; ++request)
+	{
+		if (requests[request].size > 0)
+		{
+			m_order.push_back(request);
+			lastPass = std::max(lastPass, requests[request].lastPass);
+		}
+	}
+	std::sort(
+	    m_order.begin(),
+	    m_order.end(),
+	    [&requests](std::uint32_t a, std::uint32_t b)
+	    {
+		    if (requests[a].size != requests[b].size)
+			    return requests[a].size > requests[b].size;
+		    if (requests[a].firstPass != requests[b].firstPass)
+			    return requests[a].firstPass < requests[b].firstPass;
+		    return a < b;
+	    });
+
+	for (const std::uint32_t request : m_order)
+	{
+		std::uint64_t offset = 0;
+		auto heap = static_cast<std::uint32_t>(m_heapSizes.size());
+		for (std::uint32_t candidate = 0; candidate < m_heapSizes.size(); ++candidate)
+		{
+			if (TryPlaceInHeap(candidate, requests, outPlacements, request, offset))
+			{
+				heap = candidate;
+				break;
+			}
+		}
+
+		if (heap == m_heapSizes.size())
+		{
+			offset = 0;
+			m_heapSizes.push_back(0);
+			if (m_heapMembers.size() < m_heapSizes.size())
+			{
+				m_heapMembers.emplace_back();
+			}
+		}
+
+		outPlacements[request] = {heap, offset};
+		m_heapMembers[heap].push_back(request);
+		m_heapSizes[heap] = std::max(m_heapSizes[heap], offset + requests[request].size);
+		m_stats.bytesWithoutAliasing += requests[request].size;
+	}
+
+	m_stats.resourceCount = static_cast<std::uint32_t>(m_order.size());
+	m_stats.heapCount = static_cast<std::uint32_t>(m_heapSizes.size());
+	for (const std::uint64_t heapSize : m_heapSizes)
+	{
+		m_stats.bytesWithAliasing += heapSize;
+	}
+
+	// Lower bound: bytes alive at the busiest pass
+	if (!m_order.empty())
+	{
+		m_liveDelta.assign(static_cast<std::size_t>(lastPass) + 2, 0);
+		for (const std::uint32_t request : m_order)
+		{
+			const auto size = static_cast<std::int64_t>(requests[request].size);
+			m_liveDelta[requests[request].firstPass] += size;
+			m_liveDelta[static_cast<std::size_t>(requests[request].lastPass) + 1] -= size;
+		}
+
+		std::int64_t live = 0;
+		for (const std::int64_t delta : m_liveDelta)
+		{
+			live += delta;
+			m_stats.peakLiveBytes = std::max(m_stats.peakLiveBytes, static_cast<std::uint64_t>(live));
+		}
+	}
+}
+
+// =============================================================================
+// Internals
+// =============================================================================
+
+// First-fit over the address ranges of members whose lifetimes overlap request.
+bool TransientResourceAllocator::TryPlaceInHeap(
+    std::uint32_t heapIndex,
+    std::span<const TransientAllocationRequest> requests,
+    std::span<const TransientPlacement> placements,
+    std::uint32_t request,
+    std::uint64_t& outOffset)
+{
+	using namespace TransientResourceAllocatorInternal;
+
+	const TransientAllocationRequest& placing = requests[request];
+
+	m_occupied.clear();
+	for (const std::uint32_t member : m_heapMembers[heapIndex])
+	{
+		if (LifetimesOverlap(placing, requests[member]))
+		{
+			m_occupied.emplace_back(placements[member].offset, placements[member].offset + requests[member].size);
+		}
+	}
+	std::sort(m_occupied.begin(), m_occupied.end());
+
+	std::uint64_t offset = 0;
+	for (const auto& [begin, end] : m_occupied)
+	{
+		if (offset + placing.size <= begin)
+			break;
+		offset = std::max(offset, AlignUp(end));
+	}
+
+	// Growing the heap is fine up to the cap; reusing existing space always is
+	const std::uint64_t end = offset + placing.size;
+	if (end > m_heapSizes[heapIndex] && end > m_maxHeapSize)
+		return false;
+
+	outOffset = offset;
+	return true;
+}
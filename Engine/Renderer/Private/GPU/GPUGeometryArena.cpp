@@ -0,0 +1,192 @@
+// =============================================================================
+// GPUGeometryArena.cpp — Suballocated default-heap vertex/index storage
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/GPU/GPUGeometryArena.h"
+#include "Renderer/Public/GPU/GPUMesh.h"
+
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+GPUGeometryArena::GPUGeometryArena(RHIDevice& rhi, GPUUploadQueue& uploads, std::uint64_t pageSize) noexcept
+    : m_rhi(&rhi), m_uploads(&uploads), m_pageSize(pageSize)
+{
+}
+
+// =============================================================================
+// Meshes
+// =============================================================================
+
+GeometryUploadResult GPUGeometryArena::Upload(const MeshGeometryHandle& geometry, GPUMesh& outMesh)
+{
+	if (!geometry || !geometry->IsValid())
+	{
+		LOG_ERROR("[GPUGeometryArena] Cannot upload invalid MeshData (empty vertices or indices)");
+		return GeometryUploadResult::Failed;
+	}
+
+	const auto vertexBytes = static_cast<std::uint64_t>(geometry->GetVertexBufferSize());
+	const auto indexBytes = static_cast<std::uint64_t>(geometry->GetIndexBufferSize());
+
+	// Staging first: a full ring must not leave ranges behind
+	const UploadAllocation staging = m_uploads->Allocate(vertexBytes + indexBytes);
+	if (!staging.IsValid())
+	{
+		++m_deferredUploads;
+		return GeometryUploadResult::Deferred;
+	}
+	std::memcpy(staging.data, geometry->GetVertexData(), vertexBytes);
+	std::memcpy(staging.data + vertexBytes, geometry->GetIndexData(), indexBytes);
+
+	// The staged bytes are simply not copied on failure; the ring reclaims them
+	const GeometryRange vertices = Allocate(vertexBytes);
+	if (!vertices.IsValid())
+		return GeometryUploadResult::Failed;
+
+	const GeometryRange indices = Allocate(indexBytes);
+	if (!indices.IsValid())
+	{
+		Release(vertices);
+		return GeometryUploadResult::Failed;
+	}
+
+	const Page& vertexPage = m_pages[vertices.page];
+	const Page& indexPage = m_pages[indices.page];
+	m_uploads->CopyBuffer(staging, 0, m_rhi->GetNativeBuffer(vertexPage.buffer.GetHandle()), vertices.allocation.offset, vertexBytes);
+	m_uploads->CopyBuffer(staging, vertexBytes, m_rhi->GetNativeBuffer(indexPage.buffer.GetHandle()), indices.allocation.offset, indexBytes);
+
+	RHIVertexBufferView vertexView{};
+	vertexView.address = vertexPage.buffer.GetGPUAddress() + vertices.allocation.offset;
+	vertexView.sizeInBytes = static_cast<std::uint32_t>(vertexBytes);
+	vertexView.strideInBytes = static_cast<std::uint32_t>(sizeof(VertexData));
+
+	RHIIndexBufferView indexView{};
+	indexView.address = indexPage.buffer.GetGPUAddress() + indices.allocation.offset;
+	indexView.sizeInBytes = static_cast<std::uint32_t>(indexBytes);
+	indexView.format = RHIIndexFormat::UInt32;
+
+	outMesh = GPUMesh(vertices, indices, vertexView, indexView, geometry->GetVertexCount(), geometry->GetIndexCount());
+
+	m_stagedBytes += vertexBytes + indexBytes;
+	++m_stagedMeshes;
+	return GeometryUploadResult::Uploaded;
+}
+
+void GPUGeometryArena::Free(GPUMesh& mesh) noexcept
+{
+	Release(mesh.GetVertexRange());
+	Release(mesh.GetIndexRange());
+	mesh = {};
+}
+
+// =============================================================================
+// Per-Frame
+// =============================================================================
+
+void GPUGeometryArena::RecordUploads(RHICommandList& commandList)
+{
+	m_uploads->RecordCopies(commandList);
+	m_uploadedBytes = m_stagedBytes;
+	m_uploadedMeshes = m_stagedMeshes;
+	m_stagedBytes = 0;
+	m_stagedMeshes = 0;
+}
+
+void GPUGeometryArena::Clear() noexcept
+{
+	m_pages.clear();
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+GeometryArenaStats GPUGeometryArena::GetStats() const noexcept
+{
+	GeometryArenaStats stats;
+	for (const Page& page : m_pages)
+	{
+		if (!page.buffer.IsValid())
+			continue;
+
+		const OffsetAllocatorStats pageStats = page.allocator.GetStats();
+		++stats.pageCount;
+		stats.reservedBytes += pageStats.capacity;
+		stats.allocatedBytes += pageStats.allocatedBytes;
+		stats.allocationCount += pageStats.allocationCount;
+		stats.freeRangeCount += pageStats.freeRangeCount;
+		stats.largestFreeRange = std::max(stats.largestFreeRange, pageStats.largestFreeRange);
+	}
+	stats.uploadedBytes = m_uploadedBytes;
+	stats.uploadedMeshes = m_uploadedMeshes;
+	stats.deferredUploads = m_deferredUploads;
+	return stats;
+}
+
+// =============================================================================
+// Pages
+// =============================================================================
+
+// First fit over pages (good fit within each); a new page when none fits.
+GeometryRange GPUGeometryArena::Allocate(std::uint64_t size)
+{
+	for (std::uint32_t index = 0; index < m_pages.size(); ++index)
+	{
+		Page& page = m_pages[index];
+		if (!page.buffer.IsValid() || page.bDedicated)
+			continue;
+
+		const OffsetAllocation allocation = page.allocator.Allocate(size, kRangeAlignment);
+		if (allocation.IsValid())
+			return {index, allocation};
+	}
+
+	const bool bDedicated = size > m_pageSize;
+	const std::uint32_t index = CreatePage(bDedicated ? size : m_pageSize, bDedicated);
+	if (index == GeometryRange::kInvalidPage)
+		return {};
+
+	return {index, m_pages[index].allocator.Allocate(size, kRangeAlignment)};
+}
+
+void GPUGeometryArena::Release(const GeometryRange& range) noexcept
+{
+	if (!range.IsValid() || range.page >= m_pages.size())
+		return;
+
+	Page& page = m_pages[range.page];
+	page.allocator.Free(range.allocation);
+	if (page.bDedicated && page.allocator.IsEmpty())
+	{
+		page.buffer.Reset();
+	}
+}
+
+std::uint32_t GPUGeometryArena::CreatePage(std::uint64_t size, bool bDedicated)
+{
+	RHIBuffer buffer(*m_rhi, RHIBufferDesc{size, RHIHeapType::Default, bDedicated ? L"GeometryArena_DedicatedPage" : L"GeometryArena_Page"});
+	if (!buffer.IsValid())
+	{
+		LOG_ERROR("[GPUGeometryArena] Failed to create geometry page");
+		return GeometryRange::kInvalidPage;
+	}
+
+	// Reuse the slot of a released dedicated page
+	auto it = std::find_if(m_pages.begin(), m_pages.end(), [](const Page& page) { return !page.buffer.IsValid(); });
+	if (it == m_pages.end())
+	{
+		it = m_pages.insert(m_pages.end(), Page{});
+	}
+
+	it->buffer = std::move(buffer);
+	it->allocator = TlsfAllocator(size);
+	it->bDedicated = bDedicated;
+	return static_cast<std::uint32_t>(it - m_pages.begin());
+}
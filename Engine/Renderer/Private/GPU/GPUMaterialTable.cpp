@@ -0,0 +1,85 @@
+// =============================================================================
+// GPUMaterialTable.cpp — Persistent, versioned GPU array of material records
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/GPU/GPUMaterialTable.h"
+#include "Assets/MaterialDesc.h"
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+GPUMaterialTable::GPUMaterialTable() : m_buffer(sizeof(MaterialRecord), L"MaterialTable") {}
+
+// =============================================================================
+// Updates
+// =============================================================================
+
+void GPUMaterialTable::Build(std::span<const MaterialDesc> descs)
+{
+	++m_version;
+
+	m_materials.clear();
+	if (descs.empty())
+	{
+		m_materials.emplace_back();
+	}
+	else
+	{
+		m_materials.reserve(descs.size());
+		for (const MaterialDesc& desc : descs)
+		{
+			m_materials.push_back(MaterialData::FromDesc(desc));
+		}
+	}
+
+	m_materialVersions.assign(m_materials.size(), m_version);
+	m_changed.clear();
+	m_bRebuilt = true;
+}
+
+bool GPUMaterialTable::Set(std::uint32_t materialId, const MaterialData& material)
+{
+	if (materialId >= m_materials.size() || m_materials[materialId] == material)
+		return false;
+
+	++m_version;
+	m_materials[materialId] = material;
+	m_materialVersions[materialId] = m_version;
+	m_changed.push_back(materialId);
+	return true;
+}
+
+void GPUMaterialTable::Sync(RHIDevice& rhi, std::uint32_t frameIndex)
+{
+	const auto materialCount = static_cast<std::uint32_t>(m_materials.size());
+
+	UploadDirtyTracker& tracker = m_buffer.GetTracker();
+	tracker.BeginUpdate(materialCount);
+	if (m_bRebuilt)
+	{
+		tracker.MarkAllDirty();
+	}
+	else
+	{
+		for (const std::uint32_t materialId : m_changed)
+		{
+			tracker.MarkDirty(materialId);
+		}
+	}
+
+	m_stats.materialCount = materialCount;
+	m_stats.changedMaterials = m_bRebuilt ? materialCount : static_cast<std::uint32_t>(m_changed.size());
+	m_stats.version = m_version;
+	m_stats.bytesUploaded = m_buffer.Sync(rhi, frameIndex, [this](std::uint32_t first, std::uint32_t count, void* dst) {
+		auto* records = static_cast<MaterialRecord*>(dst);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			records[i] = m_materials[first + i].ToRecord();
+		}
+	});
+
+	m_changed.clear();
+	m_bRebuilt = false;
+}
@@ -1,59 +1,312 @@
 // =============================================================================
-// GPUMeshCache.cpp — Lazy GPU mesh upload manager implementation
+// GPUMeshCache.cpp — Budgeted GPU mesh residency with stable slot handles
 // =============================================================================
 
 #include "PCH.h"
 #include "Renderer/Public/GPU/GPUMeshCache.h"
 
-#include "D3D12Rhi.h"
-#include "Scene/Mesh.h"
+#include "RHIConfig.h"
+#include "RHIDevice.h"
 #include "Log.h"
 
+#include <algorithm>
+
 // =============================================================================
 // Construction
 // =============================================================================
 
-GPUMeshCache::GPUMeshCache(D3D12Rhi& rhi) noexcept : m_rhi(&rhi) {}
+GPUMeshCache::GPUMeshCache(RHIDevice& rhi, GPUUploadQueue& uploads, std::uint64_t budgetBytes) noexcept : m_arena(rhi, uploads)
+{
+	m_stats.budgetBytes = budgetBytes;
+}
+
+// =============================================================================
+// Registration
+// =============================================================================
+
+GPUMeshHandle GPUMeshCache::Register(const MeshGeometryHandle& geometry)
+{
+	if (!geometry)
+		return {};
+
+	auto [it, bInserted] = m_slotByContent.try_emplace(geometry->contentHash, INVALID_SLOT);
+	if (bInserted)
+	{
+		it->second = AllocateSlot(geometry);
+		m_slots[it->second].bShared = true;
+		++m_stats.reuseMisses;
+		return {it->second, m_slots[it->second].generation};
+	}
+
+	const std::uint32_t index = it->second;
+	Slot& slot = m_slots[index];
+	if (slot.vertexCount != geometry->GetVertexCount() || slot.indexCount != geometry->GetIndexCount())
+	{
+		LOG_WARNING("[GPUMeshCache] Mesh content hash collision, caching the mesh unshared");
+		const std::uint32_t unshared = AllocateSlot(geometry);
+		++m_stats.reuseMisses;
+		return {unshared, m_slots[unshared].generation};
+	}
+
+	if (!slot.geometry)
+	{
+		// Retained from an earlier mesh list (level reload): revive in place
+		slot.geometry = geometry;
+		--m_stats.retainedCount;
+		++m_stats.registeredCount;
+	}
+
+	// First sight in this mesh list of content an earlier list registered,
+	// whether it was retained or is still registered (level switch)
+	if (slot.registration != m_registration)
+	{
+		if (slot.gpuMesh)
+		{
+			++m_stats.reusedMeshes;
+			m_stats.uploadBytesAvoided += slot.bytes;
+		}
+		else
+		{
+			++m_stats.reuseMisses;
+		}
+	}
+	slot.registration = m_registration;
+	return {index, slot.generation};
+}
+
+void GPUMeshCache::ReleaseUnreferenced()
+{
+	for (std::uint32_t index = 0; index < m_slots.size(); ++index)
+	{
+		Slot& slot = m_slots[index];
+		if (!slot.geometry || slot.registration == m_registration)
+			continue;
+
+		if (!slot.gpuMesh)
+		{
+			FreeSlot(index);  // Nothing uploaded, nothing worth keeping
+			continue;
+		}
+
+		// Keep the GPU buffers (a frame in flight may still read them) under
+		// the content hash; the CPU data can go. The budget evicts them later.
+		slot.geometry.reset();
+		++slot.generation;
+		--m_stats.registeredCount;
+		++m_stats.retainedCount;
+	}
+	++m_registration;
+}
 
 // =============================================================================
-// Cache Operations
+// Per-Frame Use
 // =============================================================================
 
-GPUMesh* GPUMeshCache::GetOrUpload(const Mesh& cpuMesh)
+const GPUMesh* GPUMeshCache::Acquire(GPUMeshHandle handle)
 {
-	const Mesh* key = &cpuMesh;
+	if (!IsLive(handle))
+		return nullptr;
 
-	// Check cache first
-	auto it = m_cache.find(key);
-	if (it != m_cache.end())
+	Slot& slot = m_slots[handle.index];
+	if (slot.gpuMesh)
 	{
-		return it->second.get();
+		++m_stats.hits;
+		if (slot.lastUsedFrame != m_frame)
+		{
+			slot.lastUsedFrame = m_frame;
+			UnlinkLru(handle.index);
+			LinkLru(handle.index);
+		}
+		return slot.gpuMesh.get();
 	}
 
-	// Upload new GPU mesh
+	++m_stats.misses;
 	auto gpuMesh = std::make_unique<GPUMesh>();
-	if (!gpuMesh->Upload(*m_rhi, cpuMesh.GetMeshData()))
+	const GeometryUploadResult result = m_arena.Upload(slot.geometry, *gpuMesh);
+	if (result == GeometryUploadResult::Deferred)
+	{
+		++m_stats.deferredUploads;
+		return nullptr;
+	}
+	if (result == GeometryUploadResult::Failed)
 	{
 		LOG_ERROR("[GPUMeshCache] Failed to upload mesh to GPU");
+		++m_stats.uploadFailures;
 		return nullptr;
 	}
 
-	GPUMesh* result = gpuMesh.get();
-	m_cache.emplace(key, std::move(gpuMesh));
+	slot.bytes = gpuMesh->GetSizeInBytes();
+	slot.gpuMesh = std::move(gpuMesh);
+	slot.lastUsedFrame = m_frame;
+	LinkLru(handle.index);
 
-	return result;
+	++m_stats.residentCount;
+	m_stats.residentBytes += slot.bytes;
+	m_stats.peakResidentBytes = std::max(m_stats.peakResidentBytes, m_stats.residentBytes);
+
+	EnforceBudget();
+	return slot.gpuMesh.get();
+}
+
+void GPUMeshCache::SetBudget(std::uint64_t budgetBytes)
+{
+	m_stats.budgetBytes = budgetBytes;
+	EnforceBudget();
 }
 
 void GPUMeshCache::Clear() noexcept
 {
-	m_cache.clear();
+	m_slots.clear();
+	m_slotByContent.clear();
+	m_arena.Clear();
+	m_freeHead = m_lruHead = m_lruTail = INVALID_SLOT;
+
+	// Lifetime counters are kept
+	m_stats.registeredCount = 0;
+	m_stats.retainedCount = 0;
+	m_stats.residentCount = 0;
+	m_stats.residentBytes = 0;
 }
 
 // =============================================================================
 // Queries
 // =============================================================================
 
-bool GPUMeshCache::Contains(const Mesh& cpuMesh) const noexcept
+bool GPUMeshCache::IsResident(GPUMeshHandle handle) const noexcept
 {
-	return m_cache.contains(&cpuMesh);
+	return IsLive(handle) && m_slots[handle.index].gpuMesh != nullptr;
+}
+
+// =============================================================================
+// Internals
+// =============================================================================
+
+std::uint32_t GPUMeshCache::AllocateSlot(const MeshGeometryHandle& geometry)
+{
+	std::uint32_t index = m_freeHead;
+	if (index != INVALID_SLOT)
+	{
+		m_freeHead = m_slots[index].nextFree;
+		m_slots[index].nextFree = INVALID_SLOT;
+	}
+	else
+	{
+		index = static_cast<std::uint32_t>(m_slots.size());
+		m_slots.emplace_back();
+	}
+
+	Slot& slot = m_slots[index];
+	slot.geometry = geometry;
+	slot.contentHash = geometry->contentHash;
+	slot.vertexCount = geometry->GetVertexCount();
+	slot.indexCount = geometry->GetIndexCount();
+	slot.registration = m_registration;
+	slot.bShared = false;
+	++m_stats.registeredCount;
+	return index;
+}
+
+bool GPUMeshCache::IsLive(GPUMeshHandle handle) const noexcept
+{
+	return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation && m_slots[handle.index].geometry;
+}
+
+// A mesh used in one of the frames still in flight may be read by the GPU.
+bool GPUMeshCache::IsSafeToRelease(const Slot& slot) const noexcept
+{
+	return !slot.gpuMesh || slot.lastUsedFrame + RHISettings::FramesInFlight <= m_frame;
+}
+
+void GPUMeshCache::LinkLru(std::uint32_t index) noexcept
+{
+	Slot& slot = m_slots[index];
+	slot.lruPrev = m_lruTail;
+	slot.lruNext = INVALID_SLOT;
+	if (m_lruTail != INVALID_SLOT)
+	{
+		m_slots[m_lruTail].lruNext = index;
+	}
+	else
+	{
+		m_lruHead = index;
+	}
+	m_lruTail = index;
+}
+
+void GPUMeshCache::UnlinkLru(std::uint32_t index) noexcept
+{
+	Slot& slot = m_slots[index];
+	if (slot.lruPrev != INVALID_SLOT)
+	{
+		m_slots[slot.lruPrev].lruNext = slot.lruNext;
+	}
+	else
+	{
+		m_lruHead = slot.lruNext;
+	}
+	if (slot.lruNext != INVALID_SLOT)
+	{
+		m_slots[slot.lruNext].lruPrev = slot.lruPrev;
+	}
+	else
+	{
+		m_lruTail = slot.lruPrev;
+	}
+	slot.lruPrev = slot.lruNext = INVALID_SLOT;
+}
+
+void GPUMeshCache::Evict(std::uint32_t index) noexcept
+{
+	Slot& slot = m_slots[index];
+	if (!slot.gpuMesh)
+		return;
+
+	UnlinkLru(index);
+	m_arena.Free(*slot.gpuMesh);
+	slot.gpuMesh.reset();
+	--m_stats.residentCount;
+	m_stats.residentBytes -= slot.bytes;
+	slot.bytes = 0;
+}
+
+// Frees a registered or retained slot. Its buffers are released right away,
+// so callers make sure no frame in flight still reads them.
+void GPUMeshCache::FreeSlot(std::uint32_t index) noexcept
+{
+	Evict(index);
+
+	Slot& slot = m_slots[index];
+	if (slot.bShared)
+	{
+		m_slotByContent.erase(slot.contentHash);
+		slot.bShared = false;
+	}
+	if (slot.geometry)
+	{
+		slot.geometry.reset();
+		--m_stats.registeredCount;
+	}
+	else
+	{
+		--m_stats.retainedCount;
+	}
+	++slot.generation;
+	slot.nextFree = m_freeHead;
+	m_freeHead = index;
+}
+
+// The LRU list is ordered by last use, so once its head is still in flight
+// nothing behind it can be evicted either.
+void GPUMeshCache::EnforceBudget() noexcept
+{
+	while (m_stats.residentBytes > m_stats.budgetBytes && m_lruHead != INVALID_SLOT && IsSafeToRelease(m_slots[m_lruHead]))
+	{
+		const std::uint32_t index = m_lruHead;
+		Evict(index);
+		++m_stats.evictions;
+		if (!m_slots[index].geometry)
+		{
+			FreeSlot(index);  // Retained and now empty: nothing left to reuse
+		}
+	}
 }
@@ -0,0 +1,70 @@
+// =============================================================================
+// GPUPersistentBuffer.cpp — Persistently mapped per-frame structured buffer
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/GPU/GPUPersistentBuffer.h"
+
+#include "Log.h"
+
+#include <algorithm>
+#include <bit>
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+GPUPersistentBuffer::GPUPersistentBuffer(std::uint32_t stride, std::wstring debugName) :
+    m_tracker(RHISettings::FramesInFlight), m_debugName(std::move(debugName)), m_stride(stride)
+{
+}
+
+// =============================================================================
+// Sync
+// =============================================================================
+
+std::uint64_t GPUPersistentBuffer::Sync(RHIDevice& rhi, std::uint32_t frameIndex, const FillFn& fill)
+{
+	Copy& copy = m_copies[frameIndex];
+	const std::uint32_t elementCount = m_tracker.GetElementCount();
+
+	if (elementCount > copy.capacity)
+	{
+		if (!Reserve(rhi, copy, elementCount))
+			return 0;
+		m_tracker.InvalidateCopy(frameIndex);
+	}
+
+	m_tracker.CollectRanges(frameIndex, m_ranges);
+
+	auto* mapped = static_cast<std::uint8_t*>(copy.buffer.GetMappedData());
+	std::uint64_t bytesWritten = 0;
+	for (const UploadRange& range : m_ranges)
+	{
+		fill(range.first, range.count, mapped + static_cast<std::size_t>(range.first) * m_stride);
+		bytesWritten += static_cast<std::uint64_t>(range.count) * m_stride;
+	}
+	return bytesWritten;
+}
+
+// =============================================================================
+// Allocation
+// =============================================================================
+
+// Recreates one copy with room for at least elementCount elements. Only called
+// for the current frame slot, whose previous GPU work has already completed.
+bool GPUPersistentBuffer::Reserve(RHIDevice& rhi, Copy& copy, std::uint32_t elementCount)
+{
+	const std::uint32_t capacity = std::bit_ceil(std::max(elementCount, 64u));
+
+	RHIBuffer buffer(rhi, RHIBufferDesc{static_cast<std::uint64_t>(capacity) * m_stride, RHIHeapType::Upload, m_debugName.c_str()});
+	if (!buffer.IsValid())
+	{
+		LOG_ERROR("[GPUPersistentBuffer] Failed to create buffer");
+		return false;
+	}
+
+	copy.buffer = std::move(buffer);
+	copy.capacity = capacity;
+	return true;
+}
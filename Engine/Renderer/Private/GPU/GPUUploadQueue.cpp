@@ -0,0 +1,218 @@
+// =============================================================================
+// GPUUploadQueue.cpp — Batched buffer uploads through a persistent staging ring
+// =============================================================================
+
+#include "PCH.h"
+#include "Renderer/Public/GPU/GPUUploadQueue.h"
+
+#include "RHICommandList.h"
+#include "Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+GPUUploadQueue::GPUUploadQueue(RHIDevice& rhi, std::uint64_t ringSize) : m_rhi(&rhi)
+{
+	m_ring = RHIBuffer(rhi, RHIBufferDesc{ringSize, RHIHeapType::Upload, L"UploadQueue_Ring"});
+	if (!m_ring.IsValid())
+	{
+		// Every request then takes the dedicated staging path
+		LOG_ERROR("[GPUUploadQueue] Failed to create staging ring, falling back to per-request staging buffers");
+		return;
+	}
+
+	m_ringData = static_cast<std::byte*>(m_ring.GetMappedData());
+	m_ringNative = rhi.GetNativeBuffer(m_ring.GetHandle());
+	m_ringAllocator = FencedRingAllocator(ringSize);
+}
+
+// =============================================================================
+// Staging
+// =============================================================================
+
+UploadAllocation GPUUploadQueue::Allocate(std::uint64_t size, std::uint64_t alignment)
+{
+	if (size == 0)
+		return {};
+
+	if (size > m_ringAllocator.GetCapacity())
+		return AllocateDedicated(size);
+
+	const OffsetAllocation block = m_ringAllocator.Allocate(size, alignment);
+	if (!block.IsValid())
+	{
+		++m_ringFullRejections;
+		return {};
+	}
+
+	m_bOpenBatchUsed = true;
+	return {m_ringData + block.offset, m_ringNative, block.offset, size, {m_openBatch}};
+}
+
+void GPUUploadQueue::CopyBuffer(const UploadAllocation& staging, std::uint64_t srcOffset, RHINativeObject dst, std::uint64_t dstOffset, std::uint64_t size)
+{
+	if (!staging.IsValid() || !dst || srcOffset > staging.size || size > staging.size - srcOffset)
+	{
+		LOG_ERROR("[GPUUploadQueue] CopyBuffer outside its staging allocation, copy dropped");
+		return;
+	}
+
+	m_queuedCopies.push_back({dst, dstOffset, staging.buffer, staging.offset + srcOffset, size});
+}
+
+UploadTicket GPUUploadQueue::UploadBuffer(RHINativeObject dst, std::uint64_t dstOffset, const void* data, std::uint64_t size)
+{
+	const UploadAllocation staging = Allocate(size);
+	if (!staging.IsValid())
+		return {};
+
+	std::memcpy(staging.data, data, size);
+	CopyBuffer(staging, 0, dst, dstOffset, size);
+	return staging.ticket;
+}
+
+UploadAllocation GPUUploadQueue::AllocateDedicated(std::uint64_t size)
+{
+	RHIBuffer staging(*m_rhi, RHIBufferDesc{size, RHIHeapType::Upload, L"UploadQueue_DedicatedStaging"});
+	if (!staging.IsValid())
+	{
+		LOG_ERROR("[GPUUploadQueue] Failed to create dedicated staging buffer of " + std::to_string(size) + " bytes");
+		return {};
+	}
+
+	UploadAllocation allocation{static_cast<std::byte*>(staging.GetMappedData()), m_rhi->GetNativeBuffer(staging.GetHandle()), 0, size, {m_openBatch}};
+	m_openDedicatedStaging.push_back(std::move(staging));
+	++m_dedicatedStagingBuffers;
+	m_bOpenBatchUsed = true;
+	return allocation;
+}
+
+// =============================================================================
+// Per-Frame
+// =============================================================================
+
+void GPUUploadQueue::BeginFrame()
+{
+	Retire(m_rhi->GetCompletedFenceValue());
+}
+
+void GPUUploadQueue::RecordCopies(RHICommandList& commandList)
+{
+	m_copiesRecorded = 0;
+	m_bytesRecorded = 0;
+	if (m_queuedCopies.empty())
+		return;
+
+	m_copyTargets.clear();
+	for (const QueuedCopy& copy : m_queuedCopies)
+	{
+		m_copyTargets.push_back(copy.dst);
+	}
+	std::sort(m_copyTargets.begin(), m_copyTargets.end(), [](RHINativeObject a, RHINativeObject b) { return std::less<void*>{}(a.ptr, b.ptr); });
+	m_copyTargets.erase(
+	    std::unique(m_copyTargets.begin(), m_copyTargets.end(), [](RHINativeObject a, RHINativeObject b) { return a.ptr == b.ptr; }),
+	    m_copyTargets.end());
+
+	for (const RHINativeObject target : m_copyTargets)
+	{
+		commandList.TransitionResource(target, ResourceState::Common, ResourceState::CopyDest);
+	}
+
+	for (const QueuedCopy& copy : m_queuedCopies)
+	{
+		commandList.CopyBufferRegion(copy.dst, copy.dstOffset, copy.src, copy.srcOffset, copy.size);
+		m_bytesRecorded += copy.size;
+	}
+
+	// Back to Common: the reads that follow promote it implicitly
+	for (const RHINativeObject target : m_copyTargets)
+	{
+		commandList.TransitionResource(target, ResourceState::CopyDest, ResourceState::Common);
+	}
+
+	m_copiesRecorded = m_queuedCopies.size();
+	m_queuedCopies.clear();
+}
+
+void GPUUploadQueue::EndFrame(std::uint64_t fenceValue)
+{
+	// Unrecorded copies still read the open batch's staging next frame
+	if (!m_bOpenBatchUsed || !m_queuedCopies.empty())
+		return;
+
+	m_ringAllocator.CloseBatch(fenceValue);
+	m_batchesInFlight.push_back({m_openBatch, fenceValue, std::move(m_openDedicatedStaging)});
+	m_openDedicatedStaging.clear();
+	m_bOpenBatchUsed = false;
+	++m_openBatch;
+}
+
+// =============================================================================
+// Tickets
+// =============================================================================
+
+bool GPUUploadQueue::IsComplete(UploadTicket ticket)
+{
+	if (!ticket.IsValid())
+		return false;
+
+	if (ticket.batch > m_completedBatch)
+	{
+		Retire(m_rhi->GetCompletedFenceValue());
+	}
+	return ticket.batch <= m_completedBatch;
+}
+
+bool GPUUploadQueue::Wait(UploadTicket ticket)
+{
+	if (IsComplete(ticket))
+		return true;
+
+	if (!ticket.IsValid() || ticket.batch >= m_openBatch)
+	{
+		LOG_WARNING("[GPUUploadQueue] Wait on a batch that was never submitted");
+		return false;
+	}
+
+	const auto it = std::find_if(m_batchesInFlight.begin(), m_batchesInFlight.end(), [ticket](const Batch& batch) { return batch.id == ticket.batch; });
+	if (it != m_batchesInFlight.end())
+	{
+		m_rhi->WaitForFenceValue(it->fenceValue);
+	}
+	Retire(m_rhi->GetCompletedFenceValue());
+	return true;
+}
+
+void GPUUploadQueue::Retire(std::uint64_t completedFenceValue)
+{
+	m_ringAllocator.Retire(completedFenceValue);
+	while (!m_batchesInFlight.empty() && m_batchesInFlight.front().fenceValue <= completedFenceValue)
+	{
+		m_completedBatch = m_batchesInFlight.front().id;
+		m_batchesInFlight.pop_front();
+	}
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+UploadQueueStats GPUUploadQueue::GetStats() const noexcept
+{
+	const FencedRingAllocatorStats ringStats = m_ringAllocator.GetStats();
+
+	UploadQueueStats stats;
+	stats.ringCapacity = ringStats.capacity;
+	stats.ringUsedBytes = ringStats.usedBytes;
+	stats.batchesInFlight = static_cast<std::uint32_t>(m_batchesInFlight.size());
+	stats.copiesRecorded = m_copiesRecorded;
+	stats.bytesRecorded = m_bytesRecorded;
+	stats.dedicatedStagingBuffers = m_dedicatedStagingBuffers;
+	stats.ringFullRejections = m_ringFullRejections;
+	return stats;
+}
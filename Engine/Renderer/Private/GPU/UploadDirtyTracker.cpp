@@ -0,0 +1,98 @@
+#include "PCH.h"
+#include "Renderer/Public/GPU/UploadDirtyTracker.h"
+
+#include <algorithm>
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+UploadDirtyTracker::UploadDirtyTracker(std::uint32_t copyCount) :
+    m_history(std::max(copyCount, 1u)), m_copyVersions(std::max(copyCount, 1u), 0)
+{
+}
+
+// =============================================================================
+// Recording
+// =============================================================================
+
+void UploadDirtyTracker::BeginUpdate(std::uint32_t elementCount)
+{
+	++m_version;
+
+	Update& update = m_history[m_version % m_history.size()];
+	update.version = m_version;
+	update.bAllDirty = elementCount != m_elementCount;  // Resized — indices may have moved
+	update.indices.clear();                            // Keeps capacity
+
+	m_elementCount = elementCount;
+}
+
+void UploadDirtyTracker::MarkDirty(std::uint32_t index)
+{
+	Update& update = m_history[m_version % m_history.size()];
+	if (!update.bAllDirty && index < m_elementCount)
+	{
+		update.indices.push_back(index);
+	}
+}
+
+void UploadDirtyTracker::MarkAllDirty() noexcept
+{
+	Update& update = m_history[m_version % m_history.size()];
+	update.bAllDirty = true;
+	update.indices.clear();
+}
+
+void UploadDirtyTracker::InvalidateCopy(std::uint32_t copyIndex) noexcept
+{
+	m_copyVersions[copyIndex] = 0;
+}
+
+// =============================================================================
+// Collection
+// =============================================================================
+
+void UploadDirtyTracker::CollectRanges(std::uint32_t copyIndex, std::vector<UploadRange>& outRanges)
+{
+	outRanges.clear();
+
+	const std::uint64_t syncedVersion = m_copyVersions[copyIndex];
+	m_copyVersions[copyIndex] = m_version;
+
+	if (m_elementCount == 0 || syncedVersion == m_version)
+		return;
+
+	// Never synced, or older than the history ring reaches — rewrite everything
+	bool bFull = syncedVersion == 0 || m_version - syncedVersion > m_history.size();
+
+	m_scratch.clear();
+	for (std::uint64_t version = syncedVersion + 1; !bFull && version <= m_version; ++version)
+	{
+		const Update& update = m_history[version % m_history.size()];
+		bFull = update.bAllDirty;
+		m_scratch.insert(m_scratch.end(), update.indices.begin(), update.indices.end());
+	}
+
+	if (bFull)
+	{
+		outRanges.push_back({0, m_elementCount});
+		return;
+	}
+
+	std::sort(m_scratch.begin(), m_scratch.end());
+	for (const std::uint32_t index : m_scratch)
+	{
+		// Indices recorded before the element count shrank are dropped
+		if (index >= m_elementCount)
+			break;
+
+		if (!outRanges.empty() && index <= outRanges.back().first + outRanges.back().count)
+		{
+			const std::uint32_t end = std::max(outRanges.back().first + outRanges.back().count, index + 1);
+			outRanges.back().count = end - outRanges.back().first;
+			continue;
+		}
+		outRanges.push_back({index, 1});
+	}
+}
@@ -14,10 +14,12 @@
 // ============================================================================
 // Windows Configuration
 // ============================================================================
+#if defined(_WIN32)
 #define NOMINMAX
 #ifndef WIN32_LEAN_AND_MEAN
 	#define WIN32_LEAN_AND_MEAN
 #endif
+#endif
 
 // ============================================================================
 // C++ Standard Library
@@ -29,8 +31,11 @@
 
 // ============================================================================
 // DirectX Math - Used extensively in rendering code
+// (optional off Windows: headless tests compile only CPU sources without it)
 // ============================================================================
+#if defined(_WIN32) || __has_include(<DirectXMath.h>)
 #include <DirectXMath.h>
+#endif
 
 // ============================================================================
 // Engine Logging - Available everywhere via PCH
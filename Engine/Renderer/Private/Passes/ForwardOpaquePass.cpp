@@ -6,48 +6,29 @@
 #include "Renderer/Public/SceneData/MeshDraw.h"
 #include "Renderer/Public/GPU/GPUMesh.h"
 #include "Renderer/Public/GPU/GPUMeshCache.h"
-#include "Renderer/Public/TextureManager.h"
+#include "Renderer/Public/GPU/GPUMaterialTable.h"
 #include "Renderer/Public/FrameGraph/PassBuilder.h"
 
-#include "D3D12RootSignature.h"
-#include "D3D12PipelineState.h"
-#include "D3D12ConstantBufferManager.h"
-#include "D3D12ConstantBufferData.h"
-#include "D3D12RootBindings.h"
-#include "D3D12DescriptorHeapManager.h"
-#include "D3D12Texture.h"
-#include "Samplers/D3D12SamplerLibrary.h"
-#include "D3D12SwapChain.h"
-#include "D3D12DepthStencil.h"
-#include "Scene/Mesh.h"
+#include "RHIDevice.h"
+#include "RHIRootBindings.h"
+#include "D3D12/Resources/D3D12ConstantBufferData.h"
 
 #include "Core/Public/Diagnostics/Log.h"
 
+#include <algorithm>
+#include <atomic>
+
 // =============================================================================
 // Construction
 // =============================================================================
 
-ForwardOpaquePass::ForwardOpaquePass(
-    std::string_view name,
-    D3D12RootSignature& rootSignature,
-    D3D12PipelineState& pipelineState,
-    D3D12ConstantBufferManager& constantBufferManager,
-    D3D12DescriptorHeapManager& descriptorHeapManager,
-    TextureManager& textureManager,
-    D3D12SamplerLibrary& samplerLibrary,
-    GPUMeshCache& gpuMeshCache,
-    D3D12SwapChain& swapChain,
-    D3D12DepthStencil& depthStencil) noexcept :
+ForwardOpaquePass::ForwardOpaquePass(std::string_view name, RHIDevice& rhi, GPUMeshCache& gpuMeshCache, GPUMaterialTable& materialTable) noexcept :
     RenderPass(name),
-    m_rootSignature(&rootSignature),
-    m_pipelineState(&pipelineState),
-    m_constantBufferManager(&constantBufferManager),
-    m_descriptorHeapManager(&descriptorHeapManager),
-    m_textureManager(&textureManager),
-    m_samplerLibrary(&samplerLibrary),
+    m_rhi(&rhi),
     m_gpuMeshCache(&gpuMeshCache),
-    m_swapChain(&swapChain),
-    m_depthStencil(&depthStencil)
+    m_materialTable(&materialTable),
+    m_objectBuffer(sizeof(PerObjectData), L"ForwardOpaque_ObjectBuffer"),
+    m_instanceIdBuffer(sizeof(std::uint32_t), L"ForwardOpaque_InstanceObjectIds")
 {
 	LOG_INFO("ForwardOpaquePass: Created");
 }
@@ -59,6 +40,35 @@ ForwardOpaquePass::ForwardOpaquePass(
 void ForwardOpaquePass::Setup(PassBuilder& builder, const SceneView& sceneView)
 {
 	m_sceneView = &sceneView;
+	m_drawList.Build(sceneView);
+	const bool bBatchesChanged = !m_drawList.GetStats().bSortReused;
+	if (bBatchesChanged)
+	{
+		m_batcher.Build(m_drawList.GetPackets(), sceneView.meshDraws);
+	}
+
+	// Record what the persistent object/instance buffers must rewrite this frame
+	UploadDirtyTracker& objectTracker = m_objectBuffer.GetTracker();
+	objectTracker.BeginUpdate(static_cast<std::uint32_t>(sceneView.objectWorlds.size()));
+	if (sceneView.bAllObjectsChanged)
+	{
+		objectTracker.MarkAllDirty();
+	}
+	else
+	{
+		for (const std::uint32_t objectId : sceneView.changedObjects)
+		{
+			objectTracker.MarkDirty(objectId);
+		}
+	}
+
+	UploadDirtyTracker& instanceTracker = m_instanceIdBuffer.GetTracker();
+	instanceTracker.BeginUpdate(static_cast<std::uint32_t>(m_batcher.GetInstanceDrawIndices().size()));
+	if (bBatchesChanged)
+	{
+		instanceTracker.MarkAllDirty();
+	}
+
 	m_backBuffer = builder.UseBackBuffer();
 	m_depthBuffer = builder.UseDepthBuffer();
 }
@@ -69,84 +79,172 @@ void ForwardOpaquePass::Setup(PassBuilder& builder, const SceneView& sceneView)
 
 void ForwardOpaquePass::Execute(RenderContext& context)
 {
-	PrepareTargets(context);
+	PrepareRanges(1);
+	ExecuteRange(context, 0, 1);
+}
+
+// =============================================================================
+// Parallel Recording — batches split into contiguous ranges
+// =============================================================================
+
+std::uint32_t ForwardOpaquePass::GetRecordRangeCount(std::uint32_t maxRanges) const noexcept
+{
+	const auto batchCount = static_cast<std::uint32_t>(m_batcher.GetBatches().size());
+	return std::clamp(batchCount / kMinBatchesPerRange, 1u, std::max(maxRanges, 1u));
+}
+
+void ForwardOpaquePass::PrepareRanges([[maybe_unused]] std::uint32_t rangeCount)
+{
+	// Always sync: Setup began this frame's tracker update, and objects that
+	// changed while culled must still reach this frame's copy
+	UploadObjectData();
+	if (m_batcher.GetBatches().empty())
+	{
+		return;
+	}
+	ResolveMeshes();
+}
+
+void ForwardOpaquePass::ExecuteRange(RenderContext& context, std::uint32_t rangeIndex, std::uint32_t rangeCount)
+{
+	PrepareTargets(context, rangeIndex == 0);
 	ConfigurePipeline(context);
 	BindFrameResources(context);
 	BindGlobalResources(context);
-	DrawOpaqueMeshes(context);
+
+	const std::uint64_t batchCount = m_batcher.GetBatches().size();
+	if (batchCount == 0)
+	{
+		return;
+	}
+
+	const auto first = static_cast<std::uint32_t>(batchCount * rangeIndex / rangeCount);
+	const auto end = static_cast<std::uint32_t>(batchCount * (rangeIndex + 1) / rangeCount);
+	const std::uint32_t frameIndex = m_bindings.frameInFlightIndex;
+	context.BindShaderResource(RootBindings::RootParam::ObjectData, m_objectBuffer.GetGPUAddress(frameIndex));
+	context.BindShaderResource(RootBindings::RootParam::MaterialTable, m_materialTable->GetGPUAddress(frameIndex));
+	DrawOpaqueMeshes(context, first, end);
 }
 
-// Transitions, binds, and clears render targets for this pass.
-void ForwardOpaquePass::PrepareTargets(RenderContext& context)
+// Binds render targets for this pass (FrameGraph has already transitioned them
+// to the states declared in Setup); the first range also clears them.
+void ForwardOpaquePass::PrepareTargets(RenderContext& context, bool bClear)
 {
-	// Transition resources to writable states
-	// MVP: Direct calls until FrameGraph manages transitions
-	m_swapChain->SetRenderTargetState();
-	m_depthStencil->SetWriteState();
-
 	// Bind render targets
-	D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_swapChain->GetCPUHandle();
-	D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = m_depthStencil->GetCPUHandle();
-	context.SetRenderTarget(rtvHandle, &dsvHandle);
+	context.SetRenderTarget(m_bindings.renderTarget, &m_bindings.depthStencil);
 
 	// Clear targets
-	m_swapChain->Clear();
-	m_depthStencil->Clear();
+	if (bClear)
+	{
+		context.ClearRenderTarget(m_bindings.renderTarget, m_bindings.clearColor);
+		context.ClearDepthStencil(m_bindings.depthStencil, m_bindings.clearDepth);
+	}
 }
 
 // Configures root signature, viewport/scissor, and pipeline state.
 void ForwardOpaquePass::ConfigurePipeline(RenderContext& context)
 {
-	context.SetRootSignature(m_rootSignature->GetRaw());
+	context.SetRootSignature(m_bindings.rootSignature.ptr);
 
-	// Viewport and scissor from swap chain defaults
-	const D3D12_VIEWPORT viewport = m_swapChain->GetDefaultViewport();
-	context.SetViewport(viewport.TopLeftX, viewport.TopLeftY, viewport.Width, viewport.Height, viewport.MinDepth, viewport.MaxDepth);
-
-	const D3D12_RECT scissor = m_swapChain->GetDefaultScissorRect();
-	context.SetScissorRect(scissor.left, scissor.top, scissor.right, scissor.bottom);
+	// Viewport and scissor cover the whole target
+	const auto width = static_cast<float>(m_bindings.width);
+	const auto height = static_cast<float>(m_bindings.height);
+	context.SetViewport(0.0f, 0.0f, width, height, 0.0f, 1.0f);
+	context.SetScissorRect(0, 0, static_cast<std::int32_t>(m_bindings.width), static_cast<std::int32_t>(m_bindings.height));
 
 	// Set pipeline state and primitive topology
-	context.SetPipelineState(m_pipelineState->Get().Get());
-	context.SetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	context.SetPipelineState(m_bindings.pipelineState.ptr);
+	context.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
 }
 
 // Binds per-frame and per-view constant buffers.
 void ForwardOpaquePass::BindFrameResources(RenderContext& context)
 {
 	// Bind per-frame constant buffer (b0)
-	context.BindConstantBuffer(RootBindings::RootParam::PerFrame, m_constantBufferManager->GetPerFrameGpuAddress());
+	context.BindConstantBuffer(RootBindings::RootParam::PerFrame, m_bindings.perFrameConstants);
 
 	// Bind per-view constant buffer (b1)
-	context.BindConstantBuffer(RootBindings::RootParam::PerView, m_constantBufferManager->GetPerViewGpuAddress());
+	context.BindConstantBuffer(RootBindings::RootParam::PerView, m_bindings.perViewConstants);
 }
 
 // Binds descriptor heaps, default textures, and sampler tables.
 void ForwardOpaquePass::BindGlobalResources(RenderContext& context)
 {
-	// Set shader-visible descriptor heaps
-	m_descriptorHeapManager->SetShaderVisibleHeaps();
+	// Set shader-visible descriptor heaps (on this range's command list)
+	context.SetDescriptorHeaps(m_bindings.resourceHeap, m_bindings.samplerHeap);
 
 	// Bind default texture SRV
-	if (const D3D12Texture* checkerTex = m_textureManager->GetTexture(TextureId::Checker))
+	if (m_bindings.textureTable.ptr != 0)
 	{
-		context.BindDescriptorTable(RootBindings::RootParam::TextureSRV, checkerTex->GetGPUHandle());
+		context.BindDescriptorTable(RootBindings::RootParam::TextureSRV, m_bindings.textureTable);
 	}
 
 	// Bind sampler table
-	if (m_samplerLibrary->IsInitialized())
+	if (m_bindings.samplerTable.ptr != 0)
 	{
-		context.BindDescriptorTable(RootBindings::RootParam::SamplerTable, m_samplerLibrary->GetTableGPUHandle());
+		context.BindDescriptorTable(RootBindings::RootParam::SamplerTable, m_bindings.samplerTable);
 	}
 }
 
-// Issues draw calls for all opaque meshes in the scene view.
-void ForwardOpaquePass::DrawOpaqueMeshes(RenderContext& context)
+// Brings this frame's copies of the object buffer (t1) and instance ID
+// buffer (t2) up to date, rewriting only the ranges that changed.
+void ForwardOpaquePass::UploadObjectData()
+{
+	const std::uint32_t frameIndex = m_bindings.frameInFlightIndex;
+	DrawListStats& stats = m_drawList.GetStats();
+
+	const auto worlds = m_sceneView->objectWorlds;
+	const auto worldInvTransposes = m_sceneView->objectWorldInvTransposes;
+	stats.objectBytesUploaded = m_objectBuffer.Sync(*m_rhi, frameIndex, [&](std::uint32_t first, std::uint32_t count, void* dst) {
+		auto* objects = static_cast<PerObjectData*>(dst);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			objects[i].WorldMTX = worlds[first + i];
+			objects[i].WorldInvTransposeMTX = worldInvTransposes[first + i];
+		}
+	});
+
+	const auto instanceDrawIndices = m_batcher.GetInstanceDrawIndices();
+	stats.instanceBytesUploaded = m_instanceIdBuffer.Sync(*m_rhi, frameIndex, [&](std::uint32_t first, std::uint32_t count, void* dst) {
+		auto* objectIds = static_cast<std::uint32_t*>(dst);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			objectIds[i] = m_sceneView->meshDraws[instanceDrawIndices[first + i]].objectId;
+		}
+	});
+}
+
+// Acquires (uploading if not resident) each batch's GPU mesh by slot handle,
+// so ranges recorded on worker threads never touch the cache. The copies of
+// newly resident meshes go on the frame list, which is submitted ahead of any
+// worker list.
+void ForwardOpaquePass::ResolveMeshes()
 {
-	for (const auto& draw : m_sceneView->meshDraws)
+	const auto batches = m_batcher.GetBatches();
+	m_batchMeshes.resize(batches.size());
+	for (std::size_t i = 0; i < batches.size(); ++i)
 	{
-		const auto* cpuMesh = static_cast<const Mesh*>(draw.meshPtr);
-		GPUMesh* gpuMesh = m_gpuMeshCache->GetOrUpload(*cpuMesh);
+		m_batchMeshes[i] = m_gpuMeshCache->Acquire(batches[i].meshHandle);
+	}
+	m_gpuMeshCache->RecordUploads(m_rhi->GetRHICommandList(m_bindings.frameInFlightIndex));
+}
+
+// Issues one instanced draw per batch of [first, end) in sort-key order,
+// skipping geometry and material binds that match the previous batch.
+void ForwardOpaquePass::DrawOpaqueMeshes(RenderContext& context, std::uint32_t first, std::uint32_t end)
+{
+	const RHIGpuAddress instanceIds = m_instanceIdBuffer.GetGPUAddress(m_bindings.frameInFlightIndex);
+	const auto batches = m_batcher.GetBatches();
+
+	std::uint32_t meshBindsElided = 0;
+	std::uint32_t materialBindsElided = 0;
+	const GPUMesh* boundMesh = nullptr;
+	std::uint32_t boundMaterialId = UINT32_MAX;
+
+	for (std::uint32_t i = first; i < end; ++i)
+	{
+		const InstanceBatch& batch = batches[i];
+		const GPUMesh* gpuMesh = m_batchMeshes[i];
 
 		if (!gpuMesh || !gpuMesh->IsValid())
 		{
@@ -154,21 +252,40 @@ void ForwardOpaquePass::DrawOpaqueMeshes(RenderContext& context)
 		}
 
 		// Bind geometry
-		context.BindVertexBuffer(gpuMesh->GetVertexBufferView());
-		context.BindIndexBuffer(gpuMesh->GetIndexBufferView());
-
-		// Per-object VS constant buffer (b2) — world transforms
-		PerObjectVSConstantBufferData perObjectVS{};
-		perObjectVS.WorldMTX = draw.worldMatrix;
-		perObjectVS.WorldInvTransposeMTX = draw.worldInvTranspose;
+		if (gpuMesh != boundMesh)
+		{
+			context.BindVertexBuffer(gpuMesh->GetVertexBufferView());
+			context.BindIndexBuffer(gpuMesh->GetIndexBufferView());
+			boundMesh = gpuMesh;
+		}
+		else
+		{
+			++meshBindsElided;
+		}
 
-		context.BindConstantBuffer(RootBindings::RootParam::PerObjectVS, m_constantBufferManager->UpdatePerObjectVS(perObjectVS));
+		// Instance -> object IDs (t2) — bound at the batch's first instance so
+		// SV_InstanceID indexes the batch directly
+		context.BindShaderResource(
+		    RootBindings::RootParam::InstanceObjectIds,
+		    instanceIds + static_cast<std::uint64_t>(batch.firstInstance) * sizeof(std::uint32_t));
 
-		context.BindConstantBuffer(
-		    RootBindings::RootParam::PerObjectPS,
-		    m_constantBufferManager->UpdatePerObjectPS(m_sceneView->materials[draw.materialId].ToPerObjectPSData()));
+		// Material index (b3) into the material table; the set one stays valid
+		if (batch.materialId != boundMaterialId)
+		{
+			context.SetRootConstant(RootBindings::RootParam::MaterialIndex, batch.materialId);
+			boundMaterialId = batch.materialId;
+		}
+		else
+		{
+			++materialBindsElided;
+		}
 
 		// Issue draw call
-		context.DrawIndexedInstanced(gpuMesh->GetIndexCount(), 1, 0, 0, 0);
+		context.DrawIndexedInstanced(gpuMesh->GetIndexCount(), batch.instanceCount, 0, 0, 0);
 	}
+
+	// Ranges may record concurrently
+	DrawListStats& stats = m_drawList.GetStats();
+	std::atomic_ref<std::uint32_t>(stats.meshBindsElided).fetch_add(meshBindsElided, std::memory_order_relaxed);
+	std::atomic_ref<std::uint32_t>(stats.materialBindsElided).fetch_add(materialBindsElided, std::memory_order_relaxed);
 }
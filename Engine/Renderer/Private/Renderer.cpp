@@ -10,8 +10,9 @@
 #include "ShaderCompileResult.h"
 #include "TextureManager.h"
 #include "Renderer/Public/GPU/GPUMeshCache.h"
+#include "Renderer/Public/GPU/GPUUploadQueue.h"
+#include "Renderer/Public/GPU/GPUMaterialTable.h"
 #include "Scene/Scene.h"
-#include "Scene/Mesh.h"
 #include "D3D12PipelineState.h"
 #include "D3D12RootSignature.h"
 #include "D3D12ConstantBuffer.h"
@@ -19,17 +20,24 @@
 #include "D3D12ConstantBufferData.h"
 #include "D3D12FrameResource.h"
 #include "D3D12VertexLayout.h"
+#include "D3D12DescriptorHeapManager.h"
+#include "D3D12Texture.h"
 #include "Samplers/D3D12SamplerLibrary.h"
 #include "D3D12DepthStencil.h"
 #include "DepthConvention.h"
 #include "UI.h"
 #include "Time/Timer.h"
 #include "Renderer/Public/Camera/RenderCamera.h"
+#include "Renderer/Public/SceneData/SceneViewBuilder.h"
 #include "Renderer/Public/RenderContext.h"
 #include "Renderer/Public/FrameGraph/FrameGraph.h"
 #include "Renderer/Public/Passes/ForwardOpaquePass.h"
 #include "Scene/Camera/GameCamera.h"
 
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
 Renderer::Renderer(Timer& timer, const AssetSystem& assetSystem, Scene& scene, Window& window) noexcept :
     m_timer(&timer), m_assetSystem(&assetSystem), m_scene(&scene), m_window(&window)
 {
@@ -63,7 +71,6 @@ Renderer::Renderer(Timer& timer, const AssetSystem& assetSystem, Scene& scene, W
 	    *m_rhi,
 	    *m_window,
 	    *m_descriptorHeapManager,
-	    *m_frameResourceManager,
 	    *m_swapChain,
 	    *m_ui);
 
@@ -73,8 +80,14 @@ Renderer::Renderer(Timer& timer, const AssetSystem& assetSystem, Scene& scene, W
 	// Create texture manager (auto-loads default textures)
 	m_textureManager = std::make_unique<TextureManager>(*m_assetSystem, *m_rhi, *m_descriptorHeapManager);
 
-	// Create GPU mesh cache for lazy uploading CPU meshes
-	m_gpuMeshCache = std::make_unique<GPUMeshCache>(*m_rhi);
+	// Upload queue first: the mesh cache stages geometry through it
+	m_uploadQueue = std::make_unique<GPUUploadQueue>(*m_rhi);
+
+	// Create GPU mesh cache for lazy uploading CPU meshes (default VRAM budget)
+	m_gpuMeshCache = std::make_unique<GPUMeshCache>(*m_rhi, *m_uploadQueue);
+
+	// Material table, filled on the first UpdateMaterials
+	m_materialTable = std::make_unique<GPUMaterialTable>();
 
 	// Subscribe to events
 	SubscribeToDepthModeChanges();
@@ -88,29 +101,22 @@ Renderer::Renderer(Timer& timer, const AssetSystem& assetSystem, Scene& scene, W
 	// Create render camera bound to scene's game camera
 	m_renderCamera = std::make_unique<RenderCamera>(m_scene->GetCamera());
 
-	// Create Frame Graph and register passes
-	m_frameGraph = std::make_unique<FrameGraph>(m_swapChain.get(), m_depthStencil.get());
-	m_frameGraph->AddPass<ForwardOpaquePass>(
-	    "ForwardOpaque",
-	    *m_rootSignature,
-	    *m_pso,
-	    *m_constantBufferManager,
-	    *m_descriptorHeapManager,
-	    *m_textureManager,
-	    *m_samplerLibrary,
-	    *m_gpuMeshCache,
-	    *m_swapChain,
-	    *m_depthStencil);
+	m_sceneViewBuilder = std::make_unique<SceneViewBuilder>(*m_scene, *m_renderCamera, *m_gpuMeshCache, *m_materialTable);
+
+	// Create Frame Graph and register passes (backend objects are bound per frame in RecordFrame)
+	m_frameGraph = std::make_unique<FrameGraph>();
+	m_forwardOpaquePass = &m_frameGraph->AddPass<ForwardOpaquePass>("ForwardOpaque", *m_rhi, *m_gpuMeshCache, *m_materialTable);
 
 	PostLoad();
 }
 
 void Renderer::PostLoad() noexcept
 {
-	// Execute initialization commands and sync with GPU
+	// Execute initialization commands. No flush: the fence stamps the init
+	// frame slot, and the first frame reusing that slot waits on it
 	m_rhi->CloseCommandList();
 	m_rhi->ExecuteCommandList();
-	m_rhi->Flush();
+	m_rhi->Signal(m_rhi->GetCurrentFrameIndex());
 }
 
 
@@ -124,6 +130,17 @@ void Renderer::OnResize() noexcept
 	m_rhi->Flush();
 	m_swapChain->Resize();
 	CreateDepthStencilBuffer();
+	RebindFrameGraph();
+}
+
+// Recreated targets and PSOs reach the passes through the next frame's
+// bindings; the compiled plan is invalidated so that frame recompiles.
+void Renderer::RebindFrameGraph() noexcept
+{
+	if (!m_frameGraph)
+		return;
+
+	m_frameGraph->Invalidate();
 }
 
 void Renderer::SubscribeToDepthModeChanges() noexcept
@@ -163,6 +180,8 @@ void Renderer::BeginFrame() noexcept
 	m_rhi->WaitForGPU(frameIndex);
 	m_rhi->ResetCommandAllocator(frameIndex);
 	m_rhi->ResetCommandList(frameIndex);
+	m_uploadQueue->BeginFrame();
+	m_gpuMeshCache->BeginFrame();
 }
 
 void Renderer::SetupFrame() noexcept
@@ -176,8 +195,8 @@ void Renderer::SetupFrame() noexcept
 
 void Renderer::RecordFrame() noexcept
 {
-	// Build scene view from current frame state
-	SceneView sceneView = BuildSceneView();
+	// Bring the persistent scene view up to date (deltas only)
+	const SceneView& sceneView = m_sceneViewBuilder->Update(m_window->GetWidth(), m_window->GetHeight());
 
 	// Build per-view constant buffer data (camera + sun light)
 	PerViewConstantBufferData viewData = m_renderCamera->GetViewConstantBufferData();
@@ -186,23 +205,61 @@ void Renderer::RecordFrame() noexcept
 	viewData.SunColor = sceneView.sunLight.color;
 	m_constantBufferManager->UpdatePerView(viewData);
 
+	// Upload materials changed since this frame slot was last used
+	const std::uint32_t frameIndex = m_rhi->GetCurrentFrameIndex();
+	m_materialTable->Sync(*m_rhi, frameIndex);
+
+	// Backend objects for this frame: current back buffer, frame slot, pipeline
+	ForwardOpaqueBindings bindings;
+	bindings.rootSignature = RHINativeObject{m_rootSignature->GetRaw()};
+	bindings.pipelineState = RHINativeObject{m_pso->Get().Get()};
+	bindings.renderTarget = RHICpuDescriptor{m_swapChain->GetCPUHandle().ptr};
+	bindings.depthStencil = RHICpuDescriptor{m_depthStencil->GetCPUHandle().ptr};
+	std::copy(std::begin(D3D12SwapChain::kClearColor), std::end(D3D12SwapChain::kClearColor), bindings.clearColor);
+	bindings.clearDepth = DepthConvention::GetClearDepth();
+	bindings.width = sceneView.width;
+	bindings.height = sceneView.height;
+	bindings.perFrameConstants = m_constantBufferManager->GetPerFrameGpuAddress();
+	bindings.perViewConstants = m_constantBufferManager->GetPerViewGpuAddress();
+	bindings.resourceHeap = RHINativeObject{m_descriptorHeapManager->GetHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV)->GetRaw()};
+	bindings.samplerHeap = RHINativeObject{m_descriptorHeapManager->GetHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER)->GetRaw()};
+	if (const D3D12Texture* checkerTex = m_textureManager->GetTexture(TextureId::Checker))
+	{
+		bindings.textureTable = RHIGpuDescriptor{checkerTex->GetGPUHandle().ptr};
+	}
+	if (m_samplerLibrary->IsInitialized())
+	{
+		bindings.samplerTable = RHIGpuDescriptor{m_samplerLibrary->GetTableGPUHandle().ptr};
+	}
+	bindings.frameInFlightIndex = frameIndex;
+	m_forwardOpaquePass->SetBindings(bindings);
+
+	m_frameGraph->SetImportedResource(ResourceHandle::BackBuffer(), RHINativeObject{m_swapChain->GetCurrentBackBuffer()});
+	m_frameGraph->SetImportedResource(ResourceHandle::DepthBuffer(), RHINativeObject{m_depthStencil->GetResource().Get()});
+
 	// Frame graph: declare resource usage
 	m_frameGraph->Setup(sceneView);
 
-	// Frame graph: compile (MVP: no-op)
+	// Frame graph: schedule passes and compute resource transitions
 	m_frameGraph->Compile();
 
-	// Create render context for this frame's command list
-	RenderContext context(m_rhi->GetCommandList().Get());
+	// Create render context over this frame's RHI command list
+	RenderContext context(m_rhi->GetRHICommandList(frameIndex));
 
-	// Frame graph: record all pass commands
-	m_frameGraph->Execute(context);
+	// Frame graph: record all pass commands (split across worker threads when
+	// there is enough work, submitted in schedule order)
+	m_frameGraph->ExecuteParallel(context, *m_rhi, frameIndex, std::thread::hardware_concurrency());
 
-	// UI overlay (after all passes, before present transition)
+	// UI overlay (after all passes, before present transition). Its target and
+	// heaps are bound here: after parallel recording the frame list has been
+	// reopened and carries no state from the passes
+	const RHICpuDescriptor backBufferRtv{m_swapChain->GetCPUHandle().ptr};
+	context.SetRenderTarget(backBufferRtv, nullptr);
+	m_descriptorHeapManager->SetShaderVisibleHeaps();
 	m_ui->Render();
 
-	// Transition resources for presentation
-	m_depthStencil->SetReadState();
+	// Transition the back buffer for presentation (the frame graph already
+	// returned depth to its read state)
 	m_swapChain->SetPresentState();
 }
 
@@ -212,6 +269,9 @@ void Renderer::SubmitFrame() noexcept
 	m_rhi->ExecuteCommandList();
 	m_rhi->Signal(m_swapChain->GetFrameInFlightIndex());
 
+	// This frame's copies retire with its fence value
+	m_uploadQueue->EndFrame(m_rhi->GetFenceValueForFrame(m_swapChain->GetFrameInFlightIndex()));
+
 	// Record fence value for ring buffer synchronization
 	m_frameResourceManager->EndFrame(m_rhi->GetNextFenceValue() - 1);
 	m_swapChain->Present();
@@ -222,69 +282,34 @@ void Renderer::EndFrame() noexcept
 	m_swapChain->UpdateFrameInFlightIndex();
 }
 
-// -----------------------------------------------------------------------------
-// Scene View — per-frame data preparation
-// -----------------------------------------------------------------------------
-
-SceneView Renderer::BuildSceneView() const
+const SceneViewStats& Renderer::GetLastSceneViewStats() const noexcept
 {
-	SceneView view = {};
-	InitializeSceneView(view);
-
-	// Materials and draw commands
-	BuildMaterials(view);
-	BuildMeshDraws(view);
-
-	return view;
+	return m_sceneViewBuilder->GetSceneView().stats;
 }
 
-void Renderer::InitializeSceneView(SceneView& view) const
+const DrawListStats& Renderer::GetLastOpaqueDrawStats() const noexcept
 {
-	// Viewport (from window, which swap chain tracks)
-	view.width = m_window->GetWidth();
-	view.height = m_window->GetHeight();
-
-	// Camera — store pointer to already-updated RenderCamera
-	view.camera = m_renderCamera.get();
-
-	// Lighting — struct defaults (sun down, white, intensity 1)
+	return m_forwardOpaquePass->GetDrawStats();
 }
 
-void Renderer::BuildMaterials(SceneView& view) const
+const InstanceBatchStats& Renderer::GetLastOpaqueBatchStats() const noexcept
 {
-	const auto& loadedMaterials = m_scene->GetLoadedMaterials();
-	if (!loadedMaterials.empty())
-	{
-		view.materials.reserve(loadedMaterials.size());
-		for (const auto& desc : loadedMaterials)
-		{
-			view.materials.push_back(MaterialData::FromDesc(desc));
-		}
-	}
-	else
-	{
-		// Single default PBR material at index 0
-		view.materials.emplace_back();
-	}
+	return m_forwardOpaquePass->GetBatchStats();
 }
 
-void Renderer::BuildMeshDraws(SceneView& view) const
+const FrameGraphCompileStats& Renderer::GetFrameGraphCompileStats() const noexcept
 {
-	if (!m_scene || !m_scene->HasMeshes())
-		return;
+	return m_frameGraph->GetCompileStats();
+}
 
-	const auto& meshes = m_scene->GetMeshes();
-	view.meshDraws.reserve(meshes.size());
+const GPUMeshCacheStats& Renderer::GetMeshCacheStats() const noexcept
+{
+	return m_gpuMeshCache->GetStats();
+}
 
-	for (const auto& mesh : meshes)
-	{
-		MeshDraw draw = {};
-		DirectX::XMStoreFloat4x4(&draw.worldMatrix, mesh->GetWorldMatrix());
-		DirectX::XMStoreFloat3x4(&draw.worldInvTranspose, mesh->GetWorldInverseTransposeMatrix());
-		draw.materialId = mesh->GetMaterialId();
-		draw.meshPtr = mesh.get();
-		view.meshDraws.push_back(draw);
-	}
+const MaterialTableStats& Renderer::GetMaterialTableStats() const noexcept
+{
+	return m_materialTable->GetStats();
 }
 
 // -----------------------------------------------------------------------------
@@ -296,6 +321,7 @@ Renderer::~Renderer() noexcept
 
 
 	m_frameGraph.reset();
+	m_sceneViewBuilder.reset();
 
 	m_renderCamera.reset();
 
@@ -329,4 +355,5 @@ void Renderer::OnDepthModeChanged([[maybe_unused]] DepthMode mode) noexcept
 	m_rhi->Flush();
 	CreatePSO();
 	CreateDepthStencilBuffer();
+	RebindFrameGraph();
 }
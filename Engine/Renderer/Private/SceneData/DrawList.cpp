@@ -0,0 +1,235 @@
+#include "PCH.h"
+#include "Renderer/Public/SceneData/DrawList.h"
+
+#include "Renderer/Public/SceneData/SceneView.h"
+#include "Renderer/Public/Camera/RenderCamera.h"
+#include "Time/Timer.h"
+
+#include <algorithm>
+#include <array>
+#include <barrier>
+#include <thread>
+
+namespace DrawListInternal
+{
+	constexpr std::uint32_t kDigitBits = 8;
+	constexpr std::uint32_t kBucketCount = 1u << kDigitBits;
+	constexpr std::uint32_t kDigitCount = 64 / kDigitBits;
+	constexpr std::uint32_t kMaxSortWorkers = 8;
+
+	using Histogram = std::array<std::uint32_t, kBucketCount>;
+
+	[[nodiscard]] std::uint32_t GetDigit(std::uint64_t key, std::uint32_t shift) noexcept
+	{
+		return static_cast<std::uint32_t>(key >> shift) & (kBucketCount - 1);
+	}
+
+	// Runs fn(chunk) for every chunk; chunk 0 on the calling thread
+	template <typename Fn> void ForEachChunk(std::uint32_t chunkCount, const Fn& fn)
+	{
+		if (chunkCount == 1)
+		{
+			fn(0u);
+			return;
+		}
+
+		std::vector<std::jthread> workers;
+		workers.reserve(chunkCount - 1);
+		for (std::uint32_t chunk = 1; chunk < chunkCount; ++chunk)
+		{
+			workers.emplace_back(fn, chunk);
+		}
+		fn(0u);
+	}  // jthreads join here
+
+	[[nodiscard]] std::uint32_t GetSortWorkerCount(std::size_t packetCount) noexcept
+	{
+		if (packetCount < DrawList::kParallelSortThreshold)
+			return 1;
+		return std::clamp(std::thread::hardware_concurrency(), 1u, kMaxSortWorkers);
+	}
+
+}  // namespace DrawListInternal
+
+// =============================================================================
+// Sort Key
+// =============================================================================
+
+std::uint32_t DrawSortKey::QuantizeDepth(float viewDepth, float farZ) noexcept
+{
+	constexpr float kMaxDepth = static_cast<float>((1u << kDepthBits) - 1);
+	const float normalized = farZ > 0.0f ? std::clamp(viewDepth / farZ, 0.0f, 1.0f) : 0.0f;
+	return static_cast<std::uint32_t>(normalized * kMaxDepth);
+}
+
+std::uint32_t DrawSortKey::HashMesh(const void* geometry) noexcept
+{
+	// Murmur3 finalizer — spreads allocator-aligned pointers over the field
+	std::uint64_t h = reinterpret_cast<std::uintptr_t>(geometry);
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDull;
+	h ^= h >> 33;
+	return static_cast<std::uint32_t>(h) & ((1u << kMeshBits) - 1);
+}
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void DrawList::Build(const SceneView& sceneView)
+{
+	const auto& draws = sceneView.meshDraws;
+
+	m_stats.meshBindsElided = 0;
+	m_stats.materialBindsElided = 0;
+	m_stats.objectBytesUploaded = 0;
+	m_stats.instanceBytesUploaded = 0;
+
+	// Same draws, same camera: last frame's order is still correct
+	if (sceneView.stats.bDrawListReused && m_packets.size() == draws.size())
+	{
+		m_stats.bSortReused = true;
+		m_stats.sortPasses = 0;
+		m_stats.sortMs = 0.0;
+		return;
+	}
+
+	const Timer::Stopwatch sortTimer;
+
+	DirectX::XMFLOAT3 cameraPosition = {0.0f, 0.0f, 0.0f};
+	DirectX::XMFLOAT3 cameraDirection = {0.0f, 0.0f, 1.0f};
+	float farZ = 1.0f;
+	if (sceneView.camera)
+	{
+		cameraPosition = sceneView.camera->GetPosition();
+		cameraDirection = sceneView.camera->GetDirection();
+		farZ = sceneView.camera->GetFarZ();
+	}
+
+	// Single opaque pipeline today; the field is there for when passes own several
+	constexpr std::uint32_t kOpaquePipeline = 0;
+
+	m_packets.resize(draws.size());
+	for (std::size_t i = 0; i < draws.size(); ++i)
+	{
+		const MeshDraw& draw = draws[i];
+		const DirectX::XMFLOAT4X4& world = sceneView.objectWorlds[draw.objectId];
+
+		const float dx = world._41 - cameraPosition.x;
+		const float dy = world._42 - cameraPosition.y;
+		const float dz = world._43 - cameraPosition.z;
+		const float viewDepth = dx * cameraDirection.x + dy * cameraDirection.y + dz * cameraDirection.z;
+
+		m_packets[i].sortKey = DrawSortKey::Encode(
+		    kOpaquePipeline,
+		    draw.materialId,
+		    DrawSortKey::HashMesh(draw.geometry),
+		    DrawSortKey::QuantizeDepth(viewDepth, farZ));
+		m_packets[i].drawIndex = static_cast<std::uint32_t>(i);
+	}
+
+	m_stats.sortPasses = RadixSort(m_packets, m_scratch, DrawListInternal::GetSortWorkerCount(m_packets.size()));
+	m_stats.sortMs = sortTimer.ElapsedMillis();
+	m_stats.drawCount = static_cast<std::uint32_t>(m_packets.size());
+	m_stats.bSortReused = false;
+}
+
+// =============================================================================
+// Radix Sort
+// =============================================================================
+
+std::uint32_t DrawList::RadixSort(std::vector<DrawPacket>& packets, std::vector<DrawPacket>& scratch, std::uint32_t workerCount)
+{
+	using namespace DrawListInternal;
+
+	const std::size_t count = packets.size();
+	if (count < 2)
+		return 0;
+
+	scratch.resize(count);
+	const std::uint32_t chunkCount = static_cast<std::uint32_t>(std::clamp<std::size_t>(workerCount, 1, count));
+	const auto chunkBegin = [count, chunkCount](std::uint32_t chunk) { return count * chunk / chunkCount; };
+
+	std::vector<Histogram> histograms(chunkCount);
+	DrawPacket* src = packets.data();
+	DrawPacket* dst = scratch.data();
+	std::uint32_t shift = 0;
+	bool bSkipDigit = false;
+	std::uint32_t scatteredPasses = 0;
+
+	// Between the histogram and scatter phases of a digit, on one thread
+	const auto buildOffsets = [&]() noexcept {
+		// Every key shares this digit — the pass would be an identity copy
+		const std::uint32_t firstBucket = GetDigit(src[0].sortKey, shift);
+		std::size_t firstBucketTotal = 0;
+		for (const Histogram& histogram : histograms)
+		{
+			firstBucketTotal += histogram[firstBucket];
+		}
+		bSkipDigit = firstBucketTotal == count;
+		if (bSkipDigit)
+			return;
+
+		// Exclusive prefix: bucket-major, then chunk order (keeps the sort stable)
+		std::uint32_t offset = 0;
+		for (std::uint32_t bucket = 0; bucket < kBucketCount; ++bucket)
+		{
+			for (Histogram& histogram : histograms)
+			{
+				const std::uint32_t bucketCount = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketCount;
+			}
+		}
+	};
+
+	// After every chunk scattered a digit, on one thread
+	const auto finishDigit = [&]() noexcept {
+		if (!bSkipDigit)
+		{
+			std::swap(src, dst);
+			++scatteredPasses;
+		}
+		shift += kDigitBits;
+	};
+
+	std::barrier histogramsBuilt(chunkCount, buildOffsets);
+	std::barrier digitScattered(chunkCount, finishDigit);
+
+	// Each chunk's thread lives for the whole sort and meets the others at
+	// the two barriers of every digit
+	ForEachChunk(chunkCount, [&](std::uint32_t chunk) {
+		Histogram& histogram = histograms[chunk];
+		const std::size_t begin = chunkBegin(chunk);
+		const std::size_t end = chunkBegin(chunk + 1);
+
+		for (std::uint32_t digit = 0; digit < kDigitCount; ++digit)
+		{
+			// 1. Chunk histogram
+			histogram.fill(0);
+			for (std::size_t i = begin; i < end; ++i)
+			{
+				++histogram[GetDigit(src[i].sortKey, shift)];
+			}
+
+			// 2. Skip test and prefix offsets (buildOffsets)
+			histogramsBuilt.arrive_and_wait();
+
+			// 3. Scatter into this chunk's disjoint destination ranges
+			if (!bSkipDigit)
+			{
+				for (std::size_t i = begin; i < end; ++i)
+				{
+					dst[histogram[GetDigit(src[i].sortKey, shift)]++] = src[i];
+				}
+			}
+			digitScattered.arrive_and_wait();
+		}
+	});
+
+	if (src != packets.data())
+	{
+		packets.swap(scratch);
+	}
+	return scatteredPasses;
+}
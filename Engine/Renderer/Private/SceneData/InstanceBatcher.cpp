@@ -0,0 +1,47 @@
+#include "PCH.h"
+#include "Renderer/Public/SceneData/InstanceBatcher.h"
+
+#include "Renderer/Public/SceneData/MeshDraw.h"
+
+#include <algorithm>
+
+// =============================================================================
+// Build
+// =============================================================================
+
+void InstanceBatcher::Build(std::span<const DrawPacket> packets, std::span<const MeshDraw> draws)
+{
+	m_batches.clear();
+	m_instanceDrawIndices.resize(packets.size());
+	m_stats = {};
+
+	for (std::size_t i = 0; i < packets.size(); ++i)
+	{
+		const std::uint32_t drawIndex = packets[i].drawIndex;
+		const MeshDraw& draw = draws[drawIndex];
+		const void* geometry = draw.geometry;
+
+		m_instanceDrawIndices[i] = drawIndex;
+
+		if (!m_batches.empty() && m_batches.back().geometry == geometry && m_batches.back().materialId == draw.materialId)
+		{
+			++m_batches.back().instanceCount;
+			continue;
+		}
+
+		InstanceBatch& batch = m_batches.emplace_back();
+		batch.meshPtr = draw.meshPtr;
+		batch.meshHandle = draw.meshHandle;
+		batch.geometry = geometry;
+		batch.materialId = draw.materialId;
+		batch.firstInstance = static_cast<std::uint32_t>(i);
+		batch.instanceCount = 1;
+	}
+
+	m_stats.instanceCount = static_cast<std::uint32_t>(packets.size());
+	m_stats.batchCount = static_cast<std::uint32_t>(m_batches.size());
+	for (const InstanceBatch& batch : m_batches)
+	{
+		m_stats.largestBatch = std::max(m_stats.largestBatch, batch.instanceCount);
+	}
+}
@@ -0,0 +1,174 @@
+#include "PCH.h"
+#include "Renderer/Public/SceneData/SceneViewBuilder.h"
+
+#include "Renderer/Public/Camera/RenderCamera.h"
+#include "Renderer/Public/GPU/GPUMeshCache.h"
+#include "Renderer/Public/GPU/GPUMaterialTable.h"
+#include "Scene/Scene.h"
+#include "Scene/Mesh.h"
+#include "Math/MathUtils.h"
+
+#include "Core/Public/Diagnostics/Log.h"
+
+SceneViewBuilder::SceneViewBuilder(Scene& scene, const RenderCamera& camera, GPUMeshCache& meshCache, GPUMaterialTable& materialTable) noexcept :
+    m_scene(&scene), m_camera(&camera), m_meshCache(&meshCache), m_materialTable(&materialTable)
+{
+}
+
+const SceneView& SceneViewBuilder::Update(std::uint32_t width, std::uint32_t height)
+{
+	InitializeSceneView(width, height);
+
+	// Materials and draw commands — only what changed since last frame
+	UpdateMaterials();
+	UpdateMeshDraws();
+
+	return m_view;
+}
+
+void SceneViewBuilder::InitializeSceneView(std::uint32_t width, std::uint32_t height)
+{
+	// Viewport (from window, which swap chain tracks)
+	m_view.width = width;
+	m_view.height = height;
+
+	// Camera — store pointer to already-updated RenderCamera
+	m_view.camera = m_camera;
+
+	// Lighting — struct defaults (sun down, white, intensity 1)
+}
+
+void SceneViewBuilder::UpdateMaterials()
+{
+	const uint64_t generation = m_scene->GetMaterialGeneration();
+	if (m_materialGeneration == generation)
+		return;
+
+	m_materialGeneration = generation;
+
+	// Converted once per level load; no materials leaves a default one at index 0
+	m_materialTable->Build(m_scene->GetLoadedMaterials());
+}
+
+void SceneViewBuilder::UpdateWorldSphere(uint32_t denseIndex, const DirectX::XMFLOAT4X4& world)
+{
+	const Mesh* mesh = m_denseToMesh[denseIndex];
+	if (!mesh)
+	{
+		// Entry not owned by a scene mesh — never visible
+		m_centerX[denseIndex] = m_centerY[denseIndex] = m_centerZ[denseIndex] = 0.0f;
+		m_radius[denseIndex] = -1.0f;
+		return;
+	}
+
+	const MeshBounds& bounds = mesh->GetGeometry()->bounds;
+	DirectX::XMFLOAT3 center;
+	MathUtils::TransformSphere(bounds.sphereCenter, bounds.sphereRadius, world, center, m_radius[denseIndex]);
+	m_centerX[denseIndex] = center.x;
+	m_centerY[denseIndex] = center.y;
+	m_centerZ[denseIndex] = center.z;
+}
+
+void SceneViewBuilder::UpdateMeshDraws()
+{
+	SceneView& view = m_view;
+
+	// Recompute only transforms that changed since last frame
+	TransformStore& transforms = m_scene->GetTransforms();
+	transforms.UpdateDirty();
+	const auto updated = transforms.GetLastUpdated();
+
+	const bool bMeshListChanged = m_meshListGeneration != m_scene->GetMeshListGeneration();
+	const bool bCameraChanged = m_cameraGeneration != m_camera->GetGeneration();
+
+	// Object data: dense TransformStore index is the object ID
+	const auto worlds = transforms.GetWorldMatrices();
+	view.objectWorlds = worlds;
+	view.objectWorldInvTransposes = transforms.GetWorldInverseTransposes();
+	view.changedObjects.assign(updated.begin(), updated.end());
+	view.bAllObjectsChanged = bMeshListChanged;
+
+	view.stats.updatedTransforms = static_cast<uint32_t>(updated.size());
+	view.stats.bDrawListReused = !bMeshListChanged && !bCameraChanged && updated.empty();
+	if (view.stats.bDrawListReused)
+		return;
+
+	const uint32_t count = transforms.GetCount();
+
+	if (bMeshListChanged)
+	{
+		// Full refresh: remap dense entries to meshes, recompute every sphere
+		m_denseToMesh.assign(count, nullptr);
+		m_denseToMeshHandle.assign(count, GPUMeshHandle{});
+		m_centerX.resize(count);
+		m_centerY.resize(count);
+		m_centerZ.resize(count);
+		m_radius.resize(count);
+		m_visibleIndices.resize(count);
+
+		const GPUMeshCacheStats meshStatsBefore = m_meshCache->GetStats();
+		for (const auto& mesh : m_scene->GetMeshes())
+		{
+			const uint32_t denseIndex = transforms.GetDenseIndex(mesh->GetTransformHandle());
+			m_denseToMesh[denseIndex] = mesh.get();
+			m_denseToMeshHandle[denseIndex] = m_meshCache->Register(mesh->GetGeometry());
+		}
+		m_meshCache->ReleaseUnreferenced();
+
+		// Level loads and reloads hit meshes kept resident by content hash
+		const GPUMeshCacheStats& meshStats = m_meshCache->GetStats();
+		LOG_INFO(
+		    "GPUMeshCache: mesh list reused " + std::to_string(meshStats.reusedMeshes - meshStatsBefore.reusedMeshes) +
+		    " resident meshes (" + std::to_string((meshStats.uploadBytesAvoided - meshStatsBefore.uploadBytesAvoided) / 1024) +
+		    " KB upload avoided), " + std::to_string(meshStats.reuseMisses - meshStatsBefore.reuseMisses) + " to upload");
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			UpdateWorldSphere(i, worlds[i]);
+		}
+
+		m_meshListGeneration = m_scene->GetMeshListGeneration();
+	}
+	else
+	{
+		for (const uint32_t i : updated)
+		{
+			UpdateWorldSphere(i, worlds[i]);
+		}
+	}
+	m_cameraGeneration = m_camera->GetGeneration();
+
+	// Re-cull: batch sphere test, then the tighter AABB test for survivors
+	const Frustum& frustum = m_camera->GetFrustum();
+	const Frustum::SphereBatch spheres{m_centerX.data(), m_centerY.data(), m_centerZ.data(), m_radius.data(), count};
+	const uint32_t sphereVisibleCount = frustum.CullSpheres(spheres, m_visibleIndices.data());
+
+	view.meshDraws.clear();  // Keeps capacity
+	view.meshDraws.reserve(count);
+
+	for (uint32_t v = 0; v < sphereVisibleCount; ++v)
+	{
+		const uint32_t i = m_visibleIndices[v];
+		const Mesh* mesh = m_denseToMesh[i];
+		if (!mesh)
+			continue;
+
+		const MeshBounds& bounds = mesh->GetGeometry()->bounds;
+		DirectX::XMFLOAT3 aabbMin;
+		DirectX::XMFLOAT3 aabbMax;
+		MathUtils::TransformAABB(bounds.aabbMin, bounds.aabbMax, worlds[i], aabbMin, aabbMax);
+		if (!frustum.IntersectsAABB(aabbMin, aabbMax))
+			continue;
+
+		MeshDraw draw = {};
+		draw.objectId = i;
+		draw.materialId = mesh->GetMaterialId();
+		draw.meshPtr = mesh;
+		draw.geometry = mesh->GetGeometry().get();
+		draw.meshHandle = m_denseToMeshHandle[i];
+		view.meshDraws.push_back(draw);
+	}
+
+	view.stats.totalMeshes = static_cast<uint32_t>(m_scene->GetMeshes().size());
+	view.stats.visibleMeshes = static_cast<uint32_t>(view.meshDraws.size());
+	view.stats.culledMeshes = view.stats.totalMeshes - view.stats.visibleMeshes;
+}
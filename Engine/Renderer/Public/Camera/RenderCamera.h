@@ -31,9 +31,10 @@
 
 #include "Renderer/Public/RendererAPI.h"
 
-#include "D3D12ConstantBufferData.h"
+#include "D3D12/Resources/D3D12ConstantBufferData.h"
 #include "Math/Frustum.h"
 #include <DirectXMath.h>
+#include <cstdint>
 
 class GameCamera;
 
@@ -66,6 +67,10 @@ class SPARKLE_RENDERER_API RenderCamera final
 	/// Returns the view frustum for culling operations.
 	[[nodiscard]] const Frustum& GetFrustum() const noexcept { return m_frustum; }
 
+	/// Incremented whenever matrices/frustum are rebuilt; lets view caches
+	/// skip re-culling while the camera is still.
+	[[nodiscard]] std::uint64_t GetGeneration() const noexcept { return m_generation; }
+
 	/// Camera transform data (cached from GameCamera).
 	[[nodiscard]] DirectX::XMFLOAT3 GetPosition() const noexcept;
 	[[nodiscard]] DirectX::XMFLOAT3 GetDirection() const noexcept;
@@ -85,4 +90,5 @@ class SPARKLE_RENDERER_API RenderCamera final
 	DirectX::XMFLOAT4X4 m_projectionMatrix;
 	DirectX::XMFLOAT4X4 m_viewProjMatrix;
 	Frustum m_frustum;
+	std::uint64_t m_generation = 0;
 };
@@ -29,8 +29,8 @@
 #pragma once
 
 #include "Event.h"
+#include "RHITypes.h"
 #include <DirectXMath.h>
-#include <d3d12.h>
 #include <cstdint>
 
 // ============================================================================
@@ -84,10 +84,10 @@ class DepthConvention
 	[[nodiscard]] static float GetClearDepth() noexcept;
 
 	// Depth comparison function for opaque geometry
-	[[nodiscard]] static D3D12_COMPARISON_FUNC GetDepthComparisonLessEqualFunc() noexcept;
+	[[nodiscard]] static RHIComparisonFunc GetDepthComparisonLessEqualFunc() noexcept;
 
 	// Depth comparison function with equality (for depth-equal passes)
-	[[nodiscard]] static D3D12_COMPARISON_FUNC GetDepthComparisonFuncEqual() noexcept;
+	[[nodiscard]] static RHIComparisonFunc GetDepthComparisonFuncEqual() noexcept;
 
 	//--------------------------------------------------------------------------
 	// Projection Matrix Generation (Left-Handed, Z in [0,1])
@@ -6,15 +6,37 @@
 // resource dependencies in Setup, then record GPU commands in Execute.
 //
 // USAGE:
-//   SceneView view = renderer.BuildSceneView();
+//   const SceneView& view = sceneViewBuilder.Update(width, height);
+//   frameGraph.SetImportedResource(ResourceHandle::BackBuffer(), backBuffer);
 //   frameGraph.Setup(view);       // Passes declare resource usage
-//   frameGraph.Compile();         // MVP: no-op
-//   frameGraph.Execute(context);  // Passes record GPU commands
+//   frameGraph.Compile();         // Schedule, cull, compute transitions
+//   frameGraph.Execute(context);  // Barriers + pass commands
 //
 // DESIGN:
 //   - Owns all render passes via unique_ptr
-//   - Two-phase per frame: Setup (declare) then Execute (record)
-//   - Future: automatic barrier insertion and pass reordering
+//   - Three-phase per frame: Setup (declare), Compile, Execute (record)
+//   - Resource registry indexed by ResourceHandle: the back buffer and depth
+//     buffer are imported (owned by Renderer), the back buffer is the output.
+//     The owner hands their native resources over with SetImportedResource
+//     (backend objects, so the graph builds and records on any RHI)
+//   - Compile hands the recorded declarations to FrameGraphCompiler; Execute
+//     issues each scheduled pass's transitions before running it
+//   - Imported resources are left in their final state: back buffer as
+//     render target (UI draws after the graph), depth as depth-read
+//   - Transient textures (PassBuilder::CreateTexture) get lifetimes from the
+//     compiled order and a heap placement from TransientResourceAllocator;
+//     GetTransientStats() reports memory with and without aliasing
+//   - Compile is cached: Setup's declarations (pass identities, accesses and
+//     states, transient descs, resource infos) are hashed, and the previous
+//     plan is reused while the hash matches. Invalidate() forces a recompile
+//     (resize, depth mode switch)
+//   - ExecuteParallel turns the schedule into record jobs (one per pass, or
+//     per range for passes that split), records them on worker threads into
+//     RHI worker command lists, and submits those in schedule order
+//
+// NOTES:
+//   - Transients are planned only: no pass binds one yet, so no placed GPU
+//     resources are created and their transitions are skipped in Execute
 //
 // =============================================================================
 
@@ -23,17 +45,45 @@
 #include "Renderer/Public/RendererAPI.h"
 #include "Renderer/Public/FrameGraph/RenderPass.h"
 #include "Renderer/Public/FrameGraph/PassBuilder.h"
+#include "Renderer/Public/FrameGraph/FrameGraphCompiler.h"
+#include "RHITypes.h"
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <utility>
 
 // Forward declarations
-class D3D12SwapChain;
-class D3D12DepthStencil;
 class RenderContext;
+class RHIDevice;
 struct SceneView;
 
+// =============================================================================
+// FrameGraphCompileStats
+// =============================================================================
+
+struct FrameGraphCompileStats
+{
+	std::uint64_t compiles = 0;   // Frames that rebuilt the plan
+	std::uint64_t cacheHits = 0;  // Frames that reused it
+	double lastCompileMs = 0.0;   // CPU time of the most recent rebuild
+	double totalCompileMs = 0.0;
+
+	[[nodiscard]] double GetHitRate() const noexcept
+	{
+		const std::uint64_t frames = compiles + cacheHits;
+		return frames > 0 ? static_cast<double>(cacheHits) / static_cast<double>(frames) : 0.0;
+	}
+};
+
+struct FrameGraphRecordStats
+{
+	std::uint32_t jobs = 0;     // Command lists recorded (1 = serial, frame list only)
+	std::uint32_t threads = 0;  // Threads that recorded them
+	double recordMs = 0.0;      // Wall time of pass recording (excluding submission)
+};
+
 // =============================================================================
 // FrameGraph
 // =============================================================================
@@ -41,7 +91,7 @@ struct SceneView;
 class SPARKLE_RENDERER_API FrameGraph
 {
   public:
-	FrameGraph(D3D12SwapChain* swapChain, D3D12DepthStencil* depthStencil);
+	FrameGraph();
 	~FrameGraph();
 
 	FrameGraph(const FrameGraph&) = delete;
@@ -70,24 +120,70 @@ class SPARKLE_RENDERER_API FrameGraph
 	/// Calls Setup() on each pass so they can declare resource usage.
 	void Setup(const SceneView& sceneView);
 
-	/// Compiles the frame graph. MVP: no-op.
-	/// Future: dependency analysis, barrier insertion, pass reordering.
+	/// Builds the dependency DAG from the Setup declarations, orders and culls
+	/// passes, and computes the resource transitions for Execute. Reuses the
+	/// previous result when the declarations hash is unchanged.
 	void Compile();
 
-	/// Calls Execute() on each pass to record GPU commands.
+	/// Forces the next Compile to rebuild the plan.
+	void Invalidate() noexcept { ++m_epoch; }
+
+	/// Native resource (e.g. ID3D12Resource*) behind an imported handle, used
+	/// for its transitions. Set before Execute: the back buffer changes every
+	/// frame. Does not invalidate the plan (call Invalidate after a resize).
+	void SetImportedResource(ResourceHandle handle, RHINativeObject resource) noexcept;
+
+	/// Issues transitions and calls Execute() on each scheduled pass.
 	void Execute(RenderContext& context);
 
+	/// Records the schedule as up to RHIDevice::kMaxWorkerCommandLists jobs on
+	/// up to maxThreads threads, submitting them in order between what context
+	/// recorded before and after. Falls back to Execute when there is one job.
+	void ExecuteParallel(RenderContext& context, RHIDevice& rhi, std::uint32_t frameInFlightIndex, std::uint32_t maxThreads);
+
 	// -------------------------------------------------------------------------
 	// Accessors
 	// -------------------------------------------------------------------------
 
 	[[nodiscard]] std::size_t GetPassCount() const noexcept { return m_passes.size(); }
-	[[nodiscard]] D3D12SwapChain* GetSwapChain() const noexcept { return m_swapChain; }
-	[[nodiscard]] D3D12DepthStencil* GetDepthStencil() const noexcept { return m_depthStencil; }
+	[[nodiscard]] const CompiledFrameGraph& GetCompiled() const noexcept { return m_compiled; }
+	[[nodiscard]] const FrameGraphCompileStats& GetCompileStats() const noexcept { return m_compileStats; }
+	[[nodiscard]] const FrameGraphRecordStats& GetRecordStats() const noexcept { return m_recordStats; }
+	[[nodiscard]] const TransientMemoryStats& GetTransientStats() const noexcept { return m_transientAllocator.GetStats(); }
+	[[nodiscard]] std::span<const TransientPlacement> GetTransientPlacements() const noexcept { return m_transientPlacements; }
 
   private:
+	[[nodiscard]] std::uint64_t HashDeclarations() const noexcept;
+	void PlaceTransients();
+	void BuildRecordJobs(std::uint32_t maxJobs);
+	void IssueTransitions(RenderContext& context, std::span<const ResourceTransition> transitions) const;
+	[[nodiscard]] RHINativeObject GetNativeResource(ResourceHandle handle) const noexcept;
+
 	std::vector<std::unique_ptr<RenderPass>> m_passes;
-	D3D12SwapChain* m_swapChain = nullptr;
-	D3D12DepthStencil* m_depthStencil = nullptr;
+	std::array<RHINativeObject, ResourceHandle::FIRST_TRANSIENT_INDEX> m_importedResources{};
 	PassBuilder m_builder;
+
+	std::vector<FrameGraphResourceInfo> m_resources;  // Indexed by ResourceHandle::index
+	FrameGraphCompiler m_compiler;
+	CompiledFrameGraph m_compiled;
+
+	// Compile cache
+	std::uint64_t m_compiledHash = 0;
+	std::uint64_t m_epoch = 0;
+	bool m_bCompiled = false;
+	FrameGraphCompileStats m_compileStats;
+
+	// Parallel recording: one job per command list, in submission order
+	struct RecordJob
+	{
+		std::uint32_t compiledPass = 0;  // Index into m_compiled.passes
+		std::uint32_t range = 0;
+		std::uint32_t rangeCount = 1;
+	};
+	std::vector<RecordJob> m_recordJobs;
+	FrameGraphRecordStats m_recordStats;
+
+	TransientResourceAllocator m_transientAllocator;
+	std::vector<TransientAllocationRequest> m_transientRequests;
+	std::vector<TransientPlacement> m_transientPlacements;  // Indexed by handle - FIRST_TRANSIENT_INDEX
 };
@@ -0,0 +1,151 @@
+// =============================================================================
+// FrameGraphCompiler.h — Dependency DAG, scheduling, culling and transitions
+// =============================================================================
+//
+// Turns the per-pass resource accesses recorded by PassBuilder into an
+// executable schedule: which passes run, in which order, and which resource
+// state transitions must be issued before each of them.
+//
+// USAGE:
+//   std::vector<PassDeclaration> passes = ...;        // From PassBuilder
+//   std::vector<FrameGraphResourceInfo> resources = ...;
+//   FrameGraphCompiler compiler;                      // Keeps scratch across frames
+//   CompiledFrameGraph compiled;
+//   compiler.Compile(passes, resources, compiled);
+//   for (const CompiledPass& pass : compiled.passes) { ... }
+//
+// DESIGN:
+//   - Edges follow declaration order per resource: read-after-write,
+//     write-after-read and write-after-write
+//   - Passes that write an output resource (the back buffer) or declare side
+//     effects are roots; liveness flows back along producer edges (RAW, WAW),
+//     anything a live pass does not depend on for its inputs is culled
+//   - Kahn's algorithm picks the lowest declaration index among ready passes,
+//     so independent passes keep their registration order
+//   - Each resource's state is tracked along the schedule; a transition is
+//     emitted only when the next access needs a different state, and
+//     imported resources are returned to their final state at the end
+//   - Lifetimes (first/last scheduled use) feed transient memory aliasing
+//   - HashFrameGraphDeclarations keys FrameGraph's compile cache: it covers
+//     every input of Compile plus the transient descs
+//   - Pure CPU: no GPU types, testable on synthetic graphs
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/FrameGraph/ResourceHandle.h"
+#include "Renderer/Public/FrameGraph/TransientResourceAllocator.h"
+#include "RHIResourceState.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// =============================================================================
+// Declarations (compiler input)
+// =============================================================================
+
+struct ResourceAccess
+{
+	ResourceHandle handle;
+	ResourceState state = ResourceState::Common;
+	bool bWrite = false;
+};
+
+/// Everything one pass declared during Setup.
+struct PassDeclaration
+{
+	std::vector<ResourceAccess> accesses;
+	bool bHasSideEffects = false;  // Never culled (e.g. readback, UI)
+};
+
+/// Per-resource compile information, indexed by ResourceHandle::index.
+struct FrameGraphResourceInfo
+{
+	ResourceState initialState = ResourceState::Common;  // State when the graph starts
+	ResourceState finalState = ResourceState::Common;    // Imported only: state to leave it in
+	bool bImported = false;                              // Owned outside the graph (swap chain, depth)
+	bool bOutput = false;                                // Writing it keeps a pass alive
+};
+
+// =============================================================================
+// Compiled Output
+// =============================================================================
+
+struct ResourceTransition
+{
+	ResourceHandle handle;
+	ResourceState before = ResourceState::Common;
+	ResourceState after = ResourceState::Common;
+};
+
+/// Positions in CompiledFrameGraph::passes, inclusive.
+struct ResourceLifetime
+{
+	static constexpr std::uint32_t UNUSED = UINT32_MAX;
+
+	std::uint32_t firstPass = UNUSED;
+	std::uint32_t lastPass = 0;
+
+	[[nodiscard]] bool IsUsed() const noexcept { return firstPass != UNUSED; }
+};
+
+struct CompiledPass
+{
+	std::uint32_t passIndex = 0;        // Index into the declaration / pass list
+	std::uint32_t firstTransition = 0;  // Range in CompiledFrameGraph::transitions, issued before the pass
+	std::uint32_t transitionCount = 0;
+};
+
+struct CompiledFrameGraph
+{
+	std::vector<CompiledPass> passes;                  // Execution order, culled passes removed
+	std::vector<ResourceTransition> transitions;       // Referenced by CompiledPass ranges
+	std::vector<ResourceTransition> finalTransitions;  // After the last pass (imported resources)
+	std::vector<ResourceLifetime> lifetimes;           // Indexed by resource, scheduled passes only
+
+	std::uint32_t edgeCount = 0;
+	std::uint32_t culledPassCount = 0;
+	std::uint32_t stateConflicts = 0;  // Passes reading and writing one resource in different states
+
+	void Clear() noexcept;
+};
+
+// =============================================================================
+// Declaration Hash
+// =============================================================================
+
+/// Folds everything Compile and transient placement read into seed. Equal
+/// declarations hash equal; a changed access, state, edge, resource info or
+/// transient desc changes the hash. Fields are fed one by one, so struct
+/// padding never reaches it.
+[[nodiscard]] SPARKLE_RENDERER_API std::uint64_t HashFrameGraphDeclarations(
+    std::span<const PassDeclaration> passes,
+    std::span<const FrameGraphResourceInfo> resources,
+    std::span<const TransientTextureDesc> transients,
+    std::uint64_t seed) noexcept;
+
+// =============================================================================
+// FrameGraphCompiler
+// =============================================================================
+
+class SPARKLE_RENDERER_API FrameGraphCompiler final
+{
+  public:
+	/// Compiles the declarations into out (cleared first; capacity is kept).
+	/// Accesses to handles outside resources are ignored.
+	void Compile(std::span<const PassDeclaration> passes, std::span<const FrameGraphResourceInfo> resources, CompiledFrameGraph& out);
+
+  private:
+	// Scratch kept across compiles
+	std::vector<std::vector<std::uint32_t>> m_successors;  // Dependency edges, producer -> consumer
+	std::vector<std::vector<std::uint32_t>> m_producers;   // RAW/WAW edges, consumer -> producer (liveness)
+	std::vector<std::uint32_t> m_inDegree;
+	std::vector<std::uint8_t> m_bAlive;
+	std::vector<std::uint32_t> m_lastWriter;
+	std::vector<std::vector<std::uint32_t>> m_readersSinceWrite;
+	std::vector<ResourceState> m_currentStates;
+	std::vector<std::uint32_t> m_stack;
+};
@@ -14,8 +14,11 @@
 //   }
 //
 // NOTES:
-//   - MVP: Only UseBackBuffer() and UseDepthBuffer() are functional
-//   - Future: Read(), Write(), CreateTexture() for transient resources
+//   - Every call records a ResourceAccess into the current pass's
+//     PassDeclaration, which FrameGraphCompiler turns into edges/transitions
+//   - CreateTexture() only declares a transient; the creating pass (or a
+//     later one) must still Write() it. Its memory lives from first to last
+//     use and may alias other transients
 //
 // =============================================================================
 
@@ -23,7 +26,12 @@
 
 #include "Renderer/Public/RendererAPI.h"
 #include "Renderer/Public/FrameGraph/ResourceHandle.h"
-#include "Renderer/Public/FrameGraph/ResourceState.h"
+#include "Renderer/Public/FrameGraph/FrameGraphCompiler.h"
+#include "Renderer/Public/FrameGraph/TransientResourceAllocator.h"
+#include "RHIResourceState.h"
+
+#include <span>
+#include <vector>
 
 // =============================================================================
 // PassBuilder
@@ -44,31 +52,92 @@ class SPARKLE_RENDERER_API PassBuilder
 	// Well-Known Resources
 	// -------------------------------------------------------------------------
 
-	/// Declares write access to the swap chain back buffer.
-	[[nodiscard]] ResourceHandle UseBackBuffer() noexcept { return ResourceHandle::BackBuffer(); }
+	/// Declares write access to the swap chain back buffer (as render target).
+	[[nodiscard]] ResourceHandle UseBackBuffer() { return Write(ResourceHandle::BackBuffer(), ResourceState::RenderTarget); }
 
-	/// Declares write access to the depth buffer.
-	[[nodiscard]] ResourceHandle UseDepthBuffer() noexcept { return ResourceHandle::DepthBuffer(); }
+	/// Declares write access to the depth buffer (as depth target).
+	[[nodiscard]] ResourceHandle UseDepthBuffer() { return Write(ResourceHandle::DepthBuffer(), ResourceState::DepthWrite); }
 
 	// -------------------------------------------------------------------------
-	// Future API (stubbed for MVP)
+	// Generic Access
 	// -------------------------------------------------------------------------
 
-	/// Declares read access to a resource.
-	[[nodiscard]] ResourceHandle Read([[maybe_unused]] ResourceHandle handle, [[maybe_unused]] ResourceState state) noexcept
+	/// Declares read access to a resource in the given state.
+	[[nodiscard]] ResourceHandle Read(ResourceHandle handle, ResourceState state)
 	{
+		Record(handle, state, false);
 		return handle;
 	}
 
-	/// Declares write access to a resource.
-	[[nodiscard]] ResourceHandle Write([[maybe_unused]] ResourceHandle handle, [[maybe_unused]] ResourceState state) noexcept
+	/// Declares write access to a resource in the given state.
+	[[nodiscard]] ResourceHandle Write(ResourceHandle handle, ResourceState state)
 	{
+		Record(handle, state, true);
 		return handle;
 	}
 
-	/// Creates a transient texture resource.
-	template <typename TextureDesc> [[nodiscard]] ResourceHandle CreateTexture([[maybe_unused]] const TextureDesc& desc) noexcept
+	/// Marks the current pass as never culled, even if nothing reads its output.
+	void SetHasSideEffects() noexcept
+	{
+		if (m_current)
+		{
+			m_current->bHasSideEffects = true;
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// Transient Resources
+	// -------------------------------------------------------------------------
+
+	/// Declares a graph-owned texture valid for this frame. Returns Invalid for
+	/// an empty size.
+	[[nodiscard]] ResourceHandle CreateTexture(const TransientTextureDesc& desc)
+	{
+		if (desc.width == 0 || desc.height == 0)
+			return ResourceHandle::Invalid();
+
+		m_transientTextures.push_back(desc);
+		return ResourceHandle{ResourceHandle::FIRST_TRANSIENT_INDEX + static_cast<std::uint32_t>(m_transientTextures.size() - 1)};
+	}
+
+	// -------------------------------------------------------------------------
+	// Recorded Declarations
+	// -------------------------------------------------------------------------
+
+	/// One declaration per pass, in registration order.
+	[[nodiscard]] std::span<const PassDeclaration> GetDeclarations() const noexcept { return m_declarations; }
+
+	/// Transient textures in handle order (handle index - FIRST_TRANSIENT_INDEX).
+	[[nodiscard]] std::span<const TransientTextureDesc> GetTransientTextures() const noexcept { return m_transientTextures; }
+
+  private:
+	friend class FrameGraph;
+
+	/// Clears all declarations and sizes the list for passCount passes (capacity kept).
+	void Reset(std::size_t passCount)
 	{
-		return ResourceHandle::Invalid();
+		m_declarations.resize(passCount);
+		for (PassDeclaration& declaration : m_declarations)
+		{
+			declaration.accesses.clear();
+			declaration.bHasSideEffects = false;
+		}
+		m_transientTextures.clear();
+		m_current = nullptr;
 	}
+
+	/// Directs subsequent declarations to the given pass.
+	void BeginPass(std::size_t passIndex) noexcept { m_current = &m_declarations[passIndex]; }
+
+	void Record(ResourceHandle handle, ResourceState state, bool bWrite)
+	{
+		if (m_current && handle.IsValid())
+		{
+			m_current->accesses.push_back({handle, state, bWrite});
+		}
+	}
+
+	std::vector<PassDeclaration> m_declarations;
+	std::vector<TransientTextureDesc> m_transientTextures;
+	PassDeclaration* m_current = nullptr;
 };
@@ -22,6 +22,9 @@
 //   - Setup receives PassBuilder for resource requests, SceneView for scene data
 //   - Execute receives RenderContext for GPU command recording
 //   - Pass name stored for debugging, profiling, and GPU markers
+//   - Optional range splitting: a pass that reports more than one record range
+//     has ExecuteRange called concurrently, one command list per range, after
+//     a single-threaded PrepareRanges. Ranges execute on the GPU in order
 //
 // NOTES:
 //   - Derived passes should NOT access Scene directly — use SceneView only
@@ -31,6 +34,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -82,6 +86,26 @@ class RenderPass
 	/// @param context RenderContext for issuing draw commands
 	virtual void Execute(RenderContext& context) = 0;
 
+	// -------------------------------------------------------------------------
+	// Parallel Recording (optional)
+	// -------------------------------------------------------------------------
+
+	/// Number of ranges Execute can be split into this frame (1 = not split).
+	/// Called after Setup; the result is clamped to maxRanges.
+	[[nodiscard]] virtual std::uint32_t GetRecordRangeCount([[maybe_unused]] std::uint32_t maxRanges) const noexcept { return 1; }
+
+	/// Single-threaded work shared by all ranges (uploads, cache lookups).
+	/// Called once before ExecuteRange when the pass is recorded in ranges.
+	virtual void PrepareRanges([[maybe_unused]] std::uint32_t rangeCount) {}
+
+	/// Records one range into its own command list; may run concurrently with
+	/// other ranges and passes. Command lists inherit no state, so each range
+	/// binds everything it uses. Range 0 executes first on the GPU.
+	virtual void ExecuteRange(RenderContext& context, [[maybe_unused]] std::uint32_t rangeIndex, [[maybe_unused]] std::uint32_t rangeCount)
+	{
+		Execute(context);
+	}
+
 	// -------------------------------------------------------------------------
 	// Accessors
 	// -------------------------------------------------------------------------
@@ -14,9 +14,10 @@
 //
 // DESIGN:
 //   - Simple value type (copyable, comparable)
-//   - Well-known handles for MVP: BACKBUFFER, DEPTH_BUFFER
+//   - Well-known handles for imported resources: BACKBUFFER, DEPTH_BUFFER
+//   - Transient textures (PassBuilder::CreateTexture) get indices from
+//     FIRST_TRANSIENT_INDEX upwards, valid for the frame they were declared in
 //   - INVALID handle for error/uninitialized state
-//   - Future: dynamic handle allocation for transient resources
 //
 // NOTES:
 //   - No GPU types — pure index into Frame Graph resource registry
@@ -40,7 +41,7 @@ struct ResourceHandle
 	std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
 
 	// -------------------------------------------------------------------------
-	// Well-Known Handles (MVP)
+	// Well-Known Handles
 	// -------------------------------------------------------------------------
 
 	/// Invalid/uninitialized handle.
@@ -52,6 +53,9 @@ struct ResourceHandle
 	/// Depth-stencil buffer (index 1).
 	static constexpr std::uint32_t DEPTH_BUFFER_INDEX = 1;
 
+	/// First index handed out to transient resources.
+	static constexpr std::uint32_t FIRST_TRANSIENT_INDEX = 2;
+
 	// -------------------------------------------------------------------------
 	// Factory Methods
 	// -------------------------------------------------------------------------
@@ -78,6 +82,9 @@ struct ResourceHandle
 	/// Returns true if this is the depth buffer handle.
 	[[nodiscard]] constexpr bool IsDepthBuffer() const noexcept { return index == DEPTH_BUFFER_INDEX; }
 
+	/// Returns true if this handle refers to a graph-owned transient resource.
+	[[nodiscard]] constexpr bool IsTransient() const noexcept { return IsValid() && index >= FIRST_TRANSIENT_INDEX; }
+
 	// -------------------------------------------------------------------------
 	// Comparison (C++20 three-way)
 	// -------------------------------------------------------------------------
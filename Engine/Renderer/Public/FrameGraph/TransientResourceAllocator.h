@@ -0,0 +1,127 @@
+// =============================================================================
+// TransientResourceAllocator.h — Lifetime-based heap placement for transients
+// =============================================================================
+//
+// Packs FrameGraph transient resources into shared heaps so that resources
+// whose lifetimes (first..last use in the compiled pass order) do not overlap
+// can alias the same memory.
+//
+// USAGE:
+//   std::vector<TransientAllocationRequest> requests = ...;  // size + lifetime
+//   std::vector<TransientPlacement> placements;
+//   allocator.Place(requests, placements);
+//   const TransientMemoryStats& stats = allocator.GetStats();
+//
+// DESIGN:
+//   - Greedy interval packing: resources are placed largest first; each goes
+//     to the first heap with a free address range that no lifetime-overlapping
+//     resource occupies (lowest offset wins)
+//   - Heaps grow up to maxHeapSize; a resource that fits nowhere opens a new
+//     heap (larger-than-max resources get a heap of their own)
+//   - Offsets stay RHIPlacementAlignment-aligned
+//   - Pure CPU: sizes and lifetimes in, heap index + offset out
+//
+// NOTES:
+//   - bytesWithoutAliasing is what dedicated allocations would cost;
+//     peakLiveBytes is the lower bound no placement can beat
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "RHITypes.h"
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+// =============================================================================
+// TransientTextureDesc
+// =============================================================================
+
+/// Texture requested through PassBuilder::CreateTexture.
+struct TransientTextureDesc
+{
+	std::uint32_t width = 0;
+	std::uint32_t height = 0;
+	RHITextureFormat format = RHITextureFormat::RGBA8_UNorm;
+	const char* debugName = nullptr;  // Must outlive the frame (string literal)
+
+	/// Bytes the texture occupies in a heap (single mip, placement-aligned).
+	[[nodiscard]] constexpr std::uint64_t GetAllocationSize() const noexcept
+	{
+		const std::uint64_t bytes = static_cast<std::uint64_t>(width) * height * GetTextureFormatSize(format);
+		return (bytes + RHIPlacementAlignment - 1) & ~(RHIPlacementAlignment - 1);
+	}
+};
+
+// =============================================================================
+// Placement Input / Output
+// =============================================================================
+
+struct TransientAllocationRequest
+{
+	std::uint64_t size = 0;       // 0 = not allocated (e.g. resource never used)
+	std::uint32_t firstPass = 0;  // Compiled pass position of first use
+	std::uint32_t lastPass = 0;   // Compiled pass position of last use (inclusive)
+};
+
+struct TransientPlacement
+{
+	static constexpr std::uint32_t INVALID_HEAP = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t heapIndex = INVALID_HEAP;
+	std::uint64_t offset = 0;
+
+	[[nodiscard]] bool IsPlaced() const noexcept { return heapIndex != INVALID_HEAP; }
+};
+
+struct TransientMemoryStats
+{
+	std::uint32_t resourceCount = 0;         // Requests that were placed
+	std::uint32_t heapCount = 0;
+	std::uint64_t bytesWithoutAliasing = 0;  // Sum of all sizes
+	std::uint64_t bytesWithAliasing = 0;     // Sum of heap sizes
+	std::uint64_t peakLiveBytes = 0;         // Max bytes simultaneously alive
+
+	bool operator==(const TransientMemoryStats&) const noexcept = default;
+};
+
+// =============================================================================
+// TransientResourceAllocator
+// =============================================================================
+
+class SPARKLE_RENDERER_API TransientResourceAllocator final
+{
+  public:
+	static constexpr std::uint64_t kDefaultMaxHeapSize = 256ull * 1024ull * 1024ull;
+
+	explicit TransientResourceAllocator(std::uint64_t maxHeapSize = kDefaultMaxHeapSize) noexcept : m_maxHeapSize(maxHeapSize) {}
+
+	/// Computes a placement per request (same order). Unsized requests stay unplaced.
+	void Place(std::span<const TransientAllocationRequest> requests, std::vector<TransientPlacement>& outPlacements);
+
+	[[nodiscard]] const TransientMemoryStats& GetStats() const noexcept { return m_stats; }
+	[[nodiscard]] std::span<const std::uint64_t> GetHeapSizes() const noexcept { return m_heapSizes; }
+
+  private:
+	[[nodiscard]] bool TryPlaceInHeap(
+	    std::uint32_t heapIndex,
+	    std::span<const TransientAllocationRequest> requests,
+	    std::span<const TransientPlacement> placements,
+	    std::uint32_t request,
+	    std::uint64_t& outOffset);
+
+	std::uint64_t m_maxHeapSize = kDefaultMaxHeapSize;
+	TransientMemoryStats m_stats;
+
+	// Scratch kept across calls
+	std::vector<std::uint64_t> m_heapSizes;
+	std::vector<std::vector<std::uint32_t>> m_heapMembers;                 // Request indices per heap
+	std::vector<std::uint32_t> m_order;                                    // Placement order (largest first)
+	std::vector<std::pair<std::uint64_t, std::uint64_t>> m_occupied;      // [begin, end) of conflicting members
+	std::vector<std::int64_t> m_liveDelta;                                 // Per-pass live-byte changes
+};
@@ -0,0 +1,160 @@
+// =============================================================================
+// GPUGeometryArena.h — Suballocated default-heap vertex/index storage
+// =============================================================================
+//
+// Holds all mesh geometry in a few large GPU-local buffers (pages) instead of
+// one upload-heap buffer per vertex and index array. Each mesh gets two
+// ranges in a page; the data is staged in the renderer's GPUUploadQueue and
+// copied on the frame's command list.
+// Owned by GPUMeshCache.
+//
+// USAGE:
+//   GPUGeometryArena arena(rhi, uploadQueue);
+//   GPUMesh mesh;
+//   if (arena.Upload(geometry, mesh) == GeometryUploadResult::Uploaded) { ... }
+//   arena.RecordUploads(commandList);          // Before the first draw using mesh
+//   arena.Free(mesh);                          // Once no frame in flight reads it
+//
+// DESIGN:
+//   - Pages are kDefaultPageSize default-heap buffers, each suballocated by a
+//     TlsfAllocator (Core, O(1) allocate/free); a mesh larger than a page
+//     gets a dedicated page of its own size, released as soon as it is empty
+//   - Vertex and index ranges share pages: a page is bound as both VB and IB
+//   - Upload writes vertices and indices into one staging allocation of the
+//     upload queue's ring right away and queues a copy per range;
+//     RecordUploads records the frame's batch (barriers included). Ring space
+//     retires with the frame's fence, not a fixed frame count
+//   - A full ring defers the mesh (no ranges are kept): it is skipped this
+//     frame and uploaded on a later Acquire, so nothing is drawn before its
+//     copy
+//
+// NOTES:
+//   - Free returns ranges immediately; callers (GPUMeshCache eviction) only
+//     free meshes no frame in flight still draws
+//   - Upload and RecordUploads belong to the same frame (ResolveMeshes);
+//     Clear in between would leave copies into released pages
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/GPU/GPUUploadQueue.h"
+#include "Core/Public/Memory/TlsfAllocator.h"
+#include "GameFramework/Public/Scene/MeshData.h"
+#include "RHIDevice.h"
+
+#include <cstdint>
+#include <vector>
+
+class GPUMesh;
+class RHICommandList;
+
+// =============================================================================
+// GeometryRange — one suballocation in an arena page
+// =============================================================================
+
+struct GeometryRange
+{
+	static constexpr std::uint32_t kInvalidPage = UINT32_MAX;
+
+	std::uint32_t page = kInvalidPage;
+	OffsetAllocation allocation;
+
+	[[nodiscard]] bool IsValid() const noexcept { return page != kInvalidPage && allocation.IsValid(); }
+};
+
+// =============================================================================
+// GeometryUploadResult
+// =============================================================================
+
+enum class GeometryUploadResult : std::uint8_t
+{
+	Uploaded,  // Ranges allocated, copy queued
+	Deferred,  // Upload ring full; retry next frame
+	Failed     // Invalid data or no page could be created
+};
+
+// =============================================================================
+// GeometryArenaStats
+// =============================================================================
+
+struct GeometryArenaStats
+{
+	std::uint32_t pageCount = 0;
+	std::uint64_t reservedBytes = 0;   // GPU memory held by pages
+	std::uint64_t allocatedBytes = 0;  // Bytes in live ranges
+	std::uint32_t allocationCount = 0;
+	std::uint32_t freeRangeCount = 0;
+	std::uint64_t largestFreeRange = 0;
+	std::uint64_t uploadedBytes = 0;   // Copied by the last RecordUploads
+	std::uint32_t uploadedMeshes = 0;
+	std::uint64_t deferredUploads = 0;  // Lifetime; upload ring was full
+};
+
+// =============================================================================
+// GPUGeometryArena
+// =============================================================================
+
+class SPARKLE_RENDERER_API GPUGeometryArena final
+{
+  public:
+	static constexpr std::uint64_t kDefaultPageSize = 64ull * 1024ull * 1024ull;
+	static constexpr std::uint64_t kRangeAlignment = 16;
+
+	GPUGeometryArena(RHIDevice& rhi, GPUUploadQueue& uploads, std::uint64_t pageSize = kDefaultPageSize) noexcept;
+	~GPUGeometryArena() = default;
+
+	GPUGeometryArena(const GPUGeometryArena&) = delete;
+	GPUGeometryArena& operator=(const GPUGeometryArena&) = delete;
+	GPUGeometryArena(GPUGeometryArena&&) noexcept = default;
+	GPUGeometryArena& operator=(GPUGeometryArena&&) noexcept = default;
+
+	// -------------------------------------------------------------------------
+	// Meshes
+	// -------------------------------------------------------------------------
+
+	/// Allocates vertex and index ranges, stages the data, points outMesh at
+	/// the ranges and queues the copies. outMesh is untouched unless Uploaded.
+	GeometryUploadResult Upload(const MeshGeometryHandle& geometry, GPUMesh& outMesh);
+
+	/// Returns the mesh's ranges to their pages and resets it.
+	void Free(GPUMesh& mesh) noexcept;
+
+	// -------------------------------------------------------------------------
+	// Per-Frame
+	// -------------------------------------------------------------------------
+
+	/// Records the copies queued by Upload (and any other staged through the
+	/// upload queue this frame) into commandList.
+	void RecordUploads(RHICommandList& commandList);
+
+	/// Drops all pages (GPU must be idle).
+	void Clear() noexcept;
+
+	[[nodiscard]] bool HasPendingUploads() const noexcept { return m_uploads->HasQueuedCopies(); }
+	[[nodiscard]] GeometryArenaStats GetStats() const noexcept;
+
+  private:
+	struct Page
+	{
+		RHIBuffer buffer;  // Invalid = released page slot
+		TlsfAllocator allocator;
+		bool bDedicated = false;
+	};
+
+	[[nodiscard]] GeometryRange Allocate(std::uint64_t size);
+	void Release(const GeometryRange& range) noexcept;
+	[[nodiscard]] std::uint32_t CreatePage(std::uint64_t size, bool bDedicated);
+
+	RHIDevice* m_rhi;
+	GPUUploadQueue* m_uploads;
+	std::uint64_t m_pageSize;
+	std::vector<Page> m_pages;
+
+	std::uint64_t m_stagedBytes = 0;  // Since the last RecordUploads
+	std::uint32_t m_stagedMeshes = 0;
+	std::uint64_t m_uploadedBytes = 0;
+	std::uint32_t m_uploadedMeshes = 0;
+	std::uint64_t m_deferredUploads = 0;
+};
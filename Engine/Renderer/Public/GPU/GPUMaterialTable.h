@@ -0,0 +1,108 @@
+// =============================================================================
+// GPUMaterialTable.h — Persistent, versioned GPU array of material records
+// =============================================================================
+//
+// Holds every material of the loaded level as a packed MaterialRecord in a
+// structured buffer (t3). Draws select their material with a root constant
+// (b3) instead of uploading material constants per draw.
+//
+// USAGE:
+//   GPUMaterialTable table;
+//   table.Build(scene.GetLoadedMaterials());   // Level load
+//   table.Set(materialId, editedMaterial);     // Runtime edit (optional)
+//   table.Sync(rhi, frameIndex);               // Once per frame
+//   context.BindShaderResource(RootParam::MaterialTable, table.GetGPUAddress(frameIndex));
+//
+// DESIGN:
+//   - Build converts each MaterialDesc once; afterwards only Set changes
+//     the table, so per-frame CPU cost is O(changed materials)
+//   - Every change bumps the table version and records it as the changed
+//     material's version; Set with identical data changes nothing
+//   - Storage is a GPUPersistentBuffer: each frame-in-flight copy rewrites
+//     only the records changed since it was last synced
+//
+// NOTES:
+//   - An empty desc list yields one default material at index 0, so material
+//     ID 0 is always valid
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/SceneData/MaterialData.h"
+#include "Renderer/Public/GPU/GPUPersistentBuffer.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct MaterialDesc;
+
+// =============================================================================
+// MaterialTableStats
+// =============================================================================
+
+struct MaterialTableStats
+{
+	std::uint32_t materialCount = 0;
+	std::uint32_t changedMaterials = 0;  // Materials changed since the previous Sync
+	std::uint64_t bytesUploaded = 0;     // Bytes written by the last Sync
+	std::uint64_t version = 0;           // Table version after the last Sync
+};
+
+// =============================================================================
+// GPUMaterialTable
+// =============================================================================
+
+class SPARKLE_RENDERER_API GPUMaterialTable final
+{
+  public:
+	GPUMaterialTable();
+	~GPUMaterialTable() noexcept = default;
+
+	GPUMaterialTable(const GPUMaterialTable&) = delete;
+	GPUMaterialTable& operator=(const GPUMaterialTable&) = delete;
+	GPUMaterialTable(GPUMaterialTable&&) = delete;
+	GPUMaterialTable& operator=(GPUMaterialTable&&) = delete;
+
+	// -------------------------------------------------------------------------
+	// Updates
+	// -------------------------------------------------------------------------
+
+	/// Replaces all materials (level load). Every record is re-uploaded.
+	void Build(std::span<const MaterialDesc> descs);
+
+	/// Changes one material. Returns false (and does nothing) if the ID is out
+	/// of range or the data is unchanged.
+	bool Set(std::uint32_t materialId, const MaterialData& material);
+
+	/// Writes the changed records into the copy for frameIndex.
+	void Sync(RHIDevice& rhi, std::uint32_t frameIndex);
+
+	// -------------------------------------------------------------------------
+	// Queries
+	// -------------------------------------------------------------------------
+
+	[[nodiscard]] RHIGpuAddress GetGPUAddress(std::uint32_t frameIndex) const noexcept { return m_buffer.GetGPUAddress(frameIndex); }
+	[[nodiscard]] std::uint32_t GetMaterialCount() const noexcept { return static_cast<std::uint32_t>(m_materials.size()); }
+	[[nodiscard]] const MaterialData& GetMaterial(std::uint32_t materialId) const noexcept { return m_materials[materialId]; }
+
+	/// Incremented by every Build and effective Set.
+	[[nodiscard]] std::uint64_t GetVersion() const noexcept { return m_version; }
+
+	/// Table version at which the material last changed.
+	[[nodiscard]] std::uint64_t GetMaterialVersion(std::uint32_t materialId) const noexcept { return m_materialVersions[materialId]; }
+
+	[[nodiscard]] const MaterialTableStats& GetStats() const noexcept { return m_stats; }
+
+  private:
+	std::vector<MaterialData> m_materials;
+	std::vector<std::uint64_t> m_materialVersions;
+	std::vector<std::uint32_t> m_changed;  // Material IDs changed since the last Sync
+	bool m_bRebuilt = false;               // Build since the last Sync (everything changed)
+	std::uint64_t m_version = 0;
+
+	GPUPersistentBuffer m_buffer;  // MaterialRecord by material ID (t3)
+	MaterialTableStats m_stats;
+};
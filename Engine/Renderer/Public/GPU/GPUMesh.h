@@ -2,18 +2,20 @@
 // GPUMesh.h — GPU-resident mesh buffers for rendering
 // =============================================================================
 //
-// Owns D3D12 vertex and index buffers uploaded from CPU MeshData.
+// Vertex and index ranges of one mesh inside GPUGeometryArena pages, plus the
+// views that bind them. Holds no GPU memory of its own: the arena owns the
+// buffers and GPUMeshCache returns the ranges through GPUGeometryArena::Free.
 // Created and cached by GPUMeshCache — not directly instantiated by user code.
 //
 // USAGE:
 //   GPUMesh gpuMesh;
-//   gpuMesh.Upload(rhi, meshData);
+//   arena.Upload(geometry, gpuMesh);
 //   gpuMesh.Bind(cmdList);
-//   cmdList->DrawIndexedInstanced(gpuMesh.GetIndexCount(), 1, 0, 0, 0);
+//   cmdList.DrawIndexedInstanced(gpuMesh.GetIndexCount(), 1, 0, 0, 0);
 //
 // OWNERSHIP:
 //   - GPUMeshCache owns GPUMesh instances
-//   - Renderer owns GPUMeshCache
+//   - GPUGeometryArena owns the buffers they point into
 //   - GameFramework has no knowledge of this class
 //
 // =============================================================================
@@ -21,13 +23,12 @@
 #pragma once
 
 #include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/GPU/GPUGeometryArena.h"
+#include "RHITypes.h"
 
-#include <d3d12.h>
-#include <wrl/client.h>
 #include <cstdint>
 
-class D3D12Rhi;
-struct MeshData;
+class RHICommandList;
 
 // =============================================================================
 // GPUMesh
@@ -37,27 +38,20 @@ class SPARKLE_RENDERER_API GPUMesh final
 {
   public:
 	GPUMesh() = default;
-	~GPUMesh() = default;
-
-	GPUMesh(const GPUMesh&) = delete;
-	GPUMesh& operator=(const GPUMesh&) = delete;
-	GPUMesh(GPUMesh&&) noexcept = default;
-	GPUMesh& operator=(GPUMesh&&) noexcept = default;
-
-	// -------------------------------------------------------------------------
-	// Upload
-	// -------------------------------------------------------------------------
-
-	// Creates GPU buffers from CPU mesh data. Call once per mesh.
-	// Returns true on success.
-	bool Upload(D3D12Rhi& rhi, const MeshData& meshData);
+	GPUMesh(
+	    const GeometryRange& vertices,
+	    const GeometryRange& indices,
+	    const RHIVertexBufferView& vertexBufferView,
+	    const RHIIndexBufferView& indexBufferView,
+	    std::uint32_t vertexCount,
+	    std::uint32_t indexCount) noexcept;
 
 	// -------------------------------------------------------------------------
 	// Binding
 	// -------------------------------------------------------------------------
 
 	// Sets vertex and index buffers on the command list (IA stage)
-	void Bind(ID3D12GraphicsCommandList* cmdList) const noexcept;
+	void Bind(RHICommandList& cmdList) const noexcept;
 
 	// -------------------------------------------------------------------------
 	// Accessors
@@ -66,17 +60,23 @@ class SPARKLE_RENDERER_API GPUMesh final
 	[[nodiscard]] std::uint32_t GetIndexCount() const noexcept { return m_indexCount; }
 	[[nodiscard]] std::uint32_t GetVertexCount() const noexcept { return m_vertexCount; }
 
-	[[nodiscard]] bool IsValid() const noexcept { return m_vertexBuffer && m_indexBuffer; }
+	[[nodiscard]] bool IsValid() const noexcept { return m_vertices.IsValid() && m_indices.IsValid(); }
+
+	/// Arena bytes used by the vertex and index ranges.
+	[[nodiscard]] std::uint64_t GetSizeInBytes() const noexcept { return m_vertices.allocation.size + m_indices.allocation.size; }
+
+	[[nodiscard]] const GeometryRange& GetVertexRange() const noexcept { return m_vertices; }
+	[[nodiscard]] const GeometryRange& GetIndexRange() const noexcept { return m_indices; }
 
-	[[nodiscard]] const D3D12_VERTEX_BUFFER_VIEW& GetVertexBufferView() const noexcept { return m_vertexBufferView; }
-	[[nodiscard]] const D3D12_INDEX_BUFFER_VIEW& GetIndexBufferView() const noexcept { return m_indexBufferView; }
+	[[nodiscard]] const RHIVertexBufferView& GetVertexBufferView() const noexcept { return m_vertexBufferView; }
+	[[nodiscard]] const RHIIndexBufferView& GetIndexBufferView() const noexcept { return m_indexBufferView; }
 
   private:
-	Microsoft::WRL::ComPtr<ID3D12Resource2> m_vertexBuffer;
-	Microsoft::WRL::ComPtr<ID3D12Resource2> m_indexBuffer;
+	GeometryRange m_vertices;
+	GeometryRange m_indices;
 
-	D3D12_VERTEX_BUFFER_VIEW m_vertexBufferView{};
-	D3D12_INDEX_BUFFER_VIEW m_indexBufferView{};
+	RHIVertexBufferView m_vertexBufferView{};
+	RHIIndexBufferView m_indexBufferView{};
 
 	std::uint32_t m_vertexCount = 0;
 	std::uint32_t m_indexCount = 0;
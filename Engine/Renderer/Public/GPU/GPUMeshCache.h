@@ -1,32 +1,94 @@
 // =============================================================================
-// GPUMeshCache.h — Lazy GPU mesh upload manager
+// GPUMeshCache.h — Budgeted GPU mesh residency with stable slot handles
 // =============================================================================
 //
-// Caches GPU meshes by their CPU mesh pointer. Uploads on first access.
+// Caches GPU meshes by the content hash of their CPU geometry (MeshData),
+// not by Mesh or MeshData address. Meshes with equal vertex/index data —
+// instanced glTF meshes, identical procedural primitives, the same asset in a
+// reloaded or another level — resolve to a single upload.
 // Owned by Renderer — provides lazy upload for render passes.
 //
 // USAGE:
-//   GPUMeshCache cache(rhi);
-//   GPUMesh* gpuMesh = cache.GetOrUpload(cpuMesh);
-//   gpuMesh->Bind(cmdList);
+//   GPUMeshCache cache(rhi, uploadQueue, budgetBytes);
+//   const GPUMeshHandle handle = cache.Register(mesh.GetGeometry());  // Every mesh, when draws are rebuilt
+//   cache.ReleaseUnreferenced();                                      // After the whole mesh list
+//   cache.BeginFrame();                                               // Once per frame
+//   const GPUMesh* gpuMesh = cache.Acquire(handle);                   // Per batch
+//   cache.RecordUploads(commandList);                                 // Before the draws
+//
+// DESIGN:
+//   - Slot map: Register looks the geometry up by MeshData::contentHash
+//     (computed once by MakeMeshGeometry) and returns a dense
+//     {index, generation} handle; Acquire is an array index
+//   - A slot keeps its geometry registered while GPU buffers come and go:
+//     an evicted mesh is uploaded again on its next Acquire (a miss)
+//   - Resident bytes are tracked per slot against a configurable budget.
+//     Over budget, least-recently-acquired meshes are evicted from an
+//     intrusive LRU list stamped with the frame of last use
+//   - A mesh is only evicted once no frame in flight can still read it
+//     (last use at least RHISettings::FramesInFlight frames ago), so the
+//     budget may be exceeded while the working set itself is larger
+//   - ReleaseUnreferenced drops the geometry of slots not registered since
+//     the previous call (the scene no longer uses them). Resident ones are
+//     retained: their GPU buffers stay in the LRU list under the content
+//     hash until a later Register reuses them (level reload) or the budget
+//     evicts them. Handles of unregistered slots fail to Acquire
+//   - Geometry lives in a GPUGeometryArena (suballocated default-heap
+//     pages); Acquire stages the data and queues the copy, RecordUploads
+//     records it. A miss while the upload ring is full returns nullptr and
+//     is retried on the next Acquire
+//   - reusedMeshes/reuseMisses count each content once per mesh list: a
+//     hit is content an earlier list left resident, a miss is new content
+//     or content evicted since
+//   - Vertex/index counts are compared on a hash match; a mismatch (hash
+//     collision) gets a slot of its own that is never shared
 //
 // OWNERSHIP:
 //   - Renderer owns GPUMeshCache
-//   - GPUMeshCache owns GPUMesh instances
-//   - CPU Mesh lifetime must exceed cache usage
+//   - GPUMeshCache owns GPUMesh instances and the GPUGeometryArena they
+//     point into
+//   - Each registered slot keeps its geometry handle alive (it is needed to
+//     re-upload after eviction); retained slots hold GPU buffers only
 //
 // =============================================================================
 
 #pragma once
 
 #include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/GPU/GPUGeometryArena.h"
 #include "Renderer/Public/GPU/GPUMesh.h"
+#include "Renderer/Public/GPU/GPUMeshHandle.h"
+#include "GameFramework/Public/Scene/MeshData.h"
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <vector>
+
+class RHICommandList;
+class RHIDevice;
+
+// =============================================================================
+// GPUMeshCacheStats
+// =============================================================================
 
-class D3D12Rhi;
-class Mesh;
+struct GPUMeshCacheStats
+{
+	std::uint64_t hits = 0;        // Acquires of a resident mesh
+	std::uint64_t misses = 0;      // Acquires that had to upload
+	std::uint64_t evictions = 0;   // Meshes dropped to stay within budget
+	std::uint64_t uploadFailures = 0;
+	std::uint64_t deferredUploads = 0;     // Misses skipped while the upload ring was full
+	std::uint64_t reusedMeshes = 0;        // Mesh-list registers whose content was already resident
+	std::uint64_t reuseMisses = 0;         // Mesh-list registers whose content must be uploaded
+	std::uint64_t uploadBytesAvoided = 0;  // GPU bytes those reuses did not upload again
+	std::uint32_t registeredCount = 0;     // Slots used by the current mesh list
+	std::uint32_t retainedCount = 0;       // Resident slots kept from earlier mesh lists
+	std::uint32_t residentCount = 0;
+	std::uint64_t residentBytes = 0;
+	std::uint64_t peakResidentBytes = 0;
+	std::uint64_t budgetBytes = 0;
+};
 
 // =============================================================================
 // GPUMeshCache
@@ -35,7 +97,9 @@ class Mesh;
 class SPARKLE_RENDERER_API GPUMeshCache final
 {
   public:
-	explicit GPUMeshCache(D3D12Rhi& rhi) noexcept;
+	static constexpr std::uint64_t kDefaultBudgetBytes = 1024ull * 1024ull * 1024ull;
+
+	GPUMeshCache(RHIDevice& rhi, GPUUploadQueue& uploads, std::uint64_t budgetBytes = kDefaultBudgetBytes) noexcept;
 	~GPUMeshCache() = default;
 
 	GPUMeshCache(const GPUMeshCache&) = delete;
@@ -44,24 +108,84 @@ class SPARKLE_RENDERER_API GPUMeshCache final
 	GPUMeshCache& operator=(GPUMeshCache&&) noexcept = default;
 
 	// -------------------------------------------------------------------------
-	// Cache Operations
+	// Registration
 	// -------------------------------------------------------------------------
 
-	// Returns cached GPUMesh or uploads new one. Never returns null on success.
-	// Returns nullptr if upload fails.
-	[[nodiscard]] GPUMesh* GetOrUpload(const Mesh& cpuMesh);
+	/// Returns the slot for this geometry's content, creating one on first
+	/// sight. Does not upload. Returns an invalid handle for null geometry.
+	[[nodiscard]] GPUMeshHandle Register(const MeshGeometryHandle& geometry);
 
-	// Releases all cached GPU meshes
+	/// Releases slots not registered since the previous call. Resident meshes
+	/// are retained for reuse (see DESIGN); the rest are freed.
+	void ReleaseUnreferenced();
+
+	// -------------------------------------------------------------------------
+	// Per-Frame Use
+	// -------------------------------------------------------------------------
+
+	/// Advances the LRU frame stamp.
+	void BeginFrame() noexcept { ++m_frame; }
+
+	/// Returns the resident GPU mesh, uploading it if needed, and marks it
+	/// used this frame. Returns nullptr for a stale handle or failed upload.
+	[[nodiscard]] const GPUMesh* Acquire(GPUMeshHandle handle);
+
+	/// Records the copies queued by this frame's Acquire misses. Must precede
+	/// the draws of those meshes on the GPU timeline.
+	void RecordUploads(RHICommandList& commandList) { m_arena.RecordUploads(commandList); }
+
+	/// Changes the budget and evicts down to it where possible.
+	void SetBudget(std::uint64_t budgetBytes);
+
+	/// Releases all cached GPU meshes and slots immediately (GPU must be idle;
+	/// outstanding handles go stale).
 	void Clear() noexcept;
 
 	// -------------------------------------------------------------------------
 	// Queries
 	// -------------------------------------------------------------------------
 
-	[[nodiscard]] std::size_t GetCachedCount() const noexcept { return m_cache.size(); }
-	[[nodiscard]] bool Contains(const Mesh& cpuMesh) const noexcept;
+	[[nodiscard]] bool IsResident(GPUMeshHandle handle) const noexcept;
+	[[nodiscard]] std::uint32_t GetResidentCount() const noexcept { return m_stats.residentCount; }
+	[[nodiscard]] const GPUMeshCacheStats& GetStats() const noexcept { return m_stats; }
+	[[nodiscard]] GeometryArenaStats GetArenaStats() const noexcept { return m_arena.GetStats(); }
 
   private:
-	D3D12Rhi* m_rhi;
-	std::unordered_map<const Mesh*, std::unique_ptr<GPUMesh>> m_cache;
+	static constexpr std::uint32_t INVALID_SLOT = GPUMeshHandle::INVALID_INDEX;
+
+	struct Slot
+	{
+		MeshGeometryHandle geometry;        // Null = free or retained slot
+		std::unique_ptr<GPUMesh> gpuMesh;  // Null = not resident; ranges in m_arena
+		std::uint64_t contentHash = 0;
+		std::uint64_t bytes = 0;
+		std::uint64_t lastUsedFrame = 0;
+		std::uint64_t registration = 0;  // m_registration of the last Register
+		std::uint32_t vertexCount = 0;
+		std::uint32_t indexCount = 0;
+		std::uint32_t generation = 0;
+		bool bShared = false;  // Reachable through m_slotByContent
+		std::uint32_t lruPrev = INVALID_SLOT;  // Resident slots only, oldest first
+		std::uint32_t lruNext = INVALID_SLOT;
+		std::uint32_t nextFree = INVALID_SLOT;
+	};
+
+	[[nodiscard]] std::uint32_t AllocateSlot(const MeshGeometryHandle& geometry);
+	[[nodiscard]] bool IsLive(GPUMeshHandle handle) const noexcept;
+	[[nodiscard]] bool IsSafeToRelease(const Slot& slot) const noexcept;
+	void LinkLru(std::uint32_t index) noexcept;
+	void UnlinkLru(std::uint32_t index) noexcept;
+	void Evict(std::uint32_t index) noexcept;
+	void FreeSlot(std::uint32_t index) noexcept;
+	void EnforceBudget() noexcept;
+
+	GPUGeometryArena m_arena;
+	std::vector<Slot> m_slots;
+	std::unordered_map<std::uint64_t, std::uint32_t> m_slotByContent;  // Registration only
+	std::uint64_t m_registration = 1;                                  // Bumped by ReleaseUnreferenced
+	std::uint32_t m_freeHead = INVALID_SLOT;
+	std::uint32_t m_lruHead = INVALID_SLOT;  // Least recently used
+	std::uint32_t m_lruTail = INVALID_SLOT;  // Most recently used
+	std::uint64_t m_frame = 0;
+	GPUMeshCacheStats m_stats;
 };
@@ -0,0 +1,29 @@
+// =============================================================================
+// GPUMeshHandle.h — Stable slot handle into GPUMeshCache
+// =============================================================================
+//
+// Plain ids (no GPU types), so draw data can carry it. A handle stays valid
+// while its geometry is registered, whether or not the GPU mesh is resident;
+// the generation rejects handles to a slot that was freed and reused.
+//
+// =============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+// =============================================================================
+// GPUMeshHandle
+// =============================================================================
+
+struct GPUMeshHandle
+{
+	static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+	std::uint32_t index = INVALID_INDEX;  // Slot index
+	std::uint32_t generation = 0;         // Slot generation at registration
+
+	[[nodiscard]] bool IsValid() const noexcept { return index != INVALID_INDEX; }
+	bool operator==(const GPUMeshHandle&) const noexcept = default;
+};
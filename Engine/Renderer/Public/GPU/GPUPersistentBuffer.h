@@ -0,0 +1,81 @@
+// =============================================================================
+// GPUPersistentBuffer.h — Persistently mapped structured buffer, one copy per frame
+// =============================================================================
+//
+// Holds per-element shader data (objects, instance lists) that mostly stays
+// the same from frame to frame. Each frame in flight owns a mapped UPLOAD
+// buffer; Sync() rewrites only the ranges UploadDirtyTracker reports for the
+// current copy, so a static scene uploads nothing.
+//
+// USAGE:
+//   GPUPersistentBuffer objects(sizeof(PerObjectData), L"ObjectBuffer");
+//   objects.GetTracker().BeginUpdate(count);
+//   objects.GetTracker().MarkDirty(id);
+//   objects.Sync(rhi, frameIndex, [&](std::uint32_t first, std::uint32_t n, void* dst) { ... });
+//   context.BindShaderResource(slot, objects.GetGPUAddress(frameIndex));
+//
+// DESIGN:
+//   - A copy is only touched when its frame slot comes around, i.e. after
+//     the frame fence wait, so growing it in place is safe
+//   - Capacity grows to the next power of two; a grown copy is rewritten in full
+//   - Elements are tightly packed at the given stride (HLSL structured buffer
+//     layout, 16-byte aligned) — no 256-byte CBV padding
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/GPU/UploadDirtyTracker.h"
+#include "RHIConfig.h"
+#include "RHIDevice.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// =============================================================================
+// GPUPersistentBuffer
+// =============================================================================
+
+class SPARKLE_RENDERER_API GPUPersistentBuffer final
+{
+  public:
+	/// Writes count elements starting at first into dst (mapped memory at element first).
+	using FillFn = std::function<void(std::uint32_t first, std::uint32_t count, void* dst)>;
+
+	GPUPersistentBuffer(std::uint32_t stride, std::wstring debugName);
+	~GPUPersistentBuffer() noexcept = default;
+
+	GPUPersistentBuffer(const GPUPersistentBuffer&) = delete;
+	GPUPersistentBuffer& operator=(const GPUPersistentBuffer&) = delete;
+	GPUPersistentBuffer(GPUPersistentBuffer&&) = delete;
+	GPUPersistentBuffer& operator=(GPUPersistentBuffer&&) = delete;
+
+	/// Change tracking for the next Sync (BeginUpdate once per frame).
+	[[nodiscard]] UploadDirtyTracker& GetTracker() noexcept { return m_tracker; }
+
+	/// Brings the copy for frameIndex up to date with the tracker.
+	/// @return bytes written into mapped memory (0 when nothing changed)
+	std::uint64_t Sync(RHIDevice& rhi, std::uint32_t frameIndex, const FillFn& fill);
+
+	[[nodiscard]] RHIGpuAddress GetGPUAddress(std::uint32_t frameIndex) const noexcept { return m_copies[frameIndex].buffer.GetGPUAddress(); }
+	[[nodiscard]] std::uint32_t GetStride() const noexcept { return m_stride; }
+
+  private:
+	struct Copy
+	{
+		RHIBuffer buffer;            // Upload heap, persistently mapped
+		std::uint32_t capacity = 0;  // Elements
+	};
+
+	bool Reserve(RHIDevice& rhi, Copy& copy, std::uint32_t elementCount);
+
+	std::array<Copy, RHISettings::FramesInFlight> m_copies;
+	UploadDirtyTracker m_tracker;
+	std::vector<UploadRange> m_ranges;
+	std::wstring m_debugName;
+	std::uint32_t m_stride = 0;
+};
@@ -0,0 +1,198 @@
+// =============================================================================
+// GPUUploadQueue.h — Batched buffer uploads through a persistent staging ring
+// =============================================================================
+//
+// One upload-heap ring buffer, mapped for the renderer's lifetime, stages all
+// CPU -> GPU buffer copies. Copies queued during a frame are recorded
+// together and retire as one batch with the frame's fence value; ring space
+// is reused only once the GPU has passed that fence.
+// Owned by Renderer; GPUGeometryArena stages mesh geometry through it.
+//
+// USAGE:
+//   GPUUploadQueue uploads(rhi);
+//   uploads.BeginFrame();                                         // After the frame fence wait
+//   const UploadTicket ticket = uploads.UploadBuffer(dst, dstOffset, data, size);
+//   uploads.RecordCopies(commandList);                            // Before the reads of dst
+//   rhi.Signal(frameIndex);
+//   uploads.EndFrame(rhi.GetFenceValueForFrame(frameIndex));      // Closes the batch
+//   if (uploads.IsComplete(ticket)) { ... }                       // Or Wait(ticket)
+//
+// DESIGN:
+//   - Staging space comes from a FencedRingAllocator (Core); a request larger
+//     than the whole ring gets a dedicated upload buffer that retires with
+//     the same batch
+//   - A full ring returns an invalid allocation/ticket instead of blocking;
+//     callers keep the data and retry next frame, when BeginFrame has
+//     retired finished batches
+//   - RecordCopies records every queued copy with one Common -> CopyDest ->
+//     Common barrier pair per destination buffer (buffers decay to Common
+//     between submissions; reads promote it implicitly)
+//   - Tickets name a batch, not a fence value: the fence is only known once
+//     the batch is submitted. IsComplete polls the device fence; Wait blocks
+//     on it (only for batches already submitted)
+//   - A batch with unrecorded copies is not closed by EndFrame: its staging
+//     data must stay alive until the copies run
+//
+// NOTES:
+//   - Copies ride the frame's direct command list: the RHI has no separate
+//     copy queue, so "submission" is the frame's ExecuteCommandList
+//   - Destinations must be buffers with no other pending state change in the
+//     same command list before the copies
+//   - Not thread-safe; record from the thread that owns the frame list
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Core/Public/Memory/FencedRingAllocator.h"
+#include "RHIDevice.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+class RHICommandList;
+
+// =============================================================================
+// UploadTicket — completion handle of one batch
+// =============================================================================
+
+struct UploadTicket
+{
+	std::uint64_t batch = 0;  // 0 = invalid (the upload was not queued)
+
+	[[nodiscard]] bool IsValid() const noexcept { return batch != 0; }
+};
+
+// =============================================================================
+// UploadAllocation — staging memory for one or more copies
+// =============================================================================
+
+struct UploadAllocation
+{
+	std::byte* data = nullptr;  // Write-combined: write sequentially, never read
+	RHINativeObject buffer;     // Ring or dedicated staging buffer
+	std::uint64_t offset = 0;   // Of data within buffer
+	std::uint64_t size = 0;
+	UploadTicket ticket;
+
+	[[nodiscard]] bool IsValid() const noexcept { return data != nullptr; }
+};
+
+// =============================================================================
+// UploadQueueStats
+// =============================================================================
+
+struct UploadQueueStats
+{
+	std::uint64_t ringCapacity = 0;
+	std::uint64_t ringUsedBytes = 0;  // Open batch plus batches in flight
+	std::uint32_t batchesInFlight = 0;
+	std::uint64_t copiesRecorded = 0;  // By the last RecordCopies
+	std::uint64_t bytesRecorded = 0;
+	std::uint64_t dedicatedStagingBuffers = 0;  // Lifetime; requests larger than the ring
+	std::uint64_t ringFullRejections = 0;
+};
+
+// =============================================================================
+// GPUUploadQueue
+// =============================================================================
+
+class SPARKLE_RENDERER_API GPUUploadQueue final
+{
+  public:
+	static constexpr std::uint64_t kDefaultRingSize = 32ull * 1024ull * 1024ull;
+	static constexpr std::uint64_t kStagingAlignment = 16;
+
+	explicit GPUUploadQueue(RHIDevice& rhi, std::uint64_t ringSize = kDefaultRingSize);
+	~GPUUploadQueue() = default;
+
+	GPUUploadQueue(const GPUUploadQueue&) = delete;
+	GPUUploadQueue& operator=(const GPUUploadQueue&) = delete;
+	GPUUploadQueue(GPUUploadQueue&&) noexcept = default;
+	GPUUploadQueue& operator=(GPUUploadQueue&&) noexcept = default;
+
+	// -------------------------------------------------------------------------
+	// Staging
+	// -------------------------------------------------------------------------
+
+	/// Staging memory in the open batch. Invalid when the ring is full (or a
+	/// dedicated buffer cannot be created); retry after the next BeginFrame.
+	[[nodiscard]] UploadAllocation Allocate(std::uint64_t size, std::uint64_t alignment = kStagingAlignment);
+
+	/// Queues a copy of size bytes at srcOffset within staging into dst.
+	void CopyBuffer(const UploadAllocation& staging, std::uint64_t srcOffset, RHINativeObject dst, std::uint64_t dstOffset, std::uint64_t size);
+
+	/// Allocate + memcpy + CopyBuffer. Returns an invalid ticket when full.
+	[[nodiscard]] UploadTicket UploadBuffer(RHINativeObject dst, std::uint64_t dstOffset, const void* data, std::uint64_t size);
+
+	// -------------------------------------------------------------------------
+	// Per-Frame
+	// -------------------------------------------------------------------------
+
+	/// Retires batches the GPU has finished. Call after the frame fence wait.
+	void BeginFrame();
+
+	/// Records all queued copies into commandList, which must be submitted
+	/// before this frame's Signal.
+	void RecordCopies(RHICommandList& commandList);
+
+	/// Closes the open batch with the fence value the frame was signaled with.
+	void EndFrame(std::uint64_t fenceValue);
+
+	// -------------------------------------------------------------------------
+	// Tickets
+	// -------------------------------------------------------------------------
+
+	/// Polls the device fence; true once the ticket's copies have executed.
+	[[nodiscard]] bool IsComplete(UploadTicket ticket);
+
+	/// Blocks until the ticket's batch completes. Returns false (without
+	/// waiting) for a batch not yet closed by EndFrame.
+	bool Wait(UploadTicket ticket);
+
+	[[nodiscard]] bool HasQueuedCopies() const noexcept { return !m_queuedCopies.empty(); }
+	[[nodiscard]] UploadQueueStats GetStats() const noexcept;
+
+  private:
+	struct QueuedCopy
+	{
+		RHINativeObject dst;
+		std::uint64_t dstOffset = 0;
+		RHINativeObject src;
+		std::uint64_t srcOffset = 0;
+		std::uint64_t size = 0;
+	};
+
+	struct Batch
+	{
+		std::uint64_t id = 0;
+		std::uint64_t fenceValue = 0;
+		std::vector<RHIBuffer> dedicatedStaging;
+	};
+
+	[[nodiscard]] UploadAllocation AllocateDedicated(std::uint64_t size);
+	void Retire(std::uint64_t completedFenceValue);
+
+	RHIDevice* m_rhi;
+	RHIBuffer m_ring;
+	std::byte* m_ringData = nullptr;
+	RHINativeObject m_ringNative;
+	FencedRingAllocator m_ringAllocator;
+
+	std::vector<QueuedCopy> m_queuedCopies;
+	std::vector<RHINativeObject> m_copyTargets;  // Scratch for RecordCopies
+	std::vector<RHIBuffer> m_openDedicatedStaging;
+	bool m_bOpenBatchUsed = false;
+
+	std::uint64_t m_openBatch = 1;
+	std::uint64_t m_completedBatch = 0;
+	std::deque<Batch> m_batchesInFlight;  // Oldest first
+
+	std::uint64_t m_copiesRecorded = 0;
+	std::uint64_t m_bytesRecorded = 0;
+	std::uint64_t m_dedicatedStagingBuffers = 0;
+	std::uint64_t m_ringFullRejections = 0;
+};
@@ -0,0 +1,80 @@
+// =============================================================================
+// UploadDirtyTracker.h — Which elements each buffered copy still has to rewrite
+// =============================================================================
+//
+// A persistently mapped upload buffer needs one copy per frame in flight, and
+// a change made this frame must reach every copy as its frame slot comes
+// around. The tracker records the changed element indices per update and,
+// for a given copy, returns the coalesced ranges written since that copy was
+// last brought up to date.
+//
+// USAGE:
+//   UploadDirtyTracker tracker(RHISettings::FramesInFlight);
+//   tracker.BeginUpdate(objectCount);          // Once per frame
+//   tracker.MarkDirty(objectId);               // Or MarkAllDirty()
+//   tracker.CollectRanges(frameIndex, ranges); // Ranges to rewrite in that copy
+//
+// DESIGN:
+//   - Keeps the last copyCount updates as a ring; a copy that fell further
+//     behind (or was reallocated via InvalidateCopy) gets one full range
+//   - Ranges are sorted and adjacent indices merged, so a dense change set
+//     turns into a few large memcpys
+//   - Pure CPU — no GPU types, testable without a device
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+
+#include <cstdint>
+#include <vector>
+
+// =============================================================================
+// UploadRange
+// =============================================================================
+
+struct UploadRange
+{
+	std::uint32_t first = 0;
+	std::uint32_t count = 0;
+};
+
+// =============================================================================
+// UploadDirtyTracker
+// =============================================================================
+
+class SPARKLE_RENDERER_API UploadDirtyTracker final
+{
+  public:
+	explicit UploadDirtyTracker(std::uint32_t copyCount);
+
+	/// Starts a new update; elementCount is the live element count from now on.
+	/// A change in element count marks everything dirty.
+	void BeginUpdate(std::uint32_t elementCount);
+
+	void MarkDirty(std::uint32_t index);
+	void MarkAllDirty() noexcept;
+
+	/// Forces a full rewrite of one copy (e.g. after it was reallocated).
+	void InvalidateCopy(std::uint32_t copyIndex) noexcept;
+
+	/// Fills outRanges with what copyIndex must rewrite and marks it current.
+	void CollectRanges(std::uint32_t copyIndex, std::vector<UploadRange>& outRanges);
+
+	[[nodiscard]] std::uint32_t GetElementCount() const noexcept { return m_elementCount; }
+
+  private:
+	struct Update
+	{
+		std::uint64_t version = 0;
+		bool bAllDirty = false;
+		std::vector<std::uint32_t> indices;
+	};
+
+	std::vector<Update> m_history;          // Ring, one slot per copy
+	std::vector<std::uint64_t> m_copyVersions;  // Version each copy was last synced to (0 = never)
+	std::vector<std::uint32_t> m_scratch;
+	std::uint64_t m_version = 0;
+	std::uint32_t m_elementCount = 0;
+};
@@ -6,37 +6,85 @@
 // the current SceneView.
 //
 // USAGE:
-//   frameGraph.AddPass<ForwardOpaquePass>("ForwardOpaque",
-//       rootSig, pso, cbManager, heapManager, texManager, samplerLib,
-//       meshCache, swapChain, depthStencil);
+//   auto& pass = frameGraph.AddPass<ForwardOpaquePass>("ForwardOpaque",
+//       rhi, meshCache, materialTable);
+//   pass.SetBindings(bindings);  // Every frame, before Execute
 //
 // DESIGN:
 //   - Derives from RenderPass for FrameGraph integration
 //   - Constructor-injected dependencies (non-owning references)
+//   - Backend objects (root signature, PSO, heaps, targets, constant
+//     buffers) arrive each frame as ForwardOpaqueBindings: RHI handles only,
+//     so the pass records on any RHIDevice, including NullRhi
 //   - Setup captures SceneView pointer and declares resource usage
 //   - Execute records all draw commands through RenderContext
-//   - MVP: directly calls swap chain / depth stencil for transitions
+//   - Draws are submitted in DrawList sort-key order (material, mesh, depth);
+//     vertex/index buffers and the material index are only rebound when they
+//     differ from the previous draw
+//   - Consecutive draws sharing geometry and material are merged by
+//     InstanceBatcher into one instanced draw
+//   - Transforms live in a persistent object buffer (t1) indexed by object
+//     ID; only objects that changed are rewritten. A per-instance object ID
+//     list (t2) maps SV_InstanceID to them
+//   - Declares back buffer (render target) and depth (depth write) in Setup;
+//     FrameGraph issues the transitions before Execute
+//   - Materials come from the renderer's GPUMaterialTable (t3): a batch only
+//     sets its material index (b3 root constant), nothing is uploaded per draw
+//   - Splits into contiguous batch ranges (at least kMinBatchesPerRange
+//     each) for parallel recording: uploads, mesh-cache acquisitions and
+//     geometry copies (on the frame list) run once in PrepareRanges, then
+//     every range binds full state and draws its batches; only range 0
+//     clears the targets
 //
 // NOTES:
 //   - Created and owned by FrameGraph via AddPass<T>()
 //   - Dependencies must outlive this pass
-//   - When FrameGraph matures, resource transitions will move out
 // ============================================================================
 
 #pragma once
 
 #include "Renderer/Public/FrameGraph/RenderPass.h"
 #include "Renderer/Public/FrameGraph/ResourceHandle.h"
+#include "Renderer/Public/SceneData/DrawList.h"
+#include "Renderer/Public/SceneData/InstanceBatcher.h"
+#include "Renderer/Public/GPU/GPUPersistentBuffer.h"
+#include "RHITypes.h"
 
-class D3D12ConstantBufferManager;
-class D3D12DepthStencil;
-class D3D12DescriptorHeapManager;
-class D3D12PipelineState;
-class D3D12RootSignature;
-class D3D12SamplerLibrary;
-class D3D12SwapChain;
+#include <vector>
+
+class GPUMesh;
 class GPUMeshCache;
-class TextureManager;
+class GPUMaterialTable;
+class RHIDevice;
+
+// ============================================================================
+// ForwardOpaqueBindings
+// ============================================================================
+
+/// Per-frame backend state the pass binds; filled by the owner of the
+/// pipeline objects (Renderer on D3D12, tests on NullRhi).
+struct ForwardOpaqueBindings
+{
+	RHINativeObject rootSignature;
+	RHINativeObject pipelineState;
+
+	RHICpuDescriptor renderTarget;  // Current back buffer
+	RHICpuDescriptor depthStencil;
+	float clearColor[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+	float clearDepth = 1.0f;
+	std::uint32_t width = 0;  // Viewport and scissor
+	std::uint32_t height = 0;
+
+	RHIGpuAddress perFrameConstants = 0;  // b0
+	RHIGpuAddress perViewConstants = 0;   // b1
+
+	RHINativeObject resourceHeap;  // Shader-visible CBV/SRV/UAV heap
+	RHINativeObject samplerHeap;
+	RHIGpuDescriptor textureTable;  // t0 (0 = not bound)
+	RHIGpuDescriptor samplerTable;  // s0.. (0 = not bound)
+
+	std::uint32_t frameInFlightIndex = 0;
+};
 
 // ============================================================================
 // ForwardOpaquePass
@@ -45,49 +93,62 @@ class TextureManager;
 class ForwardOpaquePass final : public RenderPass
 {
   public:
-	ForwardOpaquePass(
-	    std::string_view name,
-	    D3D12RootSignature& rootSignature,
-	    D3D12PipelineState& pipelineState,
-	    D3D12ConstantBufferManager& constantBufferManager,
-	    D3D12DescriptorHeapManager& descriptorHeapManager,
-	    TextureManager& textureManager,
-	    D3D12SamplerLibrary& samplerLibrary,
-	    GPUMeshCache& gpuMeshCache,
-	    D3D12SwapChain& swapChain,
-	    D3D12DepthStencil& depthStencil) noexcept;
+	ForwardOpaquePass(std::string_view name, RHIDevice& rhi, GPUMeshCache& gpuMeshCache, GPUMaterialTable& materialTable) noexcept;
 
 	~ForwardOpaquePass() noexcept override = default;
 
+	/// Fewest batches worth a command list of their own. Batches are already
+	/// instanced, so each one is a draw call with its own binds.
+	static constexpr std::uint32_t kMinBatchesPerRange = 64;
+
+	/// Backend state for the next Execute (targets and frame slot change every frame).
+	void SetBindings(const ForwardOpaqueBindings& bindings) noexcept { m_bindings = bindings; }
+
 	void Setup(PassBuilder& builder, const SceneView& sceneView) override;
 	void Execute(RenderContext& context) override;
 
+	[[nodiscard]] std::uint32_t GetRecordRangeCount(std::uint32_t maxRanges) const noexcept override;
+	void PrepareRanges(std::uint32_t rangeCount) override;
+	void ExecuteRange(RenderContext& context, std::uint32_t rangeIndex, std::uint32_t rangeCount) override;
+
+	/// Sort and state-elision counters of the last recorded frame.
+	[[nodiscard]] const DrawListStats& GetDrawStats() const noexcept { return m_drawList.GetStats(); }
+
+	/// Instanced batching counters (draw calls saved) of the last recorded frame.
+	[[nodiscard]] const InstanceBatchStats& GetBatchStats() const noexcept { return m_batcher.GetStats(); }
+
   private:
-	void PrepareTargets(RenderContext& context);
+	void PrepareTargets(RenderContext& context, bool bClear);
 	void ConfigurePipeline(RenderContext& context);
 	void BindFrameResources(RenderContext& context);
 	void BindGlobalResources(RenderContext& context);
-	void DrawOpaqueMeshes(RenderContext& context);
+	void UploadObjectData();
+	void ResolveMeshes();
+	void DrawOpaqueMeshes(RenderContext& context, std::uint32_t first, std::uint32_t end);
 
 	// -------------------------------------------------------------------------
 	// Dependencies (not owned)
 	// -------------------------------------------------------------------------
 
-	D3D12RootSignature* m_rootSignature = nullptr;
-	D3D12PipelineState* m_pipelineState = nullptr;
-	D3D12ConstantBufferManager* m_constantBufferManager = nullptr;
-	D3D12DescriptorHeapManager* m_descriptorHeapManager = nullptr;
-	TextureManager* m_textureManager = nullptr;
-	D3D12SamplerLibrary* m_samplerLibrary = nullptr;
+	RHIDevice* m_rhi = nullptr;
 	GPUMeshCache* m_gpuMeshCache = nullptr;
-	D3D12SwapChain* m_swapChain = nullptr;
-	D3D12DepthStencil* m_depthStencil = nullptr;
+	GPUMaterialTable* m_materialTable = nullptr;
 
 	// -------------------------------------------------------------------------
 	// Per-frame state (set during Setup, valid until next Setup call)
 	// -------------------------------------------------------------------------
 
 	const SceneView* m_sceneView = nullptr;
+	ForwardOpaqueBindings m_bindings;
 	ResourceHandle m_backBuffer;
 	ResourceHandle m_depthBuffer;
+
+	// Sorted draw order and its instanced batches (rebuilt in Setup, capacity kept across frames)
+	DrawList m_drawList;
+	InstanceBatcher m_batcher;
+	std::vector<const GPUMesh*> m_batchMeshes;  // GPU mesh per batch, resolved in PrepareRanges
+
+	// Persistent per-frame-in-flight GPU data (only changed ranges rewritten)
+	GPUPersistentBuffer m_objectBuffer;      // PerObjectData by object ID (t1)
+	GPUPersistentBuffer m_instanceIdBuffer;  // Object ID per batched instance (t2)
 };
@@ -4,50 +4,46 @@
 // High-level command abstraction for render passes (Frostbite-inspired).
 //
 // PURPOSE:
-//   Wraps D3D12 command list operations with semantic methods, providing a
-//   clean API for render passes. Centralizes barrier management and creates
-//   an abstraction boundary for future multi-backend support.
+//   Gives render passes a clean, semantic recording API on top of the
+//   backend-agnostic RHICommandList, so the same pass code records into a
+//   D3D12 command list or into the Null backend's validating counter.
 //
 // USAGE:
-//   RenderContext ctx(cmdList);
+//   RenderContext ctx(rhi.GetRHICommandList(frameIndex));
 //   ctx.SetRootSignature(rootSig);
 //   ctx.SetPipelineState(pso);
-//   ctx.SetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+//   ctx.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
 //   ctx.BindVertexBuffer(vbView);
 //   ctx.BindIndexBuffer(ibView);
 //   ctx.BindConstantBuffer(0, gpuAddress);
 //   ctx.DrawIndexedInstanced(indexCount, 1, 0, 0, 0);
 //
 // DESIGN:
-//   - Thin wrapper over ID3D12GraphicsCommandList (MVP)
-//   - Passes call semantic methods instead of raw D3D12
+//   - Thin, inline forwarding layer over RHICommandList (no D3D12 types)
+//   - Passes call semantic methods instead of raw API calls
 //   - Single point for GPU debugging and validation
 //   - GetNativeCommandList() escape hatch for UI, ImGui, etc.
 //
 // NOTES:
-//   - Created per-frame by Renderer with active command list
-//   - ResourceState enum abstracts D3D12_RESOURCE_STATES
-//   - Future: expand for Vulkan/Metal backends
+//   - Created per-frame by Renderer over the frame's RHICommandList
+//   - ResourceState enum abstracts backend resource states
 // ============================================================================
 
 #pragma once
 
 #include "Renderer/Public/RendererAPI.h"
-#include "Renderer/Public/FrameGraph/ResourceState.h"
+#include "RHICommandList.h"
+#include "RHIResourceState.h"
+#include "RHITypes.h"
 
-#include <d3d12.h>
 #include <cstdint>
 
-// Forward declarations
-class D3D12PipelineState;
-class D3D12RootSignature;
-
 // ============================================================================
 // RenderContext
 // ============================================================================
 
 /// High-level command recording interface for render passes.
-/// Wraps D3D12 command list with semantic operations.
+/// Wraps an RHICommandList with semantic operations.
 class SPARKLE_RENDERER_API RenderContext final
 {
   public:
@@ -57,7 +53,7 @@ class SPARKLE_RENDERER_API RenderContext final
 
 	/// Constructs a RenderContext wrapping the given command list.
 	/// @param cmdList Active command list (must be in recording state)
-	explicit RenderContext(ID3D12GraphicsCommandList* cmdList) noexcept;
+	explicit RenderContext(RHICommandList& cmdList) noexcept : m_cmdList(&cmdList) {}
 	~RenderContext() noexcept = default;
 
 	RenderContext(const RenderContext&) = delete;
@@ -69,38 +65,68 @@ class SPARKLE_RENDERER_API RenderContext final
 	// Pipeline State
 	// -------------------------------------------------------------------------
 
-	/// Sets the graphics pipeline state object.
-	void SetPipelineState(ID3D12PipelineState* pso) noexcept;
+	/// Sets the graphics pipeline state object (backend object, e.g. ID3D12PipelineState*).
+	void SetPipelineState(void* pso) noexcept { m_cmdList->SetPipelineState(RHINativeObject{pso}); }
 
-	/// Sets the root signature for graphics commands.
-	void SetRootSignature(ID3D12RootSignature* rootSig) noexcept;
+	/// Sets the root signature for graphics commands (backend object, e.g. ID3D12RootSignature*).
+	void SetRootSignature(void* rootSig) noexcept { m_cmdList->SetRootSignature(RHINativeObject{rootSig}); }
 
 	// -------------------------------------------------------------------------
 	// Geometry / Input Assembly
 	// -------------------------------------------------------------------------
 
 	/// Sets the primitive topology for drawing.
-	void SetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY topology) noexcept;
+	void SetPrimitiveTopology(RHIPrimitiveTopology topology) noexcept { m_cmdList->SetPrimitiveTopology(topology); }
 
 	/// Binds a vertex buffer to the input assembler.
-	void BindVertexBuffer(const D3D12_VERTEX_BUFFER_VIEW& view) noexcept;
+	void BindVertexBuffer(const RHIVertexBufferView& view) noexcept { m_cmdList->BindVertexBuffer(view); }
 
 	/// Binds an index buffer to the input assembler.
-	void BindIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& view) noexcept;
+	void BindIndexBuffer(const RHIIndexBufferView& view) noexcept { m_cmdList->BindIndexBuffer(view); }
 
 	// -------------------------------------------------------------------------
 	// Resource Binding
 	// -------------------------------------------------------------------------
 
+	/// Makes the shader-visible descriptor heaps current (backend objects, e.g. ID3D12DescriptorHeap*).
+	/// Every command list starts without heaps; set them before binding descriptor tables.
+	void SetDescriptorHeaps(RHINativeObject resourceHeap, RHINativeObject samplerHeap) noexcept
+	{
+		m_cmdList->SetDescriptorHeaps(resourceHeap, samplerHeap);
+	}
+
 	/// Binds a constant buffer view to the specified root parameter slot.
 	/// @param rootParameterIndex Root parameter index
 	/// @param gpuAddress GPU virtual address of the constant buffer
-	void BindConstantBuffer(std::uint32_t rootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS gpuAddress) noexcept;
+	void BindConstantBuffer(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+	{
+		m_cmdList->BindConstantBuffer(rootParameterIndex, gpuAddress);
+	}
+
+	/// Binds a buffer SRV (structured/raw) directly to a root descriptor slot.
+	/// @param rootParameterIndex Root parameter index
+	/// @param gpuAddress GPU virtual address of the first element to expose
+	void BindShaderResource(std::uint32_t rootParameterIndex, RHIGpuAddress gpuAddress) noexcept
+	{
+		m_cmdList->BindShaderResource(rootParameterIndex, gpuAddress);
+	}
 
 	/// Binds a descriptor table to the specified root parameter slot.
 	/// @param rootParameterIndex Root parameter index
 	/// @param baseDescriptor Base GPU descriptor handle for the table
-	void BindDescriptorTable(std::uint32_t rootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE baseDescriptor) noexcept;
+	void BindDescriptorTable(std::uint32_t rootParameterIndex, RHIGpuDescriptor baseDescriptor) noexcept
+	{
+		m_cmdList->BindDescriptorTable(rootParameterIndex, baseDescriptor);
+	}
+
+	/// Sets one 32-bit value of a root-constants parameter.
+	/// @param rootParameterIndex Root parameter index
+	/// @param value Value to write
+	/// @param destOffset Offset in 32-bit values within the parameter
+	void SetRootConstant(std::uint32_t rootParameterIndex, std::uint32_t value, std::uint32_t destOffset = 0) noexcept
+	{
+		m_cmdList->SetRootConstant(rootParameterIndex, value, destOffset);
+	}
 
 	// -------------------------------------------------------------------------
 	// Render Targets
@@ -109,37 +135,46 @@ class SPARKLE_RENDERER_API RenderContext final
 	/// Sets the render target and optional depth-stencil view.
 	/// @param rtv Render target view handle
 	/// @param dsv Depth-stencil view handle (optional, use nullptr/empty if not needed)
-	void SetRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const D3D12_CPU_DESCRIPTOR_HANDLE* dsv = nullptr) noexcept;
+	void SetRenderTarget(RHICpuDescriptor rtv, const RHICpuDescriptor* dsv = nullptr) noexcept { m_cmdList->SetRenderTargets(1, &rtv, dsv); }
 
 	/// Sets multiple render targets and optional depth-stencil view.
 	/// @param numRTVs Number of render targets
 	/// @param rtvs Array of render target view handles
 	/// @param dsv Depth-stencil view handle (optional)
-	void SetRenderTargets(
-	    std::uint32_t numRTVs,
-	    const D3D12_CPU_DESCRIPTOR_HANDLE* rtvs,
-	    const D3D12_CPU_DESCRIPTOR_HANDLE* dsv = nullptr) noexcept;
+	void SetRenderTargets(std::uint32_t numRTVs, const RHICpuDescriptor* rtvs, const RHICpuDescriptor* dsv = nullptr) noexcept
+	{
+		m_cmdList->SetRenderTargets(numRTVs, rtvs, dsv);
+	}
 
 	/// Clears the render target to the specified color.
 	/// @param rtv Render target view to clear
 	/// @param color RGBA clear color (array of 4 floats)
-	void ClearRenderTarget(D3D12_CPU_DESCRIPTOR_HANDLE rtv, const float color[4]) noexcept;
+	void ClearRenderTarget(RHICpuDescriptor rtv, const float color[4]) noexcept { m_cmdList->ClearRenderTarget(rtv, color); }
 
 	/// Clears the depth-stencil buffer.
 	/// @param dsv Depth-stencil view to clear
 	/// @param depth Depth clear value (typically 1.0 or 0.0 for reversed-Z)
 	/// @param stencil Stencil clear value (typically 0)
-	void ClearDepthStencil(D3D12_CPU_DESCRIPTOR_HANDLE dsv, float depth, std::uint8_t stencil = 0) noexcept;
+	void ClearDepthStencil(RHICpuDescriptor dsv, float depth, std::uint8_t stencil = 0) noexcept
+	{
+		m_cmdList->ClearDepthStencil(dsv, depth, stencil);
+	}
 
 	// -------------------------------------------------------------------------
 	// Viewport & Scissor
 	// -------------------------------------------------------------------------
 
 	/// Sets the viewport for rendering.
-	void SetViewport(float x, float y, float width, float height, float minDepth = 0.0f, float maxDepth = 1.0f) noexcept;
+	void SetViewport(float x, float y, float width, float height, float minDepth = 0.0f, float maxDepth = 1.0f) noexcept
+	{
+		m_cmdList->SetViewport(x, y, width, height, minDepth, maxDepth);
+	}
 
 	/// Sets the scissor rectangle for rendering.
-	void SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept;
+	void SetScissorRect(std::int32_t left, std::int32_t top, std::int32_t right, std::int32_t bottom) noexcept
+	{
+		m_cmdList->SetScissorRect(left, top, right, bottom);
+	}
 
 	// -------------------------------------------------------------------------
 	// Draw Commands
@@ -151,36 +186,45 @@ class SPARKLE_RENDERER_API RenderContext final
 	    std::uint32_t instanceCount,
 	    std::uint32_t startIndexLocation,
 	    std::int32_t baseVertexLocation,
-	    std::uint32_t startInstanceLocation) noexcept;
+	    std::uint32_t startInstanceLocation) noexcept
+	{
+		m_cmdList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	}
 
 	/// Draws non-indexed, instanced primitives.
 	void DrawInstanced(
 	    std::uint32_t vertexCountPerInstance,
 	    std::uint32_t instanceCount,
 	    std::uint32_t startVertexLocation,
-	    std::uint32_t startInstanceLocation) noexcept;
+	    std::uint32_t startInstanceLocation) noexcept
+	{
+		m_cmdList->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+	}
 
 	// -------------------------------------------------------------------------
 	// Resource Barriers
 	// -------------------------------------------------------------------------
 
 	/// Transitions a resource between states.
-	/// @param resource The D3D12 resource to transition
+	/// @param resource The backend resource to transition (e.g. ID3D12Resource*)
 	/// @param before Current state (use ResourceState enum)
 	/// @param after Target state (use ResourceState enum)
-	void TransitionResource(ID3D12Resource* resource, ResourceState before, ResourceState after) noexcept;
+	void TransitionResource(void* resource, ResourceState before, ResourceState after) noexcept
+	{
+		m_cmdList->TransitionResource(RHINativeObject{resource}, before, after);
+	}
 
 	// -------------------------------------------------------------------------
 	// Native Access (Escape Hatch)
 	// -------------------------------------------------------------------------
 
-	/// Returns the underlying D3D12 command list for advanced operations.
-	/// Use sparingly — prefer semantic methods above.
-	[[nodiscard]] ID3D12GraphicsCommandList* GetNativeCommandList() const noexcept { return m_cmdList; }
+	/// Returns the RHI command list being recorded.
+	[[nodiscard]] RHICommandList& GetCommandList() const noexcept { return *m_cmdList; }
 
-  private:
-	/// Maps ResourceState enum to D3D12_RESOURCE_STATES.
-	[[nodiscard]] static D3D12_RESOURCE_STATES MapToD3D12State(ResourceState state) noexcept;
+	/// Returns the backend command list (ID3D12GraphicsCommandList* on D3D12,
+	/// nullptr on the Null backend). Use sparingly — prefer semantic methods above.
+	[[nodiscard]] void* GetNativeCommandList() const noexcept { return m_cmdList->GetNative(); }
 
-	ID3D12GraphicsCommandList* m_cmdList = nullptr;
+  private:
+	RHICommandList* m_cmdList = nullptr;
 };
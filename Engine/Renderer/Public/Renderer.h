@@ -33,6 +33,7 @@
 #include "Events/ScopedEventHandle.h"
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 enum class DepthMode : std::uint8_t;
 
@@ -51,9 +52,18 @@ class D3D12DescriptorHeapManager;
 class D3D12FrameResourceManager;
 class D3D12SwapChain;
 class FrameGraph;
+class ForwardOpaquePass;
+struct DrawListStats;
+struct InstanceBatchStats;
+struct FrameGraphCompileStats;
+class GPUUploadQueue;
 class GPUMeshCache;
+struct GPUMeshCacheStats;
+class GPUMaterialTable;
+struct MaterialTableStats;
 class RenderCamera;
 class Scene;
+class SceneViewBuilder;
 class Window;
 class UI;
 class TextureManager;
@@ -82,6 +92,28 @@ class SPARKLE_RENDERER_API Renderer final
 	// Executes a complete render frame: setup, scene traversal, UI, submission.
 	void OnRender() noexcept;
 
+	// =========================================================================
+	// Statistics
+	// =========================================================================
+
+	/// Counters from the most recently updated SceneView (visible/culled meshes).
+	[[nodiscard]] const SceneViewStats& GetLastSceneViewStats() const noexcept;
+
+	/// Sort time and elided state changes of the last opaque pass.
+	[[nodiscard]] const DrawListStats& GetLastOpaqueDrawStats() const noexcept;
+
+	/// Instanced batches and draw calls saved by the last opaque pass.
+	[[nodiscard]] const InstanceBatchStats& GetLastOpaqueBatchStats() const noexcept;
+
+	/// Frame graph compile cache hit rate and compile time.
+	[[nodiscard]] const FrameGraphCompileStats& GetFrameGraphCompileStats() const noexcept;
+
+	/// Mesh cache hits, misses, evictions and resident bytes against the budget.
+	[[nodiscard]] const GPUMeshCacheStats& GetMeshCacheStats() const noexcept;
+
+	/// Material count and records uploaded by the last material table sync.
+	[[nodiscard]] const MaterialTableStats& GetMaterialTableStats() const noexcept;
+
   private:
 	// -------------------------------------------------------------------------
 	// Initialization Helpers
@@ -92,6 +124,7 @@ class SPARKLE_RENDERER_API Renderer final
 	void CreatePSO();
 	void OnDepthModeChanged(DepthMode mode) noexcept;
 	void OnResize() noexcept;
+	void RebindFrameGraph() noexcept;
 	void SubscribeToDepthModeChanges() noexcept;
 	void SubscribeToWindowResize() noexcept;
 
@@ -105,22 +138,6 @@ class SPARKLE_RENDERER_API Renderer final
 	void SubmitFrame() noexcept;
 	void EndFrame() noexcept;
 
-	// -------------------------------------------------------------------------
-	// Scene View (Cauldron-style frame data)
-	// -------------------------------------------------------------------------
-
-	/// Builds a SceneView from owned subsystems for the current frame.
-	[[nodiscard]] SceneView BuildSceneView() const;
-
-	/// Initializes viewport and camera references for the SceneView.
-	void InitializeSceneView(SceneView& view) const;
-
-	/// Populates materials from the scene's loaded material descriptions.
-	void BuildMaterials(SceneView& view) const;
-
-	/// Populates mesh draw commands from the scene's mesh list.
-	void BuildMeshDraws(SceneView& view) const;
-
 	// -------------------------------------------------------------------------
 	// Owned Resources
 	// -------------------------------------------------------------------------
@@ -134,9 +151,15 @@ class SPARKLE_RENDERER_API Renderer final
 	// RHI (OWNED - Renderer creates and manages the RHI)
 	std::unique_ptr<D3D12Rhi> m_rhi;
 
+	// Batched CPU -> GPU buffer copies through a persistent staging ring
+	std::unique_ptr<GPUUploadQueue> m_uploadQueue;
+
 	// GPU mesh cache for lazy uploading CPU meshes to GPU
 	std::unique_ptr<GPUMeshCache> m_gpuMeshCache;
 
+	// Persistent GPU material table (rebuilt on level load, t3)
+	std::unique_ptr<GPUMaterialTable> m_materialTable;
+
 	// Texture manager
 	std::unique_ptr<TextureManager> m_textureManager;
 
@@ -175,12 +198,18 @@ class SPARKLE_RENDERER_API Renderer final
 	// Frame Graph (owned, created after all dependencies)
 	std::unique_ptr<FrameGraph> m_frameGraph;
 
+	// Opaque pass (owned by m_frameGraph, kept for its draw statistics)
+	ForwardOpaquePass* m_forwardOpaquePass = nullptr;
+
 	// Scene reference (not owned, for mesh access)
 	Scene* m_scene = nullptr;
 
 	// Window reference (not owned)
 	Window* m_window = nullptr;
 
+	// Persistent frame data (Cauldron-style), updated incrementally each frame
+	std::unique_ptr<SceneViewBuilder> m_sceneViewBuilder;
+
 	// Event subscriptions (RAII - auto-cleanup on destruction)
 	ScopedEventHandle m_depthModeChangedHandle;
 	ScopedEventHandle m_resizeHandle;
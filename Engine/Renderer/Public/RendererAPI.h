@@ -2,7 +2,9 @@
 #pragma once
 
 // DLL export/import configuration
-#ifdef SPARKLE_RENDERER_EXPORTS
+#if !defined(_WIN32)
+	#define SPARKLE_RENDERER_API __attribute__((visibility("default")))
+#elif defined(SPARKLE_RENDERER_EXPORTS)
 	#define SPARKLE_RENDERER_API __declspec(dllexport)
 #else
 	#define SPARKLE_RENDERER_API __declspec(dllimport)
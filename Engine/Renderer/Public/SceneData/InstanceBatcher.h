@@ -0,0 +1,88 @@
+// =============================================================================
+// InstanceBatcher.h — Groups sorted draws into instanced batches
+// =============================================================================
+//
+// Walks a sorted DrawList and merges consecutive draws that share geometry
+// and material into one InstanceBatch. The pass writes each batch's
+// transforms into the per-instance structured buffer and issues a single
+// DrawIndexedInstanced per batch instead of one draw per MeshDraw.
+//
+// USAGE:
+//   InstanceBatcher batcher;
+//   batcher.Build(drawList.GetPackets(), sceneView.meshDraws);
+//   for (const InstanceBatch& batch : batcher.GetBatches())
+//       for (uint32 i = 0; i < batch.instanceCount; ++i)
+//           const MeshDraw& draw = meshDraws[batcher.GetInstanceDrawIndices()[batch.firstInstance + i]];
+//
+// DESIGN:
+//   - Geometry identity is the shared MeshData (MeshDraw::geometry), so two
+//     meshes on one geometry become one batch (GPUMeshCache keys by content,
+//     so they also share one GPUMeshHandle)
+//   - Relies on the DrawList order (material, then mesh) to make batchable
+//     draws adjacent; a mesh-hash collision only splits a batch
+//   - Pure CPU — no GPU handles, so it can be exercised without a device
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/SceneData/DrawList.h"
+#include "Renderer/Public/GPU/GPUMeshHandle.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct MeshDraw;
+
+// =============================================================================
+// InstanceBatch
+// =============================================================================
+
+struct InstanceBatch
+{
+	const void* meshPtr = nullptr;     // First draw's mesh
+	GPUMeshHandle meshHandle;          // GPUMeshCache slot of the shared geometry
+	const void* geometry = nullptr;    // Shared geometry all instances draw
+	std::uint32_t materialId = 0;      // Index into GPUMaterialTable
+	std::uint32_t firstInstance = 0;   // Offset into GetInstanceDrawIndices()
+	std::uint32_t instanceCount = 0;
+};
+
+// =============================================================================
+// InstanceBatchStats
+// =============================================================================
+
+struct InstanceBatchStats
+{
+	std::uint32_t instanceCount = 0;  // Draws that went into batches
+	std::uint32_t batchCount = 0;     // Draw calls issued for them
+	std::uint32_t largestBatch = 0;
+
+	/// Draw calls avoided compared to one draw per MeshDraw.
+	[[nodiscard]] std::uint32_t GetDrawCallsSaved() const noexcept { return instanceCount - batchCount; }
+};
+
+// =============================================================================
+// InstanceBatcher
+// =============================================================================
+
+class SPARKLE_RENDERER_API InstanceBatcher final
+{
+  public:
+	/// Rebuilds batches from packets in their sorted order.
+	void Build(std::span<const DrawPacket> packets, std::span<const MeshDraw> draws);
+
+	[[nodiscard]] std::span<const InstanceBatch> GetBatches() const noexcept { return m_batches; }
+
+	/// MeshDraw index of every instance, batch after batch.
+	[[nodiscard]] std::span<const std::uint32_t> GetInstanceDrawIndices() const noexcept { return m_instanceDrawIndices; }
+
+	[[nodiscard]] const InstanceBatchStats& GetStats() const noexcept { return m_stats; }
+
+  private:
+	std::vector<InstanceBatch> m_batches;
+	std::vector<std::uint32_t> m_instanceDrawIndices;
+	InstanceBatchStats m_stats;
+};
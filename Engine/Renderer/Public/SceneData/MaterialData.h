@@ -29,14 +29,22 @@ struct SPARKLE_RENDERER_API MaterialData
 	/// Creates a MaterialData from a CPU-side MaterialDesc.
 	[[nodiscard]] static MaterialData FromDesc(const MaterialDesc& desc);
 
-	/// Builds the GPU constant buffer data from this material.
-	[[nodiscard]] PerObjectPSConstantBufferData ToPerObjectPSData() const
+	/// Packs this material into its GPU material table record.
+	[[nodiscard]] MaterialRecord ToRecord() const noexcept
 	{
-		PerObjectPSConstantBufferData data{};
-		data.BaseColor = baseColor;
-		data.Metallic = metallic;
-		data.Roughness = roughness;
-		data.F0 = f0;
-		return data;
+		MaterialRecord record{};
+		record.BaseColor = baseColor;
+		record.Metallic = metallic;
+		record.Roughness = roughness;
+		record.F0 = f0;
+		record.AlbedoTextureIdx = albedoTextureIdx;
+		return record;
+	}
+
+	[[nodiscard]] bool operator==(const MaterialData& other) const noexcept
+	{
+		return baseColor.x == other.baseColor.x && baseColor.y == other.baseColor.y && baseColor.z == other.baseColor.z &&
+		       baseColor.w == other.baseColor.w && metallic == other.metallic && roughness == other.roughness && f0 == other.f0 &&
+		       albedoTextureIdx == other.albedoTextureIdx;
 	}
 };
@@ -5,20 +5,23 @@
 #pragma once
 
 #include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/GPU/GPUMeshHandle.h"
 
-#include <DirectXMath.h>
 #include <cstdint>
 
 // =============================================================================
 // MeshDraw
 // =============================================================================
 
-/// Per-instance draw command with transform and material reference.
-/// meshPtr is opaque — used by GPUMeshCache to look up GPU buffers.
+/// Per-instance draw command referencing its object data and material.
+/// geometry is opaque — the shared MeshData, used as identity for sorting and
+/// batching so neither needs the GameFramework Mesh; meshHandle is its
+/// GPUMeshCache slot.
 struct SPARKLE_RENDERER_API MeshDraw
 {
-	DirectX::XMFLOAT4X4 worldMatrix = {};
-	DirectX::XMFLOAT3X4 worldInvTranspose = {};
-	std::uint32_t materialId = 0;   // Index into SceneView::materials[]
-	const void* meshPtr = nullptr;  // Opaque handle for GPUMeshCache lookup
+	std::uint32_t objectId = 0;      // Index into SceneView::objectWorlds[] and the GPU object buffer
+	std::uint32_t materialId = 0;    // Index into GPUMaterialTable
+	const void* meshPtr = nullptr;   // Opaque Mesh pointer
+	const void* geometry = nullptr;  // Opaque shared MeshData (geometry identity)
+	GPUMeshHandle meshHandle;        // GPUMeshCache slot of the mesh's geometry
 };
@@ -3,11 +3,15 @@
 // =============================================================================
 //
 // Pure-data structure representing everything the renderer needs to draw a
-// single frame. Built by Renderer::BuildSceneView() each frame.
+// single frame. Owned by SceneViewBuilder and kept across frames; each frame
+// SceneViewBuilder::Update() applies only what changed in the Scene.
 //
 // DESIGN:
 //   - NO D3D12 types, NO GPU handles — pure data only
 //   - Camera stored as pointer to renderer-owned RenderCamera
+//   - Object transforms are views of the Scene's TransformStore arrays,
+//     indexed by object ID; changedObjects lists what moved this frame
+//   - Arrays keep their capacity between frames (no per-frame allocation)
 //   - Can be serialized, logged, or replayed for debugging
 //
 // =============================================================================
@@ -16,14 +20,30 @@
 
 #include "Renderer/Public/RendererAPI.h"
 #include "Renderer/Public/SceneData/DirectionalLight.h"
-#include "Renderer/Public/SceneData/MaterialData.h"
 #include "Renderer/Public/SceneData/MeshDraw.h"
 
+#include <DirectXMath.h>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 class RenderCamera;
 
+// =============================================================================
+// SceneViewStats
+// =============================================================================
+
+/// Counters gathered while building the view (for overlays and logging).
+struct SceneViewStats
+{
+	std::uint32_t totalMeshes = 0;    // Meshes considered for drawing
+	std::uint32_t visibleMeshes = 0;  // Emitted as MeshDraws
+	std::uint32_t culledMeshes = 0;   // Rejected by the camera frustum
+
+	std::uint32_t updatedTransforms = 0;  // World matrices recomputed this frame
+	bool bDrawListReused = false;         // Nothing changed — last frame's draws kept
+};
+
 // =============================================================================
 // SceneView
 // =============================================================================
@@ -49,10 +69,24 @@ struct SPARKLE_RENDERER_API SceneView
 
 	DirectionalLight sunLight = {};
 
+	// -------------------------------------------------------------------------
+	// Objects (indexed by MeshDraw::objectId, valid until the next update)
+	// -------------------------------------------------------------------------
+
+	std::span<const DirectX::XMFLOAT4X4> objectWorlds;
+	std::span<const DirectX::XMFLOAT3X4> objectWorldInvTransposes;
+	std::vector<std::uint32_t> changedObjects;  // Object IDs whose transforms changed this frame
+	bool bAllObjectsChanged = false;            // Object set changed — IDs may have moved
+
 	// -------------------------------------------------------------------------
 	// Draw Commands
 	// -------------------------------------------------------------------------
 
-	std::vector<MeshDraw> meshDraws;
-	std::vector<MaterialData> materials;
+	std::vector<MeshDraw> meshDraws;  // materialId indexes the renderer's GPUMaterialTable
+
+	// -------------------------------------------------------------------------
+	// Statistics
+	// -------------------------------------------------------------------------
+
+	SceneViewStats stats = {};
 };
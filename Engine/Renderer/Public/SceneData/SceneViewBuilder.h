@@ -0,0 +1,95 @@
+// =============================================================================
+// SceneViewBuilder.h — Keeps a SceneView in sync with the Scene
+// =============================================================================
+//
+// Owns the persistent SceneView and the render-side mirror of the Scene it is
+// built from. Each Update applies only what changed since the last one:
+// moved transforms, a new mesh list, new materials or a moved camera.
+//
+// USAGE:
+//   SceneViewBuilder builder(scene, renderCamera, meshCache, materialTable);
+//   const SceneView& view = builder.Update(width, height);  // Once per frame
+//   frameGraph.Setup(view);
+//
+// DESIGN:
+//   - Mesh list changes register every mesh's geometry with GPUMeshCache and
+//     release what is no longer referenced; uploads happen later, when a pass
+//     acquires the handle
+//   - Material changes rebuild the GPUMaterialTable (synced by the caller)
+//   - Culling: SoA world spheres against the frustum, then the tighter AABB
+//     test for survivors; re-culls only when something moved
+//   - Backend-agnostic (RHI types only), so it runs on NullRhi
+//
+// =============================================================================
+
+#pragma once
+
+#include "Renderer/Public/RendererAPI.h"
+#include "Renderer/Public/SceneData/SceneView.h"
+#include "Renderer/Public/GPU/GPUMeshHandle.h"
+
+#include <cstdint>
+#include <vector>
+
+class GPUMaterialTable;
+class GPUMeshCache;
+class Mesh;
+class RenderCamera;
+class Scene;
+
+// =============================================================================
+// SceneViewBuilder
+// =============================================================================
+
+class SPARKLE_RENDERER_API SceneViewBuilder final
+{
+  public:
+	SceneViewBuilder(Scene& scene, const RenderCamera& camera, GPUMeshCache& meshCache, GPUMaterialTable& materialTable) noexcept;
+
+	SceneViewBuilder(const SceneViewBuilder&) = delete;
+	SceneViewBuilder& operator=(const SceneViewBuilder&) = delete;
+
+	/// Brings the persistent SceneView up to date with the Scene and camera.
+	[[nodiscard]] const SceneView& Update(std::uint32_t width, std::uint32_t height);
+
+	[[nodiscard]] const SceneView& GetSceneView() const noexcept { return m_view; }
+
+  private:
+	/// Refreshes viewport and camera references for the SceneView.
+	void InitializeSceneView(std::uint32_t width, std::uint32_t height);
+
+	/// Rebuilds the material table when the scene's material generation changed.
+	void UpdateMaterials();
+
+	/// Refreshes world bounds of added/moved meshes and re-culls the draw list
+	/// when meshes, transforms or the camera changed; otherwise keeps it.
+	void UpdateMeshDraws();
+
+	/// Recomputes the cached world bounding sphere of one TransformStore entry.
+	void UpdateWorldSphere(std::uint32_t denseIndex, const DirectX::XMFLOAT4X4& world);
+
+	// Dependencies (not owned)
+	Scene* m_scene = nullptr;
+	const RenderCamera* m_camera = nullptr;
+	GPUMeshCache* m_meshCache = nullptr;
+	GPUMaterialTable* m_materialTable = nullptr;
+
+	// Persistent frame data, updated incrementally by Update()
+	SceneView m_view;
+
+	// Render-side mirror of the scene, indexed by TransformStore dense index.
+	// Generations record which Scene/camera state the cached data reflects.
+	std::uint64_t m_meshListGeneration = ~0ull;
+	std::uint64_t m_materialGeneration = ~0ull;
+	std::uint64_t m_cameraGeneration = ~0ull;
+
+	std::vector<const Mesh*> m_denseToMesh;
+	std::vector<GPUMeshHandle> m_denseToMeshHandle;  // GPUMeshCache slot per entry, registered on mesh list change
+
+	// World bounding spheres (SoA) for the batch frustum test
+	std::vector<float> m_centerX;
+	std::vector<float> m_centerY;
+	std::vector<float> m_centerZ;
+	std::vector<float> m_radius;
+	std::vector<std::uint32_t> m_visibleIndices;
+};
@@ -0,0 +1,267 @@
+// ============================================================================
+// AccessorDecodeBenchmark.cpp
+// GltfAccessorReader bulk decode against the per-element cgltf path it
+// replaced. Accessors are built in memory (no file I/O) at two sizes: a
+// primitive that fits in L2 and a 1M-vertex one that streams from DRAM.
+// Plain memcpy/memset of the same bytes are reported as the bandwidth floor.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "GltfAccessorReader.h"
+
+// The cgltf implementation unit for this executable (GltfLoader.cpp is not linked)
+#define CGLTF_IMPLEMENTATION
+#include <cgltf.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	// Same size and attribute offsets as VertexData (position, uv, color, normal, tangent)
+	struct DecodedVertex
+	{
+		float position[3];
+		float uv[2];
+		float color[4];
+		float normal[3];
+		float tangent[4];
+	};
+	constexpr std::size_t kVertexStride = sizeof(DecodedVertex);
+
+	// Vertices per accessor, and how often it is decoded per measurement
+	struct Workload
+	{
+		const char* name;
+		std::size_t count;
+		std::uint32_t repeats;
+	};
+
+	std::vector<Workload> GetWorkloads()
+	{
+		return {
+		    {"16k", 16'384, Bench::Pick(64u, 1u)},
+		    {"1M", Bench::Pick<std::size_t>(1'000'000, 20'000), 1u},
+		};
+	}
+
+	// One buffer view over bytes, read by an accessor of count elements
+	struct TestAccessor
+	{
+		cgltf_buffer buffer{};
+		cgltf_buffer_view view{};
+		cgltf_accessor accessor{};
+
+		TestAccessor(std::vector<std::uint8_t>& bytes, cgltf_component_type componentType, cgltf_type type, std::size_t count, std::size_t stride, std::size_t offset, bool bNormalized)
+		{
+			buffer.size = bytes.size();
+			buffer.data = bytes.data();
+			view.buffer = &buffer;
+			view.size = bytes.size();
+			view.stride = stride;
+			accessor.component_type = componentType;
+			accessor.type = type;
+			accessor.count = count;
+			accessor.stride = stride;
+			accessor.offset = offset;
+			accessor.normalized = bNormalized;
+			accessor.buffer_view = &view;
+		}
+	};
+
+	std::vector<std::uint8_t> MakeBytes(std::size_t size)
+	{
+		std::vector<std::uint8_t> bytes(size);
+		std::uint32_t state = 0x9E3779B9u;
+		for (std::size_t i = 0; i < size; i += sizeof(float))
+		{
+			// Floats in [0, 1) (arbitrary bit patterns when read as integers)
+			state = state * 1664525u + 1013904223u;
+			const float value = static_cast<float>(state >> 8) / 16777216.0f;
+			std::memcpy(bytes.data() + i, &value, std::min(sizeof(float), size - i));
+		}
+		return bytes;
+	}
+
+	// The per-element loop GltfLoader ran before GltfAccessorReader
+	void ReadFloatsPerElement(const cgltf_accessor* accessor, std::uint8_t* dst, std::size_t dstStride, std::size_t components)
+	{
+		for (cgltf_size i = 0; i < accessor->count; ++i)
+		{
+			cgltf_accessor_read_float(accessor, i, reinterpret_cast<cgltf_float*>(dst + i * dstStride), components);
+		}
+	}
+
+	void ReadIndicesPerElement(const cgltf_accessor* accessor, std::uint32_t* dst)
+	{
+		for (cgltf_size i = 0; i < accessor->count; ++i)
+		{
+			dst[i] = static_cast<std::uint32_t>(cgltf_accessor_read_index(accessor, i));
+		}
+	}
+
+	// Bit-exact, except where cgltf leaves a normalized signed minimum below -1
+	// and the reader clamps it (glTF spec)
+	bool MatchesReference(const std::vector<DecodedVertex>& bulk, const std::vector<DecodedVertex>& reference)
+	{
+		const auto* values = reinterpret_cast<const float*>(bulk.data());
+		const auto* expected = reinterpret_cast<const float*>(reference.data());
+		const std::size_t floatCount = bulk.size() * kVertexStride / sizeof(float);
+		for (std::size_t i = 0; i < floatCount; ++i)
+		{
+			const bool bClamped = expected[i] < -1.0f && values[i] == -1.0f;
+			if (std::memcmp(&values[i], &expected[i], sizeof(float)) != 0 && !bClamped)
+				return false;
+		}
+		return true;
+	}
+
+	// Decodes one attribute both ways into separate vertex arrays and reports both
+	void CompareFloats(const char* name, const Workload& workload, TestAccessor& source, std::size_t dstOffset, std::size_t components)
+	{
+		std::vector<DecodedVertex> bulk(workload.count);
+		std::vector<DecodedVertex> perElement(workload.count);
+		auto* bulkBytes = reinterpret_cast<std::uint8_t*>(bulk.data()) + dstOffset;
+		auto* perElementBytes = reinterpret_cast<std::uint8_t*>(perElement.data()) + dstOffset;
+		const std::uint64_t items = static_cast<std::uint64_t>(workload.count) * workload.repeats;
+
+		char label[96];
+		std::snprintf(label, sizeof(label), "%s %s per-element cgltf", workload.name, name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			for (std::uint32_t r = 0; r < workload.repeats; ++r)
+				ReadFloatsPerElement(&source.accessor, perElementBytes, kVertexStride, components);
+		}), items);
+
+		std::snprintf(label, sizeof(label), "%s %s GltfAccessorReader", workload.name, name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			for (std::uint32_t r = 0; r < workload.repeats; ++r)
+				GltfAccessorReader::ReadFloats(&source.accessor, bulkBytes, kVertexStride, components);
+		}), items);
+
+		BENCH_CHECK(MatchesReference(bulk, perElement));
+	}
+
+	// What any decoder pays just to move the bytes: a memcpy of the accessor's
+	// source, and a memset of the 64-byte vertices it is written into
+	void ReportCopyFloor(const char* name, const Workload& workload, const std::vector<std::uint8_t>& bytes)
+	{
+		const std::uint64_t items = static_cast<std::uint64_t>(workload.count) * workload.repeats;
+		std::vector<std::uint8_t> copy(bytes.size());
+		std::vector<DecodedVertex> vertices(workload.count);
+
+		char label[96];
+		std::snprintf(label, sizeof(label), "%s %s source memcpy", workload.name, name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			for (std::uint32_t r = 0; r < workload.repeats; ++r)
+			{
+				std::memcpy(copy.data(), bytes.data(), bytes.size());
+				Bench::DoNotOptimize(copy);
+			}
+		}), items);
+
+		std::snprintf(label, sizeof(label), "%s vertex array memset", workload.name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			for (std::uint32_t r = 0; r < workload.repeats; ++r)
+			{
+				std::memset(vertices.data(), 0, vertices.size() * kVertexStride);
+				Bench::DoNotOptimize(vertices);
+			}
+		}), items);
+	}
+}  // namespace
+
+// ============================================================================
+// Attributes
+// ============================================================================
+
+BENCHMARK(AccessorDecode_PackedFloat3)
+{
+	for (const Workload& workload : GetWorkloads())
+	{
+		std::vector<std::uint8_t> bytes = MakeBytes(workload.count * 3 * sizeof(float));
+		TestAccessor positions(bytes, cgltf_component_type_r_32f, cgltf_type_vec3, workload.count, 3 * sizeof(float), 0, false);
+
+		ReportCopyFloor("f32x3", workload, bytes);
+		CompareFloats("position f32x3", workload, positions, offsetof(DecodedVertex, position), 3);
+	}
+}
+
+BENCHMARK(AccessorDecode_InterleavedFloat)
+{
+	// position, normal, uv, tangent in one 48-byte interleaved view
+	constexpr std::size_t kStride = 12 * sizeof(float);
+	for (const Workload& workload : GetWorkloads())
+	{
+		std::vector<std::uint8_t> bytes = MakeBytes(workload.count * kStride);
+		TestAccessor positions(bytes, cgltf_component_type_r_32f, cgltf_type_vec3, workload.count, kStride, 0, false);
+		TestAccessor normals(bytes, cgltf_component_type_r_32f, cgltf_type_vec3, workload.count, kStride, 12, false);
+		TestAccessor uvs(bytes, cgltf_component_type_r_32f, cgltf_type_vec2, workload.count, kStride, 24, false);
+		TestAccessor tangents(bytes, cgltf_component_type_r_32f, cgltf_type_vec4, workload.count, kStride, 32, false);
+
+		ReportCopyFloor("interleaved view", workload, bytes);
+		CompareFloats("position f32x3 /48", workload, positions, offsetof(DecodedVertex, position), 3);
+		CompareFloats("normal f32x3 /48", workload, normals, offsetof(DecodedVertex, normal), 3);
+		CompareFloats("uv f32x2 /48", workload, uvs, offsetof(DecodedVertex, uv), 2);
+		CompareFloats("tangent f32x4 /48", workload, tangents, offsetof(DecodedVertex, tangent), 4);
+	}
+}
+
+BENCHMARK(AccessorDecode_NormalizedInteger)
+{
+	// Quantized attributes (KHR_mesh_quantization style)
+	for (const Workload& workload : GetWorkloads())
+	{
+		std::vector<std::uint8_t> uvBytes = MakeBytes(workload.count * 2 * sizeof(std::uint16_t));
+		std::vector<std::uint8_t> normalBytes = MakeBytes(workload.count * 4 * sizeof(std::int8_t));
+		std::vector<std::uint8_t> colorBytes = MakeBytes(workload.count * 4 * sizeof(std::uint8_t));
+		TestAccessor uvs(uvBytes, cgltf_component_type_r_16u, cgltf_type_vec2, workload.count, 2 * sizeof(std::uint16_t), 0, true);
+		TestAccessor normals(normalBytes, cgltf_component_type_r_8, cgltf_type_vec3, workload.count, 4 * sizeof(std::int8_t), 0, true);
+		TestAccessor colors(colorBytes, cgltf_component_type_r_8u, cgltf_type_vec4, workload.count, 4 * sizeof(std::uint8_t), 0, true);
+
+		CompareFloats("uv unorm16x2", workload, uvs, offsetof(DecodedVertex, uv), 2);
+		CompareFloats("normal snorm8x3 /4", workload, normals, offsetof(DecodedVertex, normal), 3);
+		CompareFloats("color unorm8x4", workload, colors, offsetof(DecodedVertex, color), 4);
+	}
+}
+
+// ============================================================================
+// Indices
+// ============================================================================
+
+BENCHMARK(AccessorDecode_Indices)
+{
+	for (const Workload& workload : GetWorkloads())
+	{
+		const std::size_t count = workload.count * 3;
+		const std::uint64_t items = static_cast<std::uint64_t>(count) * workload.repeats;
+		std::vector<std::uint8_t> bytes16 = MakeBytes(count * sizeof(std::uint16_t));
+		std::vector<std::uint8_t> bytes32 = MakeBytes(count * sizeof(std::uint32_t));
+		TestAccessor indices16(bytes16, cgltf_component_type_r_16u, cgltf_type_scalar, count, sizeof(std::uint16_t), 0, false);
+		TestAccessor indices32(bytes32, cgltf_component_type_r_32u, cgltf_type_scalar, count, sizeof(std::uint32_t), 0, false);
+
+		std::vector<std::uint32_t> bulk(count);
+		std::vector<std::uint32_t> perElement(count);
+		for (TestAccessor* source : {&indices16, &indices32})
+		{
+			const char* type = source == &indices16 ? "u16" : "u32";
+			char label[96];
+			std::snprintf(label, sizeof(label), "%s %s indices per-element cgltf", workload.name, type);
+			Bench::Report(label, Bench::MeasureMs([&] {
+				for (std::uint32_t r = 0; r < workload.repeats; ++r)
+					ReadIndicesPerElement(&source->accessor, perElement.data());
+			}), items);
+
+			std::snprintf(label, sizeof(label), "%s %s indices GltfAccessorReader", workload.name, type);
+			Bench::Report(label, Bench::MeasureMs([&] {
+				for (std::uint32_t r = 0; r < workload.repeats; ++r)
+					GltfAccessorReader::ReadIndices(&source->accessor, bulk.data());
+			}), items);
+
+			BENCH_CHECK(bulk == perElement);
+		}
+	}
+}
@@ -0,0 +1,126 @@
+// ============================================================================
+// BenchmarkFramework.h
+// Minimal self-registering micro-benchmarks for the headless benchmark
+// executables.
+// ----------------------------------------------------------------------------
+// USAGE:
+//   BENCHMARK(Tlsf_Churn)
+//   {
+//       const std::uint32_t ops = Bench::Pick(2'000'000, 20'000);
+//       const double ms = Bench::MeasureMs([&] { RunChurn(ops); });
+//       Bench::Report("tlsf churn", ms, ops);
+//       BENCH_CHECK(allocator.GetStats().allocationCount == 0);
+//   }
+//
+// DESIGN:
+//   - Each benchmark executable links BenchmarkMain.cpp, which runs every
+//     registered benchmark (or those whose name contains argv filter) and
+//     prints one line per Report: best-of-N milliseconds and ns per item
+//   - --quick shrinks the workloads (Bench::Pick) so ctest can run every
+//     benchmark as a smoke test; full runs are done by hand
+//   - BENCH_CHECK compares the fast path against its reference; a mismatch
+//     fails the executable like a failed EXPECT in the tests
+//   - No third-party dependency, so the benchmarks build wherever Core does
+// ============================================================================
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace Bench
+{
+	using BenchmarkFunction = void (*)();
+
+	struct Benchmark
+	{
+		const char* name = nullptr;
+		BenchmarkFunction function = nullptr;
+	};
+
+	// Function-local statics: registration runs during static initialization
+	inline std::vector<Benchmark>& GetRegistry()
+	{
+		static std::vector<Benchmark> registry;
+		return registry;
+	}
+
+	inline bool& IsQuick()
+	{
+		static bool bQuick = false;
+		return bQuick;
+	}
+
+	inline std::uint32_t& GetFailureCount()
+	{
+		static std::uint32_t failures = 0;
+		return failures;
+	}
+
+	inline bool Register(const char* name, BenchmarkFunction function)
+	{
+		GetRegistry().push_back({name, function});
+		return true;
+	}
+
+	/// Full workload size, or the smoke-test size under --quick.
+	template <typename T> [[nodiscard]] T Pick(T full, T quick) noexcept
+	{
+		return IsQuick() ? quick : full;
+	}
+
+	/// Keeps a computed value alive so the measured work is not optimized away.
+	template <typename T> void DoNotOptimize(const T& value) noexcept
+	{
+		static const void* volatile sink = nullptr;
+		sink = &value;
+	}
+
+	/// Best wall time of `repeats` runs of fn, in milliseconds (one warm-up run first).
+	template <typename Fn> [[nodiscard]] double MeasureMs(Fn&& fn, std::uint32_t repeats = 5)
+	{
+		fn();
+
+		double best = 0.0;
+		for (std::uint32_t i = 0; i < repeats; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			fn();
+			const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			best = (i == 0 || ms < best) ? ms : best;
+		}
+		return best;
+	}
+
+	/// Prints one result line: time and time per item.
+	inline void Report(const char* label, double ms, std::uint64_t items)
+	{
+		const double nsPerItem = items > 0 ? ms * 1.0e6 / static_cast<double>(items) : 0.0;
+		std::printf("  %-40s %10.3f ms  %9.2f ns/item  (%llu items)\n", label, ms, nsPerItem, static_cast<unsigned long long>(items));
+	}
+
+	/// Prints a non-timing result (sizes, ratios).
+	inline void ReportValue(const char* label, double value, const char* unit)
+	{
+		std::printf("  %-40s %14.2f %s\n", label, value, unit);
+	}
+
+	inline bool Check(bool bPassed, const char* expression, const char* file, int line)
+	{
+		if (!bPassed)
+		{
+			++GetFailureCount();
+			std::fprintf(stderr, "%s:%d: BENCH_CHECK failed: %s\n", file, line, expression);
+		}
+		return bPassed;
+	}
+}  // namespace Bench
+
+#define BENCHMARK(name)                                                  \
+	static void name();                                                  \
+	static const bool name##_registered = ::Bench::Register(#name, name); \
+	static void name()
+
+#define BENCH_CHECK(expr) ::Bench::Check(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
@@ -0,0 +1,46 @@
+// ============================================================================
+// BenchmarkMain.cpp
+// Runs every BENCHMARK linked into the executable.
+//   <benchmark> [--quick] [name filter]
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "Core/Public/Diagnostics/Log.h"
+
+#include <cstdio>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+	// Allocator and loader diagnostics would drown the result lines
+	Logger::SetLevel(LogLevel::Fatal);
+
+	const char* filter = nullptr;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--quick") == 0)
+		{
+			Bench::IsQuick() = true;
+		}
+		else
+		{
+			filter = argv[i];
+		}
+	}
+
+	std::uint32_t run = 0;
+	for (const Bench::Benchmark& benchmark : Bench::GetRegistry())
+	{
+		if (filter && !std::strstr(benchmark.name, filter))
+			continue;
+
+		std::printf("[%s]%s\n", benchmark.name, Bench::IsQuick() ? " (quick)" : "");
+		benchmark.function();
+		++run;
+	}
+
+	const std::uint32_t failures = Bench::GetFailureCount();
+	std::printf("%u benchmarks, %u failed checks\n", run, failures);
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+// ============================================================================
+// DrawSortBenchmark.cpp
+// DrawList::RadixSort against std::sort and std::stable_sort over opaque
+// draw packets with realistic keys: one pipeline, 256 materials, 2048 meshes
+// and random view depth. Every timed run starts from the same unsorted copy;
+// the copy alone is reported so it can be subtracted.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "Renderer/Public/SceneData/DrawList.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	std::vector<DrawPacket> MakePackets(std::uint32_t count)
+	{
+		constexpr std::uint32_t kMaterialCount = 256;
+		constexpr std::uint32_t kMeshCount = 2048;
+
+		std::vector<DrawPacket> packets(count);
+		std::uint32_t state = 0xC0FFEEu;
+		const auto next = [&state] {
+			state = state * 1664525u + 1013904223u;
+			return state >> 8;
+		};
+
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			const std::uint32_t mesh = next() % kMeshCount;
+			packets[i].sortKey = DrawSortKey::Encode(0, next() % kMaterialCount, DrawSortKey::HashMesh(reinterpret_cast<const void*>(std::uintptr_t{mesh + 1} * 64)), next());
+			packets[i].drawIndex = i;
+		}
+		return packets;
+	}
+
+	// Same order as the stable radix sort: ties keep their draw order
+	bool PacketLess(const DrawPacket& a, const DrawPacket& b) noexcept
+	{
+		return a.sortKey != b.sortKey ? a.sortKey < b.sortKey : a.drawIndex < b.drawIndex;
+	}
+
+	bool SameOrder(const std::vector<DrawPacket>& a, const std::vector<DrawPacket>& b)
+	{
+		return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const DrawPacket& x, const DrawPacket& y) {
+			return x.sortKey == y.sortKey && x.drawIndex == y.drawIndex;
+		});
+	}
+
+	std::vector<std::uint32_t> GetCounts()
+	{
+		if (Bench::IsQuick())
+			return {1'000, 10'000, DrawList::kParallelSortThreshold};
+		return {10'000, 100'000, 1'000'000};
+	}
+}  // namespace
+
+BENCHMARK(DrawSort_RadixVsStdSort)
+{
+	const std::uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	const std::uint32_t workers = std::min(hardwareThreads, 8u);
+
+	for (const std::uint32_t count : GetCounts())
+	{
+		const std::vector<DrawPacket> unsorted = MakePackets(count);
+		std::vector<DrawPacket> packets;
+		std::vector<DrawPacket> reference;
+		std::vector<DrawPacket> scratch;
+		char label[96];
+
+		std::snprintf(label, sizeof(label), "%u copy only", count);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			packets = unsorted;
+			Bench::DoNotOptimize(packets);
+		}), count);
+
+		std::snprintf(label, sizeof(label), "%u std::sort", count);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			reference = unsorted;
+			std::sort(reference.begin(), reference.end(), PacketLess);
+		}), count);
+
+		std::snprintf(label, sizeof(label), "%u std::stable_sort", count);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			packets = unsorted;
+			std::stable_sort(packets.begin(), packets.end(), [](const DrawPacket& a, const DrawPacket& b) { return a.sortKey < b.sortKey; });
+		}), count);
+		BENCH_CHECK(SameOrder(packets, reference));
+
+		std::uint32_t passes = 0;
+		std::snprintf(label, sizeof(label), "%u radix, 1 thread", count);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			packets = unsorted;
+			passes = DrawList::RadixSort(packets, scratch, 1);
+		}), count);
+		BENCH_CHECK(SameOrder(packets, reference));
+
+		if (workers > 1)
+		{
+			std::snprintf(label, sizeof(label), "%u radix, %u threads", count, workers);
+			Bench::Report(label, Bench::MeasureMs([&] {
+				packets = unsorted;
+				DrawList::RadixSort(packets, scratch, workers);
+			}), count);
+			BENCH_CHECK(SameOrder(packets, reference));
+		}
+
+		std::snprintf(label, sizeof(label), "%u radix digit passes", count);
+		Bench::ReportValue(label, passes, "of 8");
+	}
+}
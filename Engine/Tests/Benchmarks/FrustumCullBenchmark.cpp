@@ -0,0 +1,214 @@
+// ============================================================================
+// FrustumCullBenchmark.cpp
+// Frustum batch culling (SoA, SIMD groups) against the per-object
+// IntersectsSphere/IntersectsAABB loop it replaced and against the batch
+// scalar path (plane cache). Objects are scattered around a camera so that
+// roughly a fifth of them are visible.
+//
+// The SIMD width is Frustum.cpp's: SSE2 in the engine build, AVX2 in
+// FrustumCullBenchmarkAVX2, which compiles its own copy with AVX2 enabled.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "Core/Public/Math/Frustum.h"
+
+#include <DirectXMath.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#if defined(SPARKLE_FRUSTUM_BENCH_AVX2) && !defined(_MSC_VER)
+	#define SPARKLE_FRUSTUM_BENCH_PATH "AVX2"
+#elif defined(SPARKLE_FRUSTUM_BENCH_AVX2)
+	#include <intrin.h>
+	#define SPARKLE_FRUSTUM_BENCH_PATH "AVX2"
+#elif !defined(_XM_NO_INTRINSICS_) && defined(_XM_SSE_INTRINSICS_)
+	#define SPARKLE_FRUSTUM_BENCH_PATH "SSE2"
+#else
+	#define SPARKLE_FRUSTUM_BENCH_PATH "scalar"
+#endif
+
+using namespace DirectX;
+
+namespace
+{
+	// This translation unit is built without AVX2, so the check itself is safe
+	bool CanRunSimdPath()
+	{
+#if defined(SPARKLE_FRUSTUM_BENCH_AVX2) && defined(_MSC_VER)
+		int info[4] = {};
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#elif defined(SPARKLE_FRUSTUM_BENCH_AVX2)
+		return __builtin_cpu_supports("avx2");
+#else
+		return true;
+#endif
+	}
+
+	Frustum MakeCameraFrustum()
+	{
+		const XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0.0f, 2.0f, -10.0f, 1.0f), XMVectorSet(0.0f, 2.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+		const XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f);
+
+		XMFLOAT4X4 viewProj;
+		XMStoreFloat4x4(&viewProj, XMMatrixMultiply(view, proj));
+
+		Frustum frustum;
+		frustum.ExtractFromViewProjection(viewProj);
+		return frustum;
+	}
+
+	// Bounds in both layouts: AoS for the per-object loop, SoA for the batches
+	struct Scene
+	{
+		std::vector<XMFLOAT3> centers;
+		std::vector<float> radii;
+		std::vector<XMFLOAT3> mins;
+		std::vector<XMFLOAT3> maxs;
+
+		std::vector<float> centerX, centerY, centerZ;
+		std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+
+		explicit Scene(std::uint32_t count)
+		{
+			std::uint32_t state = 0x12345678u;
+			const auto next = [&state](float lo, float hi) {
+				state = state * 1664525u + 1013904223u;
+				return lo + (hi - lo) * static_cast<float>(state >> 8) / 16777216.0f;
+			};
+
+			for (std::uint32_t i = 0; i < count; ++i)
+			{
+				const XMFLOAT3 center(next(-400.0f, 400.0f), next(-50.0f, 50.0f), next(-400.0f, 400.0f));
+				const float radius = next(0.25f, 4.0f);
+				const float half = radius * 0.57735f;  // Box inscribed in the sphere
+
+				centers.push_back(center);
+				radii.push_back(radius);
+				mins.emplace_back(center.x - half, center.y - half, center.z - half);
+				maxs.emplace_back(center.x + half, center.y + half, center.z + half);
+
+				centerX.push_back(center.x);
+				centerY.push_back(center.y);
+				centerZ.push_back(center.z);
+				minX.push_back(mins.back().x);
+				minY.push_back(mins.back().y);
+				minZ.push_back(mins.back().z);
+				maxX.push_back(maxs.back().x);
+				maxY.push_back(maxs.back().y);
+				maxZ.push_back(maxs.back().z);
+			}
+		}
+
+		[[nodiscard]] Frustum::SphereBatch Spheres() const noexcept
+		{
+			return {centerX.data(), centerY.data(), centerZ.data(), radii.data(), static_cast<std::uint32_t>(radii.size())};
+		}
+
+		[[nodiscard]] Frustum::AABBBatch AABBs() const noexcept
+		{
+			return {minX.data(), minY.data(), minZ.data(), maxX.data(), maxY.data(), maxZ.data(), static_cast<std::uint32_t>(radii.size())};
+		}
+	};
+
+	std::vector<std::uint32_t> GetCounts()
+	{
+		if (Bench::IsQuick())
+			return {1'000, 10'000};
+		return {1'000, 100'000, 1'000'000};
+	}
+
+	// Runs the three culling variants over count objects, checks they agree
+	template <typename PerObjectFn, typename BatchFn>
+	void CompareCulling(const char* shape, std::uint32_t count, PerObjectFn&& perObject, BatchFn&& batch)
+	{
+		std::vector<std::uint32_t> reference(count);
+		std::vector<std::uint32_t> scalar(count);
+		std::vector<std::uint32_t> simd(count);
+		std::vector<std::uint8_t> planeCache(count, 0);
+		std::uint32_t referenceCount = 0;
+		std::uint32_t scalarCount = 0;
+		std::uint32_t simdCount = 0;
+
+		char label[96];
+		std::snprintf(label, sizeof(label), "%s %u per-object loop", shape, count);
+		Bench::Report(label, Bench::MeasureMs([&] { referenceCount = perObject(reference.data()); }), count);
+
+		std::snprintf(label, sizeof(label), "%s %u batch scalar (plane cache)", shape, count);
+		Bench::Report(label, Bench::MeasureMs([&] { scalarCount = batch(scalar.data(), planeCache.data()); }), count);
+
+		if (CanRunSimdPath())
+		{
+			std::snprintf(label, sizeof(label), "%s %u batch %s", shape, count, SPARKLE_FRUSTUM_BENCH_PATH);
+			Bench::Report(label, Bench::MeasureMs([&] { simdCount = batch(simd.data(), nullptr); }), count);
+			BENCH_CHECK(simdCount == referenceCount);
+			BENCH_CHECK(std::equal(simd.begin(), simd.begin() + simdCount, reference.begin()));
+		}
+
+		BENCH_CHECK(scalarCount == referenceCount);
+		BENCH_CHECK(std::equal(scalar.begin(), scalar.begin() + scalarCount, reference.begin()));
+
+		std::snprintf(label, sizeof(label), "%s %u visible", shape, count);
+		Bench::ReportValue(label, 100.0 * referenceCount / count, "%");
+	}
+}  // namespace
+
+// ============================================================================
+// Spheres
+// ============================================================================
+
+BENCHMARK(FrustumCull_Spheres)
+{
+	if (!CanRunSimdPath())
+	{
+		std::printf("  CPU has no %s: SIMD rows skipped\n", SPARKLE_FRUSTUM_BENCH_PATH);
+	}
+
+	const Frustum frustum = MakeCameraFrustum();
+	for (const std::uint32_t count : GetCounts())
+	{
+		const Scene scene(count);
+		CompareCulling(
+		    "sphere",
+		    count,
+		    [&](std::uint32_t* out) {
+			    std::uint32_t visible = 0;
+			    for (std::uint32_t i = 0; i < count; ++i)
+			    {
+				    if (frustum.IntersectsSphere(scene.centers[i], scene.radii[i]))
+					    out[visible++] = i;
+			    }
+			    return visible;
+		    },
+		    [&](std::uint32_t* out, std::uint8_t* planeCache) { return frustum.CullSpheres(scene.Spheres(), out, planeCache); });
+	}
+}
+
+// ============================================================================
+// AABBs
+// ============================================================================
+
+BENCHMARK(FrustumCull_AABBs)
+{
+	const Frustum frustum = MakeCameraFrustum();
+	for (const std::uint32_t count : GetCounts())
+	{
+		const Scene scene(count);
+		CompareCulling(
+		    "aabb",
+		    count,
+		    [&](std::uint32_t* out) {
+			    std::uint32_t visible = 0;
+			    for (std::uint32_t i = 0; i < count; ++i)
+			    {
+				    if (frustum.IntersectsAABB(scene.mins[i], scene.maxs[i]))
+					    out[visible++] = i;
+			    }
+			    return visible;
+		    },
+		    [&](std::uint32_t* out, std::uint8_t* planeCache) { return frustum.CullAABBs(scene.AABBs(), out, planeCache); });
+	}
+}
@@ -0,0 +1,197 @@
+// ============================================================================
+// MeshCacheBenchmark.cpp
+// Cold glTF import (GltfLoader::Load: JSON parse, accessor decode, transform
+// evaluation) against loading the cooked .smesh of the same asset
+// (MeshCache::TryLoad). The asset is generated into a temp directory: grid
+// meshes with interleaved position/normal/uv/tangent in an external .bin.
+// Both runs read from the OS file cache; the difference is the import work.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "GameFramework/Public/Assets/GltfLoader.h"
+#include "GameFramework/Public/Assets/MeshCache.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Interleaved vertex as stored in the .bin (48 bytes)
+	struct SourceVertex
+	{
+		float position[3];
+		float normal[3];
+		float uv[2];
+		float tangent[4];
+	};
+
+	struct Workload
+	{
+		const char* name;
+		std::uint32_t meshCount;
+		std::uint32_t gridSide;  // Vertices per mesh = gridSide^2
+	};
+
+	std::vector<Workload> GetWorkloads()
+	{
+		if (Bench::IsQuick())
+			return {{"4 x 1k", 4, 32}};
+		return {{"16 x 4k", 16, 64}, {"128 x 16k", 128, 128}};
+	}
+
+	// Writes <directory>/Asset.gltf + Asset.bin; returns the .gltf path
+	std::filesystem::path WriteAsset(const std::filesystem::path& directory, const Workload& workload)
+	{
+		const std::uint32_t side = workload.gridSide;
+		const std::uint32_t vertexCount = side * side;
+		const std::uint32_t indexCount = (side - 1) * (side - 1) * 6;
+		const std::size_t vertexBytes = std::size_t{vertexCount} * sizeof(SourceVertex);
+		const std::size_t indexBytes = std::size_t{indexCount} * sizeof(std::uint32_t);
+		const std::size_t meshBytes = vertexBytes + indexBytes;
+
+		std::vector<SourceVertex> vertices(vertexCount);
+		std::vector<std::uint32_t> indices;
+		indices.reserve(indexCount);
+		for (std::uint32_t z = 0; z + 1 < side; ++z)
+		{
+			for (std::uint32_t x = 0; x + 1 < side; ++x)
+			{
+				const std::uint32_t i = z * side + x;
+				indices.insert(indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+			}
+		}
+
+		std::ofstream bin(directory / "Asset.bin", std::ios::binary);
+		std::string json = R"({"asset":{"version":"2.0"},"scene":0,"materials":[{"pbrMetallicRoughness":{"baseColorFactor":[0.8,0.8,0.8,1]}}],)";
+		std::string views;
+		std::string accessors;
+		std::string meshes;
+		std::string nodes;
+		std::string sceneNodes;
+
+		for (std::uint32_t m = 0; m < workload.meshCount; ++m)
+		{
+			// Each mesh is a slightly different height field so no two are identical
+			for (std::uint32_t i = 0; i < vertexCount; ++i)
+			{
+				const float u = static_cast<float>(i % side) / static_cast<float>(side - 1);
+				const float v = static_cast<float>(i / side) / static_cast<float>(side - 1);
+				const float height = 0.1f * static_cast<float>((i * 2654435761u + m) % 1000) / 1000.0f;
+				vertices[i] = {{u, height, v}, {0.0f, 1.0f, 0.0f}, {u, v}, {1.0f, 0.0f, 0.0f, 1.0f}};
+			}
+			bin.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertexBytes));
+			bin.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indexBytes));
+
+			const std::size_t offset = m * meshBytes;
+			const std::uint32_t view = m * 2;
+			const std::uint32_t accessor = m * 5;
+			const char* separator = m == 0 ? "" : ",";
+
+			char buffer[1024];
+			std::snprintf(buffer, sizeof(buffer),
+			    R"(%s{"buffer":0,"byteOffset":%zu,"byteLength":%zu,"byteStride":48,"target":34962},{"buffer":0,"byteOffset":%zu,"byteLength":%zu,"target":34963})",
+			    separator, offset, vertexBytes, offset + vertexBytes, indexBytes);
+			views += buffer;
+
+			std::snprintf(buffer, sizeof(buffer),
+			    R"(%s{"bufferView":%u,"byteOffset":0,"componentType":5126,"count":%u,"type":"VEC3","min":[0,0,0],"max":[1,0.1,1]},)"
+			    R"({"bufferView":%u,"byteOffset":12,"componentType":5126,"count":%u,"type":"VEC3"},)"
+			    R"({"bufferView":%u,"byteOffset":24,"componentType":5126,"count":%u,"type":"VEC2"},)"
+			    R"({"bufferView":%u,"byteOffset":32,"componentType":5126,"count":%u,"type":"VEC4"},)"
+			    R"({"bufferView":%u,"componentType":5125,"count":%u,"type":"SCALAR"})",
+			    separator, view, vertexCount, view, vertexCount, view, vertexCount, view, vertexCount, view + 1, indexCount);
+			accessors += buffer;
+
+			std::snprintf(buffer, sizeof(buffer),
+			    R"(%s{"primitives":[{"attributes":{"POSITION":%u,"NORMAL":%u,"TEXCOORD_0":%u,"TANGENT":%u},"indices":%u,"material":0}]})",
+			    separator, accessor, accessor + 1, accessor + 2, accessor + 3, accessor + 4);
+			meshes += buffer;
+
+			std::snprintf(buffer, sizeof(buffer), R"(%s{"mesh":%u,"translation":[%u,0,%u]})", separator, m, m % 16, m / 16);
+			nodes += buffer;
+
+			std::snprintf(buffer, sizeof(buffer), "%s%u", separator, m);
+			sceneNodes += buffer;
+		}
+
+		char buffers[128];
+		std::snprintf(buffers, sizeof(buffers), R"("buffers":[{"uri":"Asset.bin","byteLength":%zu}],)", meshBytes * workload.meshCount);
+		json += buffers;
+		json += R"("bufferViews":[)" + views + "],";
+		json += R"("accessors":[)" + accessors + "],";
+		json += R"("meshes":[)" + meshes + "],";
+		json += R"("nodes":[)" + nodes + "],";
+		json += R"("scenes":[{"nodes":[)" + sceneNodes + "]}]}";
+
+		const std::filesystem::path gltfPath = directory / "Asset.gltf";
+		std::ofstream(gltfPath, std::ios::binary) << json;
+		return gltfPath;
+	}
+
+	bool SameGeometry(const GltfLoader::LoadResult& a, const GltfLoader::LoadResult& b)
+	{
+		if (a.meshes.size() != b.meshes.size() || a.instances.size() != b.instances.size() || a.materials.size() != b.materials.size())
+			return false;
+
+		for (std::size_t i = 0; i < a.meshes.size(); ++i)
+		{
+			const MeshData& x = a.meshes[i];
+			const MeshData& y = b.meshes[i];
+			if (x.indices != y.indices || x.vertices.size() != y.vertices.size())
+				return false;
+			if (std::memcmp(x.vertices.data(), y.vertices.data(), x.GetVertexBufferSize()) != 0)
+				return false;
+		}
+		return a.materialIndices == b.materialIndices;
+	}
+}  // namespace
+
+BENCHMARK(MeshCache_ColdVsCooked)
+{
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "SparkleMeshCacheBenchmark";
+
+	for (const Workload& workload : GetWorkloads())
+	{
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory);
+
+		const std::filesystem::path gltfPath = WriteAsset(directory, workload);
+		const std::filesystem::path cachePath = MeshCache::GetCachePath(directory, gltfPath);
+		const std::uint64_t vertexCount = std::uint64_t{workload.meshCount} * workload.gridSide * workload.gridSide;
+
+		GltfLoader::LoadResult cold;
+		GltfLoader::LoadResult cooked;
+		bool bCooked = false;
+		char label[96];
+
+		std::snprintf(label, sizeof(label), "%s GltfLoader::Load (cold import)", workload.name);
+		Bench::Report(label, Bench::MeasureMs([&] { cold = GltfLoader::Load(gltfPath); }), vertexCount);
+		BENCH_CHECK(cold.IsValid());
+
+		std::snprintf(label, sizeof(label), "%s MeshCache::Write (cook)", workload.name);
+		Bench::Report(label, Bench::MeasureMs([&] { bCooked = MeshCache::Write(cachePath, gltfPath, cold); }, 1), vertexCount);
+		BENCH_CHECK(bCooked);
+
+		bool bHit = true;
+		std::snprintf(label, sizeof(label), "%s MeshCache::TryLoad (cooked)", workload.name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			cooked = {};
+			bHit &= MeshCache::TryLoad(cachePath, gltfPath, cooked);
+		}), vertexCount);
+		BENCH_CHECK(bHit);
+		BENCH_CHECK(SameGeometry(cold, cooked));
+
+		const double sourceBytes = static_cast<double>(std::filesystem::file_size(gltfPath) + std::filesystem::file_size(directory / "Asset.bin"));
+		std::snprintf(label, sizeof(label), "%s .gltf + .bin", workload.name);
+		Bench::ReportValue(label, sourceBytes / (1024.0 * 1024.0), "MiB");
+		std::snprintf(label, sizeof(label), "%s .smesh", workload.name);
+		Bench::ReportValue(label, static_cast<double>(std::filesystem::file_size(cachePath)) / (1024.0 * 1024.0), "MiB");
+	}
+
+	std::filesystem::remove_all(directory);
+}
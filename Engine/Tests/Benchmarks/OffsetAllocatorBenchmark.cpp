@@ -0,0 +1,164 @@
+// ============================================================================
+// OffsetAllocatorBenchmark.cpp
+// TlsfAllocator against FreeListAllocator (the std::map best-fit allocator
+// it replaced for GPU suballocation) under churn: random allocate/free of
+// 16 B-64 KB blocks with mixed alignments around a steady live set. Both
+// replay the same operation sequence. A separate checked run verifies that
+// no live blocks overlap and that freeing everything coalesces to one range.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "Core/Public/Memory/FreeListAllocator.h"
+#include "Core/Public/Memory/TlsfAllocator.h"
+
+#include <cstdio>
+#include <iterator>
+#include <map>
+#include <vector>
+
+namespace
+{
+	constexpr std::uint64_t kCapacity = 512ull << 20;
+
+	// Allocates when size != 0, otherwise frees live block (slot % live count)
+	struct ChurnOp
+	{
+		std::uint64_t size = 0;
+		std::uint64_t alignment = 1;
+		std::uint32_t slot = 0;
+	};
+
+	std::vector<ChurnOp> MakeOps(std::uint32_t opCount, std::uint32_t targetLive)
+	{
+		constexpr std::uint64_t kAlignments[] = {1, 16, 256, 4096};
+
+		std::uint32_t state = 0x5EED1234u;
+		const auto next = [&state] {
+			state = state * 1664525u + 1013904223u;
+			return state >> 8;
+		};
+
+		std::vector<ChurnOp> ops;
+		ops.reserve(opCount);
+		std::uint32_t live = 0;
+		for (std::uint32_t i = 0; i < opCount; ++i)
+		{
+			// Grow towards the target, then hover around it
+			const bool bAllocate = live == 0 || (live < targetLive ? next() % 4 != 0 : next() % 4 == 0);
+			if (bAllocate)
+			{
+				// Log-uniform sizes: small blocks are as common as large ones per octave
+				const std::uint64_t size = std::uint64_t{16} << (next() % 13);
+				ops.push_back({size + next() % size, kAlignments[next() % 4], 0});
+				++live;
+			}
+			else
+			{
+				ops.push_back({0, 1, next()});
+				--live;
+			}
+		}
+		return ops;
+	}
+
+	// Live blocks by offset; rejects a block that overlaps a neighbour
+	bool InsertWithoutOverlap(std::map<std::uint64_t, std::uint64_t>& live, const OffsetAllocation& block)
+	{
+		const auto next = live.lower_bound(block.offset);
+		if (next != live.end() && next->first < block.offset + block.size)
+			return false;
+		if (next != live.begin() && std::prev(next)->second > block.offset)
+			return false;
+		live.emplace(block.offset, block.offset + block.size);
+		return true;
+	}
+
+	// Replays ops; returns the number of failed allocations. With bCheck, every
+	// block is also checked for alignment and overlap with the live set.
+	template <typename Allocator>
+	std::uint32_t Replay(Allocator& allocator, const std::vector<ChurnOp>& ops, std::vector<OffsetAllocation>& live, bool bCheck, bool& bValid)
+	{
+		std::map<std::uint64_t, std::uint64_t> liveByOffset;
+		std::uint32_t failures = 0;
+		live.clear();
+
+		for (const ChurnOp& op : ops)
+		{
+			if (op.size != 0)
+			{
+				const OffsetAllocation block = allocator.Allocate(op.size, op.alignment);
+				if (!block.IsValid())
+				{
+					++failures;
+					continue;
+				}
+				if (bCheck)
+					bValid &= block.offset % op.alignment == 0 && InsertWithoutOverlap(liveByOffset, block);
+				live.push_back(block);
+			}
+			else if (!live.empty())
+			{
+				const std::size_t index = op.slot % live.size();
+				if (bCheck)
+					liveByOffset.erase(live[index].offset);
+				allocator.Free(live[index]);
+				live[index] = live.back();
+				live.pop_back();
+			}
+		}
+		return failures;
+	}
+
+	template <typename Allocator> void MeasureChurn(const char* name, const std::vector<ChurnOp>& ops)
+	{
+		std::vector<OffsetAllocation> live;
+		bool bValid = true;
+		std::uint32_t failures = 0;
+
+		char label[96];
+		std::snprintf(label, sizeof(label), "%s churn", name);
+		Bench::Report(label, Bench::MeasureMs([&] {
+			Allocator allocator(kCapacity);
+			failures = Replay(allocator, ops, live, false, bValid);
+			Bench::DoNotOptimize(live);
+		}), ops.size());
+
+		// Checked run (untimed), then fragmentation at the end of the churn
+		Allocator allocator(kCapacity);
+		failures += Replay(allocator, ops, live, true, bValid);
+		const OffsetAllocatorStats stats = allocator.GetStats();
+
+		std::snprintf(label, sizeof(label), "%s live blocks at end", name);
+		Bench::ReportValue(label, stats.allocationCount, "blocks");
+		std::snprintf(label, sizeof(label), "%s free ranges at end", name);
+		Bench::ReportValue(label, stats.freeRangeCount, "ranges");
+		std::snprintf(label, sizeof(label), "%s fragmentation at end", name);
+		Bench::ReportValue(label, 100.0 * stats.GetFragmentation(), "%");
+
+		for (const OffsetAllocation& block : live)
+			allocator.Free(block);
+		const OffsetAllocatorStats empty = allocator.GetStats();
+
+		BENCH_CHECK(failures == 0);
+		BENCH_CHECK(bValid);
+		BENCH_CHECK(allocator.IsEmpty());
+		BENCH_CHECK(empty.freeRangeCount == 1);
+		BENCH_CHECK(empty.largestFreeRange == kCapacity);
+	}
+}  // namespace
+
+BENCHMARK(OffsetAllocator_Churn)
+{
+	const std::uint32_t opCount = Bench::Pick(2'000'000u, 20'000u);
+	for (const std::uint32_t targetLive : {256u, 4096u})
+	{
+		const std::vector<ChurnOp> ops = MakeOps(opCount, targetLive);
+
+		char name[64];
+		std::snprintf(name, sizeof(name), "~%u live, FreeListAllocator", targetLive);
+		MeasureChurn<FreeListAllocator>(name, ops);
+		std::snprintf(name, sizeof(name), "~%u live, TlsfAllocator", targetLive);
+		MeasureChurn<TlsfAllocator>(name, ops);
+	}
+}
@@ -0,0 +1,136 @@
+// ============================================================================
+// TransientAliasingBenchmark.cpp
+// Heap bytes of FrameGraph transients with lifetime-based aliasing
+// (TransientResourceAllocator) against dedicated allocations, and the time
+// Place() takes. Two workloads: a 1080p deferred frame and synthetic pass
+// chains where each pass writes one texture read by the next 1-3 passes.
+// Every placement is checked: lifetime-overlapping resources never share bytes.
+// ============================================================================
+
+#include "BenchmarkFramework.h"
+
+#include "Renderer/Public/FrameGraph/TransientResourceAllocator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+	constexpr double kMiB = 1024.0 * 1024.0;
+
+	TransientAllocationRequest MakeRequest(std::uint32_t width, std::uint32_t height, RHITextureFormat format, std::uint32_t firstPass, std::uint32_t lastPass)
+	{
+		const TransientTextureDesc desc{width, height, format, nullptr};
+		return {desc.GetAllocationSize(), firstPass, lastPass};
+	}
+
+	bool PlacementsAreDisjoint(const std::vector<TransientAllocationRequest>& requests, const std::vector<TransientPlacement>& placements)
+	{
+		for (std::size_t a = 0; a < requests.size(); ++a)
+		{
+			for (std::size_t b = a + 1; b < requests.size(); ++b)
+			{
+				const bool bLifetimesOverlap = requests[a].firstPass <= requests[b].lastPass && requests[b].firstPass <= requests[a].lastPass;
+				if (!bLifetimesOverlap || placements[a].heapIndex != placements[b].heapIndex)
+					continue;
+
+				const bool bBytesOverlap = placements[a].offset < placements[b].offset + requests[b].size &&
+				                           placements[b].offset < placements[a].offset + requests[a].size;
+				if (bBytesOverlap)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// Places requests, reports memory with and without aliasing and the placement time
+	void Measure(const char* name, const std::vector<TransientAllocationRequest>& requests)
+	{
+		TransientResourceAllocator allocator;
+		std::vector<TransientPlacement> placements;
+
+		char label[96];
+		std::snprintf(label, sizeof(label), "%s Place()", name);
+		Bench::Report(label, Bench::MeasureMs([&] { allocator.Place(requests, placements); }), requests.size());
+
+		const TransientMemoryStats& stats = allocator.GetStats();
+		std::snprintf(label, sizeof(label), "%s unaliased", name);
+		Bench::ReportValue(label, stats.bytesWithoutAliasing / kMiB, "MiB");
+		std::snprintf(label, sizeof(label), "%s aliased (%u heaps)", name, stats.heapCount);
+		Bench::ReportValue(label, stats.bytesWithAliasing / kMiB, "MiB");
+		std::snprintf(label, sizeof(label), "%s peak live (lower bound)", name);
+		Bench::ReportValue(label, stats.peakLiveBytes / kMiB, "MiB");
+		std::snprintf(label, sizeof(label), "%s saved by aliasing", name);
+		Bench::ReportValue(label, 100.0 * (1.0 - static_cast<double>(stats.bytesWithAliasing) / static_cast<double>(stats.bytesWithoutAliasing)), "%");
+
+		BENCH_CHECK(stats.resourceCount == requests.size());
+		BENCH_CHECK(stats.bytesWithAliasing >= stats.peakLiveBytes);
+		BENCH_CHECK(stats.bytesWithAliasing <= stats.bytesWithoutAliasing);
+		BENCH_CHECK(PlacementsAreDisjoint(requests, placements));
+	}
+}  // namespace
+
+// ============================================================================
+// Deferred Frame
+// ============================================================================
+
+BENCHMARK(TransientAliasing_DeferredFrame1080p)
+{
+	// Passes: 0 GBuffer, 1 SSAO, 2 Lighting, 3-8 bloom down/up, 9 TAA, 10 Tonemap, 11 FXAA
+	constexpr std::uint32_t kWidth = 1920;
+	constexpr std::uint32_t kHeight = 1080;
+
+	std::vector<TransientAllocationRequest> requests = {
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA8_UNorm, 0, 2),      // GBuffer albedo
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA16_Float, 0, 2),     // GBuffer normals
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA8_UNorm, 0, 2),      // GBuffer material
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RG16_Float, 0, 9),       // Motion vectors
+	    MakeRequest(kWidth / 2, kHeight / 2, RHITextureFormat::R32_Float, 1, 2),  // SSAO
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA16_Float, 2, 9),     // HDR lighting
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA16_Float, 9, 10),    // TAA output
+	    MakeRequest(kWidth, kHeight, RHITextureFormat::RGBA8_UNorm, 10, 11),    // Tonemapped LDR
+	};
+
+	// Bloom: mip chain down (3-5) then back up (6-8), each level read by the next step
+	for (std::uint32_t level = 0; level < 3; ++level)
+	{
+		const std::uint32_t divisor = 2u << level;
+		requests.push_back(MakeRequest(kWidth / divisor, kHeight / divisor, RHITextureFormat::R11G11B10_Float, 3 + level, 8 - level));
+	}
+
+	Measure("deferred 1080p", requests);
+}
+
+// ============================================================================
+// Synthetic Chains
+// ============================================================================
+
+BENCHMARK(TransientAliasing_PassChains)
+{
+	constexpr RHITextureFormat kFormats[] = {
+	    RHITextureFormat::RGBA8_UNorm, RHITextureFormat::RGBA16_Float, RHITextureFormat::R11G11B10_Float, RHITextureFormat::R32_Float};
+	constexpr std::uint32_t kDivisors[] = {1, 1, 2, 4};
+
+	const std::vector<std::uint32_t> passCounts = Bench::IsQuick() ? std::vector<std::uint32_t>{10, 100} : std::vector<std::uint32_t>{10, 300, 1000};
+	for (const std::uint32_t passCount : passCounts)
+	{
+		std::uint32_t state = 0xBADC0DEu;
+		const auto next = [&state] {
+			state = state * 1664525u + 1013904223u;
+			return state >> 8;
+		};
+
+		std::vector<TransientAllocationRequest> requests;
+		for (std::uint32_t pass = 0; pass < passCount; ++pass)
+		{
+			const std::uint32_t divisor = kDivisors[next() % 4];
+			const std::uint32_t lastPass = std::min(pass + 1 + next() % 3, passCount - 1);
+			requests.push_back(MakeRequest(1920 / divisor, 1080 / divisor, kFormats[next() % 4], pass, lastPass));
+		}
+
+		char name[48];
+		std::snprintf(name, sizeof(name), "chain %u passes", passCount);
+		Measure(name, requests);
+	}
+}
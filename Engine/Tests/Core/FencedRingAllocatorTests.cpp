@@ -0,0 +1,235 @@
+// ============================================================================
+// FencedRingAllocatorTests.cpp
+// FencedRingAllocator driven by a fake fence: batching, wrap-around, retire.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Core/Public/Memory/FencedRingAllocator.h"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	// Stand-in for the GPU: frames are signaled in order and complete
+	// latency frames later
+	struct FakeFence
+	{
+		std::uint64_t lastSignaled = 0;
+		std::uint64_t completed = 0;
+
+		std::uint64_t Signal() { return ++lastSignaled; }
+		void CompleteUpTo(std::uint64_t value) { completed = std::max(completed, std::min(value, lastSignaled)); }
+	};
+
+	using Range = std::pair<std::uint64_t, std::uint64_t>;  // [begin, end)
+
+	bool Overlaps(const Range& a, const Range& b) { return a.first < b.second && b.first < a.second; }
+}  // namespace
+
+// ============================================================================
+// Basics
+// ============================================================================
+
+TEST_CASE(FencedRing_RejectsInvalidRequests)
+{
+	FencedRingAllocator ring(1024);
+	EXPECT(!ring.Allocate(0).IsValid());
+	EXPECT(!ring.Allocate(1025).IsValid());
+	EXPECT(!ring.Allocate(16, 3).IsValid());
+	EXPECT_EQ(ring.GetStats().failedAllocations, 3u);
+	EXPECT(ring.IsEmpty());
+}
+
+TEST_CASE(FencedRing_AllocatesContiguouslyAndAligned)
+{
+	FencedRingAllocator ring(1024);
+	const OffsetAllocation a = ring.Allocate(10);
+	const OffsetAllocation b = ring.Allocate(10, 16);
+	REQUIRE(b.IsValid());
+	EXPECT_EQ(a.offset, 0u);
+	EXPECT_EQ(b.offset, 16u);
+
+	// Alignment padding is charged to the batch
+	EXPECT_EQ(ring.GetStats().usedBytes, 26u);
+	EXPECT_EQ(ring.GetStats().openBytes, 26u);
+	EXPECT(ring.HasOpenBatch());
+}
+
+TEST_CASE(FencedRing_CloseBatchOnEmptyBatchIsNoOp)
+{
+	FencedRingAllocator ring(1024);
+	ring.CloseBatch(1);
+	EXPECT_EQ(ring.GetStats().batchesInFlight, 0u);
+}
+
+// ============================================================================
+// Retirement
+// ============================================================================
+
+TEST_CASE(FencedRing_BatchesRetireInFenceOrder)
+{
+	FakeFence fence;
+	FencedRingAllocator ring(1024);
+
+	(void)ring.Allocate(100);
+	ring.CloseBatch(fence.Signal());
+	(void)ring.Allocate(200);
+	ring.CloseBatch(fence.Signal());
+	EXPECT_EQ(ring.GetStats().batchesInFlight, 2u);
+
+	ring.Retire(fence.completed);
+	EXPECT_EQ(ring.GetStats().usedBytes, 300u);
+
+	fence.CompleteUpTo(1);
+	ring.Retire(fence.completed);
+	EXPECT_EQ(ring.GetStats().usedBytes, 200u);
+	EXPECT_EQ(ring.GetStats().batchesInFlight, 1u);
+
+	fence.CompleteUpTo(2);
+	ring.Retire(fence.completed);
+	EXPECT(ring.IsEmpty());
+}
+
+TEST_CASE(FencedRing_OpenBatchSurvivesRetire)
+{
+	FakeFence fence;
+	FencedRingAllocator ring(1024);
+	(void)ring.Allocate(100);
+	fence.CompleteUpTo(fence.Signal());
+	ring.Retire(fence.completed);
+	EXPECT_EQ(ring.GetStats().usedBytes, 100u);
+
+	ring.Reset();
+	EXPECT(ring.IsEmpty());
+	EXPECT(!ring.HasOpenBatch());
+}
+
+// ============================================================================
+// Wrap-Around
+// ============================================================================
+
+TEST_CASE(FencedRing_WrapWaitsForTheFenceThenStartsOverAtZero)
+{
+	FakeFence fence;
+	FencedRingAllocator ring(1000);
+
+	const OffsetAllocation a = ring.Allocate(400);
+	ring.CloseBatch(fence.Signal());
+	const OffsetAllocation b = ring.Allocate(400);
+	ring.CloseBatch(fence.Signal());
+	REQUIRE(b.IsValid());
+	EXPECT_EQ(a.offset, 0u);
+	EXPECT_EQ(b.offset, 400u);
+
+	// 200 bytes left at the end, 300 wanted: wrapping needs a's space back
+	EXPECT(!ring.Allocate(300).IsValid());
+	EXPECT_EQ(ring.GetStats().failedAllocations, 1u);
+
+	fence.CompleteUpTo(1);
+	ring.Retire(fence.completed);
+	const OffsetAllocation wrapped = ring.Allocate(300);
+	REQUIRE(wrapped.IsValid());
+	EXPECT_EQ(wrapped.offset, 0u);
+
+	// The skipped tail is charged to the open batch and freed with it
+	EXPECT_EQ(ring.GetStats().openBytes, 500u);
+	EXPECT_EQ(ring.GetStats().usedBytes, 900u);
+	ring.CloseBatch(fence.Signal());
+
+	fence.CompleteUpTo(2);
+	ring.Retire(fence.completed);
+	EXPECT_EQ(ring.GetStats().usedBytes, 500u);
+	fence.CompleteUpTo(3);
+	ring.Retire(fence.completed);
+	EXPECT(ring.IsEmpty());
+}
+
+TEST_CASE(FencedRing_EmptyRingRestartsAtZero)
+{
+	FakeFence fence;
+	FencedRingAllocator ring(1000);
+	(void)ring.Allocate(700);
+	ring.CloseBatch(fence.Signal());
+	fence.CompleteUpTo(1);
+	ring.Retire(fence.completed);
+
+	// Without the restart the head at 700 would force a wrap for 1000 bytes
+	const OffsetAllocation whole = ring.Allocate(1000);
+	REQUIRE(whole.IsValid());
+	EXPECT_EQ(whole.offset, 0u);
+}
+
+TEST_CASE(FencedRing_InFlightRangesAreNeverReused)
+{
+	constexpr std::uint64_t kCapacity = 64 * 1024;
+	constexpr std::uint32_t kFrames = 2000;
+	constexpr std::uint32_t kLatency = 2;  // Frames the fake GPU lags behind
+
+	FakeFence fence;
+	FencedRingAllocator ring(kCapacity);
+	std::mt19937 random(42);
+	std::uniform_int_distribution<std::uint64_t> sizeDistribution(1, 8 * 1024);
+	std::uniform_int_distribution<std::uint32_t> countDistribution(0, 6);
+
+	// Ranges of each closed batch by fence value, plus the open batch
+	std::deque<std::pair<std::uint64_t, std::vector<Range>>> inFlight;
+	std::vector<Range> open;
+	std::uint32_t wraps = 0;
+	std::uint64_t lastOffset = 0;
+
+	for (std::uint32_t frame = 0; frame < kFrames; ++frame)
+	{
+		fence.CompleteUpTo(fence.lastSignaled >= kLatency ? fence.lastSignaled - kLatency : 0);
+		ring.Retire(fence.completed);
+		while (!inFlight.empty() && inFlight.front().first <= fence.completed)
+		{
+			inFlight.pop_front();
+		}
+
+		const std::uint32_t count = countDistribution(random);
+		for (std::uint32_t i = 0; i < count; ++i)
+		{
+			const OffsetAllocation block = ring.Allocate(sizeDistribution(random), 16);
+			if (!block.IsValid())
+				continue;  // Full: the caller retries next frame
+
+			const Range range{block.offset, block.offset + block.size};
+			REQUIRE(range.second <= kCapacity);
+			REQUIRE(block.offset % 16 == 0);
+			for (const auto& [fenceValue, ranges] : inFlight)
+			{
+				for (const Range& other : ranges)
+				{
+					REQUIRE(!Overlaps(range, other));
+				}
+			}
+			for (const Range& other : open)
+			{
+				REQUIRE(!Overlaps(range, other));
+			}
+
+			wraps += block.offset < lastOffset ? 1 : 0;
+			lastOffset = block.offset;
+			open.push_back(range);
+		}
+
+		if (ring.HasOpenBatch())
+		{
+			const std::uint64_t fenceValue = fence.Signal();
+			ring.CloseBatch(fenceValue);
+			inFlight.emplace_back(fenceValue, std::move(open));
+			open.clear();
+		}
+	}
+
+	EXPECT(wraps > 10);
+
+	fence.CompleteUpTo(fence.lastSignaled);
+	ring.Retire(fence.completed);
+	EXPECT(ring.IsEmpty());
+}
@@ -0,0 +1,222 @@
+// ============================================================================
+// TlsfAllocatorTests.cpp
+// TlsfAllocator: alignment, coalescing, out-of-space and a random churn run.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Core/Public/Memory/TlsfAllocator.h"
+
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Live blocks by offset; rejects a block that overlaps a neighbour
+	bool InsertWithoutOverlap(std::map<std::uint64_t, std::uint64_t>& live, const OffsetAllocation& block)
+	{
+		const auto next = live.lower_bound(block.offset);
+		if (next != live.end() && next->first < block.offset + block.size)
+			return false;
+		if (next != live.begin() && std::prev(next)->second > block.offset)
+			return false;
+		live.emplace(block.offset, block.offset + block.size);
+		return true;
+	}
+}  // namespace
+
+// ============================================================================
+// Basics
+// ============================================================================
+
+TEST_CASE(Tlsf_RejectsInvalidRequests)
+{
+	TlsfAllocator allocator(1024);
+	EXPECT(!allocator.Allocate(0).IsValid());
+	EXPECT(!allocator.Allocate(16, 3).IsValid());
+	EXPECT(!allocator.Allocate(16, 0).IsValid());
+	EXPECT(allocator.IsEmpty());
+}
+
+TEST_CASE(Tlsf_WholeCapacityIsAllocatable)
+{
+	// Exact fits come from the request's own bin, not the rounded-up one
+	TlsfAllocator allocator(1000);
+	const OffsetAllocation block = allocator.Allocate(1000);
+	REQUIRE(block.IsValid());
+	EXPECT_EQ(block.offset, 0u);
+	EXPECT_EQ(allocator.GetStats().freeBytes, 0u);
+	EXPECT_EQ(allocator.GetStats().freeRangeCount, 0u);
+}
+
+TEST_CASE(Tlsf_AlignmentIsHonoured)
+{
+	TlsfAllocator allocator(1 << 20);
+	const OffsetAllocation odd = allocator.Allocate(3);
+	REQUIRE(odd.IsValid());
+
+	for (const std::uint64_t alignment : {16ull, 256ull, 4096ull, 65536ull})
+	{
+		const OffsetAllocation block = allocator.Allocate(100, alignment);
+		REQUIRE(block.IsValid());
+		EXPECT_EQ(block.offset % alignment, 0u);
+		EXPECT_EQ(block.size, 100u);
+	}
+
+	// Front padding went back to the bins, not into the blocks
+	EXPECT_EQ(allocator.GetStats().allocatedBytes, 3u + 4 * 100u);
+}
+
+// ============================================================================
+// Coalescing
+// ============================================================================
+
+TEST_CASE(Tlsf_FreeMergesBothNeighbours)
+{
+	TlsfAllocator allocator(4096);
+	const OffsetAllocation a = allocator.Allocate(1024);
+	const OffsetAllocation b = allocator.Allocate(1024);
+	const OffsetAllocation c = allocator.Allocate(1024);
+	const OffsetAllocation d = allocator.Allocate(1024);
+	REQUIRE(d.IsValid());
+
+	allocator.Free(a);
+	allocator.Free(c);
+	EXPECT_EQ(allocator.GetStats().freeRangeCount, 2u);
+	EXPECT(allocator.GetStats().GetFragmentation() > 0.0f);
+
+	// b sits between two free blocks: one range of 3 KB afterwards
+	allocator.Free(b);
+	EXPECT_EQ(allocator.GetStats().freeRangeCount, 1u);
+	EXPECT_EQ(allocator.GetStats().largestFreeRange, 3072u);
+
+	const OffsetAllocation merged = allocator.Allocate(3072);
+	REQUIRE(merged.IsValid());
+	EXPECT_EQ(merged.offset, 0u);
+
+	allocator.Free(merged);
+	allocator.Free(d);
+	EXPECT(allocator.IsEmpty());
+	EXPECT_EQ(allocator.GetStats().largestFreeRange, 4096u);
+	EXPECT_EQ(allocator.GetStats().GetFragmentation(), 0.0f);
+}
+
+TEST_CASE(Tlsf_DoubleFreeIsIgnored)
+{
+	TlsfAllocator allocator(1024);
+	const OffsetAllocation a = allocator.Allocate(256);
+	const OffsetAllocation b = allocator.Allocate(256);
+	allocator.Free(a);
+	allocator.Free(a);
+	EXPECT_EQ(allocator.GetAllocationCount(), 1u);
+	EXPECT_EQ(allocator.GetStats().allocatedBytes, 256u);
+
+	allocator.Free(b);
+	EXPECT(allocator.IsEmpty());
+	EXPECT_EQ(allocator.GetStats().freeRangeCount, 1u);
+}
+
+// ============================================================================
+// Out of Space
+// ============================================================================
+
+TEST_CASE(Tlsf_FailsWhenNoBlockFits)
+{
+	TlsfAllocator allocator(4096);
+	const OffsetAllocation a = allocator.Allocate(2048);
+	const OffsetAllocation b = allocator.Allocate(2048);
+	REQUIRE(b.IsValid());
+	EXPECT(!allocator.Allocate(1).IsValid());
+
+	// 2 KB free in two 1 KB pieces: a 2 KB request must still fail
+	allocator.Free(a);
+	const OffsetAllocation low = allocator.Allocate(1024);
+	allocator.Free(b);
+	const OffsetAllocation high = allocator.Allocate(1024, 2048);
+	REQUIRE(low.IsValid());
+	REQUIRE(high.IsValid());
+	EXPECT_EQ(high.offset, 2048u);
+	EXPECT(!allocator.Allocate(2048).IsValid());
+	EXPECT_EQ(allocator.GetStats().freeBytes, 2048u);
+}
+
+TEST_CASE(Tlsf_ResetFreesEverything)
+{
+	TlsfAllocator allocator(4096);
+	(void)allocator.Allocate(100);
+	(void)allocator.Allocate(200, 256);
+	allocator.Reset();
+	EXPECT(allocator.IsEmpty());
+	EXPECT(allocator.Allocate(4096).IsValid());
+}
+
+// ============================================================================
+// Churn
+// ============================================================================
+
+TEST_CASE(Tlsf_RandomChurnNeverOverlapsAndFullyCoalesces)
+{
+	constexpr std::uint64_t kCapacity = 64ull << 20;
+	constexpr std::uint32_t kOperations = 200000;
+
+	TlsfAllocator allocator(kCapacity);
+	std::vector<OffsetAllocation> blocks;
+	std::map<std::uint64_t, std::uint64_t> live;
+	std::uint64_t liveBytes = 0;
+
+	std::mt19937 random(1234);
+	std::uniform_int_distribution<std::uint64_t> sizeDistribution(16, 64 * 1024);
+	std::uniform_int_distribution<std::uint32_t> alignmentShift(0, 12);
+
+	std::uint32_t failedAllocations = 0;
+	for (std::uint32_t op = 0; op < kOperations; ++op)
+	{
+		// Drift towards half the capacity live, then hover there
+		const std::uint32_t allocatePercent = liveBytes < kCapacity / 2 ? 60 : 40;
+		const bool bAllocate = blocks.empty() || random() % 100 < allocatePercent;
+		if (bAllocate)
+		{
+			const std::uint64_t alignment = 1ull << alignmentShift(random);
+			const OffsetAllocation block = allocator.Allocate(sizeDistribution(random), alignment);
+			if (!block.IsValid())
+			{
+				++failedAllocations;
+				continue;
+			}
+			REQUIRE(block.offset % alignment == 0);
+			REQUIRE(block.offset + block.size <= kCapacity);
+			REQUIRE(InsertWithoutOverlap(live, block));
+			liveBytes += block.size;
+			blocks.push_back(block);
+		}
+		else
+		{
+			const std::size_t victim = random() % blocks.size();
+			allocator.Free(blocks[victim]);
+			live.erase(blocks[victim].offset);
+			liveBytes -= blocks[victim].size;
+			blocks[victim] = blocks.back();
+			blocks.pop_back();
+		}
+
+		if (op % 1024 == 0)
+		{
+			REQUIRE(allocator.GetStats().allocatedBytes == liveBytes);
+			REQUIRE(allocator.GetAllocationCount() == blocks.size());
+		}
+	}
+
+	// Half the capacity stays free, so only fragmentation can fail a request
+	EXPECT(failedAllocations < kOperations / 100);
+
+	for (const OffsetAllocation& block : blocks)
+	{
+		allocator.Free(block);
+	}
+	const OffsetAllocatorStats stats = allocator.GetStats();
+	EXPECT(allocator.IsEmpty());
+	EXPECT_EQ(stats.freeRangeCount, 1u);
+	EXPECT_EQ(stats.largestFreeRange, kCapacity);
+}
@@ -0,0 +1,165 @@
+// ============================================================================
+// NullRhiTests.cpp
+// NullRhi / NullCommandList: buffers, fences and command validation.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Null/NullRhi.h"
+#include "RHIDevice.h"
+
+#include <cstring>
+
+namespace
+{
+	// Binds everything a draw needs except vertex and index buffers
+	void BindDrawState(RHICommandList& commandList)
+	{
+		int pipeline = 0;
+		int rootSignature = 0;
+		const RHICpuDescriptor rtv{1};
+		commandList.SetPipelineState(RHINativeObject{&pipeline});
+		commandList.SetRootSignature(RHINativeObject{&rootSignature});
+		commandList.SetRenderTargets(1, &rtv, nullptr);
+		commandList.SetViewport(0.0f, 0.0f, 64.0f, 64.0f, 0.0f, 1.0f);
+		commandList.SetScissorRect(0, 0, 64, 64);
+	}
+}  // namespace
+
+// ============================================================================
+// Buffers
+// ============================================================================
+
+TEST_CASE(NullRhi_UploadBufferIsMappedAndAddressable)
+{
+	NullRhi rhi;
+	RHIBuffer buffer(rhi, RHIBufferDesc{256, RHIHeapType::Upload, L"Test"});
+	REQUIRE(buffer.IsValid());
+	REQUIRE(buffer.GetMappedData() != nullptr);
+
+	std::memset(buffer.GetMappedData(), 0xAB, 256);
+	EXPECT(rhi.IsAddressRangeValid(buffer.GetGPUAddress(), 256));
+	EXPECT(!rhi.IsAddressRangeValid(buffer.GetGPUAddress(), 257));
+	EXPECT_EQ(rhi.GetDeviceStats().bufferBytesLive, 256u);
+
+	buffer.Reset();
+	EXPECT_EQ(rhi.GetDeviceStats().buffersLive, 0u);
+	EXPECT_EQ(rhi.GetDeviceStats().bufferBytesPeak, 256u);
+}
+
+TEST_CASE(NullRhi_DefaultBufferHasAddressButNoMemory)
+{
+	NullRhi rhi;
+	RHIBuffer buffer(rhi, RHIBufferDesc{1024, RHIHeapType::Default, L"Test"});
+	REQUIRE(buffer.IsValid());
+	EXPECT(buffer.GetMappedData() == nullptr);
+	EXPECT(rhi.IsAddressRangeValid(buffer.GetGPUAddress() + 512, 512));
+}
+
+TEST_CASE(NullRhi_ReleasedBufferAddressIsRejected)
+{
+	NullRhi rhi;
+	RHIBuffer buffer(rhi, RHIBufferDesc{64, RHIHeapType::Upload, L"Test"});
+	const RHIGpuAddress address = buffer.GetGPUAddress();
+	buffer.Reset();
+	EXPECT(!rhi.IsAddressRangeValid(address, 64));
+}
+
+// ============================================================================
+// Fences
+// ============================================================================
+
+TEST_CASE(NullRhi_FencesCompleteOnSignal)
+{
+	NullRhi rhi;
+	rhi.Signal(0);
+	EXPECT_EQ(rhi.GetCompletedFenceValue(), rhi.GetFenceValueForFrame(0));
+}
+
+TEST_CASE(NullRhi_ManualFencesCompleteWhenTold)
+{
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	rhi.Signal(0);
+	rhi.Signal(1);
+	const std::uint64_t first = rhi.GetFenceValueForFrame(0);
+	const std::uint64_t second = rhi.GetFenceValueForFrame(1);
+	EXPECT(second > first);
+	EXPECT(rhi.GetCompletedFenceValue() < first);
+
+	rhi.CompleteFenceValue(first);
+	EXPECT_EQ(rhi.GetCompletedFenceValue(), first);
+
+	rhi.WaitForFenceValue(second);
+	EXPECT_EQ(rhi.GetCompletedFenceValue(), second);
+}
+
+// ============================================================================
+// Command Validation
+// ============================================================================
+
+TEST_CASE(NullRhi_ValidDrawIsCounted)
+{
+	NullRhi rhi;
+	RHIBuffer vertices(rhi, RHIBufferDesc{3 * 32, RHIHeapType::Upload, L"Vertices"});
+	RHIBuffer indices(rhi, RHIBufferDesc{3 * 4, RHIHeapType::Upload, L"Indices"});
+
+	rhi.ResetCommandList(0);
+	RHICommandList& commandList = rhi.GetRHICommandList(0);
+	BindDrawState(commandList);
+	commandList.BindVertexBuffer({vertices.GetGPUAddress(), 3 * 32, 32});
+	commandList.BindIndexBuffer({indices.GetGPUAddress(), 3 * 4, RHIIndexFormat::UInt32});
+	commandList.DrawIndexedInstanced(3, 2, 0, 0, 0);
+	rhi.CloseCommandList(0);
+
+	const NullCommandStats& stats = rhi.GetCommandStats(0);
+	EXPECT_EQ(stats.drawCalls, 1u);
+	EXPECT_EQ(stats.instances, 2u);
+	EXPECT_EQ(stats.indexBytesRead, 12u);
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(NullRhi_DrawPastIndexBufferIsRejected)
+{
+	NullRhi rhi;
+	RHIBuffer vertices(rhi, RHIBufferDesc{3 * 32, RHIHeapType::Upload, L"Vertices"});
+	RHIBuffer indices(rhi, RHIBufferDesc{3 * 4, RHIHeapType::Upload, L"Indices"});
+
+	rhi.ResetCommandList(0);
+	RHICommandList& commandList = rhi.GetRHICommandList(0);
+	BindDrawState(commandList);
+	commandList.BindVertexBuffer({vertices.GetGPUAddress(), 3 * 32, 32});
+	commandList.BindIndexBuffer({indices.GetGPUAddress(), 3 * 4, RHIIndexFormat::UInt32});
+	commandList.DrawIndexedInstanced(6, 1, 0, 0, 0);
+	rhi.CloseCommandList(0);
+
+	EXPECT(rhi.GetValidationErrorCount() > 0);
+}
+
+TEST_CASE(NullRhi_DrawWithoutPipelineIsRejected)
+{
+	NullRhi rhi;
+	rhi.ResetCommandList(0);
+	rhi.GetRHICommandList(0).DrawInstanced(3, 1, 0, 0);
+	rhi.CloseCommandList(0);
+
+	EXPECT(rhi.GetValidationErrorCount() > 0);
+}
+
+TEST_CASE(NullRhi_CopyOutsideBufferIsRejected)
+{
+	NullRhi rhi;
+	RHIBuffer source(rhi, RHIBufferDesc{128, RHIHeapType::Upload, L"Staging"});
+	RHIBuffer destination(rhi, RHIBufferDesc{64, RHIHeapType::Default, L"Destination"});
+
+	rhi.ResetCommandList(0);
+	RHICommandList& commandList = rhi.GetRHICommandList(0);
+	commandList.CopyBufferRegion(rhi.GetNativeBuffer(destination.GetHandle()), 0, rhi.GetNativeBuffer(source.GetHandle()), 0, 64);
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+
+	commandList.CopyBufferRegion(rhi.GetNativeBuffer(destination.GetHandle()), 32, rhi.GetNativeBuffer(source.GetHandle()), 0, 64);
+	rhi.CloseCommandList(0);
+
+	EXPECT(rhi.GetValidationErrorCount() > 0);
+	EXPECT_EQ(rhi.GetCommandStats(0).copies, 2u);
+}
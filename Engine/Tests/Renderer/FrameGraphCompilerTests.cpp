@@ -0,0 +1,313 @@
+// ============================================================================
+// FrameGraphCompilerTests.cpp
+// FrameGraphCompiler on synthetic graphs: culling, Kahn order, transitions,
+// and the declaration hash that keys the compile cache.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/FrameGraph/FrameGraphCompiler.h"
+
+#include <vector>
+
+namespace
+{
+	constexpr ResourceHandle kBackBuffer = ResourceHandle::BackBuffer();
+	constexpr ResourceHandle kDepth = ResourceHandle::DepthBuffer();
+	constexpr ResourceHandle kTransientA{ResourceHandle::FIRST_TRANSIENT_INDEX};
+	constexpr ResourceHandle kTransientB{ResourceHandle::FIRST_TRANSIENT_INDEX + 1};
+
+	ResourceAccess Read(ResourceHandle handle, ResourceState state) { return {handle, state, false}; }
+	ResourceAccess Write(ResourceHandle handle, ResourceState state) { return {handle, state, true}; }
+
+	// Back buffer and depth imported like the Renderer does, two transients
+	std::vector<FrameGraphResourceInfo> MakeResources()
+	{
+		std::vector<FrameGraphResourceInfo> resources(4);
+		resources[ResourceHandle::BACKBUFFER_INDEX] = {ResourceState::Present, ResourceState::Present, true, true};
+		resources[ResourceHandle::DEPTH_BUFFER_INDEX] = {ResourceState::DepthWrite, ResourceState::DepthWrite, true, false};
+		return resources;
+	}
+
+	std::vector<std::uint32_t> ScheduledPasses(const CompiledFrameGraph& compiled)
+	{
+		std::vector<std::uint32_t> order;
+		for (const CompiledPass& pass : compiled.passes)
+		{
+			order.push_back(pass.passIndex);
+		}
+		return order;
+	}
+
+	bool HasTransition(const CompiledFrameGraph& compiled, const CompiledPass& pass, ResourceHandle handle, ResourceState before, ResourceState after)
+	{
+		for (std::uint32_t i = pass.firstTransition; i < pass.firstTransition + pass.transitionCount; ++i)
+		{
+			const ResourceTransition& transition = compiled.transitions[i];
+			if (transition.handle == handle && transition.before == before && transition.after == after)
+				return true;
+		}
+		return false;
+	}
+}  // namespace
+
+// ============================================================================
+// Culling
+// ============================================================================
+
+TEST_CASE(FrameGraphCompiler_CullsPassesNobodyConsumes)
+{
+	std::vector<PassDeclaration> passes(3);
+	passes[0].accesses = {Write(kTransientA, ResourceState::RenderTarget)};  // Never read
+	passes[1].accesses = {Write(kTransientB, ResourceState::RenderTarget)};
+	passes[2].accesses = {Read(kTransientB, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+
+	EXPECT_EQ(ScheduledPasses(compiled), (std::vector<std::uint32_t>{1, 2}));
+	EXPECT_EQ(compiled.culledPassCount, 1u);
+	EXPECT(!compiled.lifetimes[kTransientA.index].IsUsed());
+}
+
+TEST_CASE(FrameGraphCompiler_KeepsSideEffectPasses)
+{
+	std::vector<PassDeclaration> passes(2);
+	passes[0].accesses = {Write(kTransientA, ResourceState::UnorderedAccess)};
+	passes[0].bHasSideEffects = true;
+	passes[1].accesses = {Write(kBackBuffer, ResourceState::RenderTarget)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+
+	EXPECT_EQ(ScheduledPasses(compiled), (std::vector<std::uint32_t>{0, 1}));
+	EXPECT_EQ(compiled.culledPassCount, 0u);
+}
+
+TEST_CASE(FrameGraphCompiler_LivenessFollowsProducerChains)
+{
+	// 0 -> 1 -> 2 (back buffer); 3 reads 0's output but writes nothing live
+	std::vector<PassDeclaration> passes(4);
+	passes[0].accesses = {Write(kTransientA, ResourceState::RenderTarget)};
+	passes[1].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kTransientB, ResourceState::RenderTarget)};
+	passes[2].accesses = {Read(kTransientB, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+	passes[3].accesses = {Read(kTransientA, ResourceState::ShaderResource)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+
+	EXPECT_EQ(ScheduledPasses(compiled), (std::vector<std::uint32_t>{0, 1, 2}));
+	EXPECT_EQ(compiled.culledPassCount, 1u);
+}
+
+// ============================================================================
+// Ordering
+// ============================================================================
+
+TEST_CASE(FrameGraphCompiler_IndependentPassesKeepDeclarationOrder)
+{
+	std::vector<PassDeclaration> passes(3);
+	passes[0].accesses = {Write(kTransientA, ResourceState::UnorderedAccess)};
+	passes[0].bHasSideEffects = true;
+	passes[1].accesses = {Write(kTransientB, ResourceState::UnorderedAccess)};
+	passes[1].bHasSideEffects = true;
+	passes[2].accesses = {Write(kDepth, ResourceState::DepthWrite)};
+	passes[2].bHasSideEffects = true;
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+
+	EXPECT_EQ(ScheduledPasses(compiled), (std::vector<std::uint32_t>{0, 1, 2}));
+	EXPECT_EQ(compiled.edgeCount, 0u);
+}
+
+TEST_CASE(FrameGraphCompiler_EdgesFollowDeclarationOrderPerResource)
+{
+	// RAW 0->1, WAR 1->2, WAW 0->2, RAW 2->3
+	std::vector<PassDeclaration> passes(4);
+	passes[0].accesses = {Write(kTransientA, ResourceState::RenderTarget)};
+	passes[1].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+	passes[2].accesses = {Write(kTransientA, ResourceState::RenderTarget)};
+	passes[3].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+
+	EXPECT_EQ(ScheduledPasses(compiled), (std::vector<std::uint32_t>{0, 1, 2, 3}));
+	// Plus WAW 1->3 on the back buffer
+	EXPECT_EQ(compiled.edgeCount, 5u);
+	EXPECT_EQ(compiled.lifetimes[kTransientA.index].firstPass, 0u);
+	EXPECT_EQ(compiled.lifetimes[kTransientA.index].lastPass, 3u);
+}
+
+// ============================================================================
+// Transitions
+// ============================================================================
+
+TEST_CASE(FrameGraphCompiler_EmitsTransitionsOnlyOnStateChange)
+{
+	std::vector<PassDeclaration> passes(3);
+	passes[0].accesses = {Write(kTransientA, ResourceState::RenderTarget), Write(kDepth, ResourceState::DepthWrite)};
+	passes[1].accesses = {Write(kTransientA, ResourceState::RenderTarget), Read(kDepth, ResourceState::DepthRead)};
+	passes[2].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+	REQUIRE(compiled.passes.size() == 3);
+
+	// Depth starts in DepthWrite: nothing to do for pass 0
+	EXPECT_EQ(compiled.passes[0].transitionCount, 1u);
+	EXPECT(HasTransition(compiled, compiled.passes[0], kTransientA, ResourceState::Common, ResourceState::RenderTarget));
+
+	EXPECT_EQ(compiled.passes[1].transitionCount, 1u);
+	EXPECT(HasTransition(compiled, compiled.passes[1], kDepth, ResourceState::DepthWrite, ResourceState::DepthRead));
+
+	EXPECT_EQ(compiled.passes[2].transitionCount, 2u);
+	EXPECT(HasTransition(compiled, compiled.passes[2], kTransientA, ResourceState::RenderTarget, ResourceState::ShaderResource));
+	EXPECT(HasTransition(compiled, compiled.passes[2], kBackBuffer, ResourceState::Present, ResourceState::RenderTarget));
+
+	// Imported resources go back to their final state; transients do not
+	REQUIRE(compiled.finalTransitions.size() == 2);
+	EXPECT(compiled.finalTransitions[0].handle == kBackBuffer);
+	EXPECT(compiled.finalTransitions[0].after == ResourceState::Present);
+	EXPECT(compiled.finalTransitions[1].handle == kDepth);
+	EXPECT(compiled.finalTransitions[1].after == ResourceState::DepthWrite);
+}
+
+TEST_CASE(FrameGraphCompiler_WriteStateWinsWithinAPass)
+{
+	std::vector<PassDeclaration> passes(1);
+	passes[0].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kTransientA, ResourceState::UnorderedAccess)};
+	passes[0].bHasSideEffects = true;
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph compiled;
+	compiler.Compile(passes, MakeResources(), compiled);
+	REQUIRE(compiled.passes.size() == 1);
+
+	EXPECT_EQ(compiled.passes[0].transitionCount, 1u);
+	EXPECT(HasTransition(compiled, compiled.passes[0], kTransientA, ResourceState::Common, ResourceState::UnorderedAccess));
+	EXPECT_EQ(compiled.stateConflicts, 1u);
+}
+
+TEST_CASE(FrameGraphCompiler_RecompileReusesScratch)
+{
+	std::vector<PassDeclaration> passes(2);
+	passes[0].accesses = {Write(kTransientA, ResourceState::RenderTarget)};
+	passes[1].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+
+	FrameGraphCompiler compiler;
+	CompiledFrameGraph first;
+	CompiledFrameGraph second;
+	compiler.Compile(passes, MakeResources(), first);
+	compiler.Compile(passes, MakeResources(), second);
+
+	EXPECT_EQ(ScheduledPasses(first), ScheduledPasses(second));
+	EXPECT_EQ(first.transitions.size(), second.transitions.size());
+	EXPECT_EQ(first.edgeCount, second.edgeCount);
+}
+
+// ============================================================================
+// Declaration Hash (compile cache key)
+// ============================================================================
+
+namespace
+{
+	// Shadow -> lighting -> back buffer, one transient each
+	std::vector<PassDeclaration> MakeDeferredDeclarations()
+	{
+		std::vector<PassDeclaration> passes(3);
+		passes[0].accesses = {Write(kTransientA, ResourceState::DepthWrite)};
+		passes[1].accesses = {Read(kTransientA, ResourceState::ShaderResource), Write(kTransientB, ResourceState::RenderTarget)};
+		passes[2].accesses = {Read(kTransientB, ResourceState::ShaderResource), Write(kBackBuffer, ResourceState::RenderTarget)};
+		return passes;
+	}
+
+	std::vector<TransientTextureDesc> MakeTransients()
+	{
+		return {{1024, 1024, RHITextureFormat::R32_Float, "Shadow"}, {1280, 720, RHITextureFormat::RGBA8_UNorm, "Lighting"}};
+	}
+
+	std::uint64_t HashOf(const std::vector<PassDeclaration>& passes, const std::vector<FrameGraphResourceInfo>& resources, const std::vector<TransientTextureDesc>& transients)
+	{
+		return HashFrameGraphDeclarations(passes, resources, transients, 0);
+	}
+}  // namespace
+
+TEST_CASE(FrameGraphHash_IdenticalDeclarationsHit)
+{
+	// Rebuilt from scratch each frame, like PassBuilder does
+	const std::uint64_t first = HashOf(MakeDeferredDeclarations(), MakeResources(), MakeTransients());
+	const std::uint64_t second = HashOf(MakeDeferredDeclarations(), MakeResources(), MakeTransients());
+	EXPECT_EQ(first, second);
+
+	// Debug names are not part of the plan
+	std::vector<TransientTextureDesc> renamed = MakeTransients();
+	renamed[0].debugName = "ShadowMap";
+	EXPECT_EQ(HashOf(MakeDeferredDeclarations(), MakeResources(), renamed), first);
+}
+
+TEST_CASE(FrameGraphHash_ChangedAccessStateMisses)
+{
+	const std::uint64_t baseline = HashOf(MakeDeferredDeclarations(), MakeResources(), MakeTransients());
+
+	std::vector<PassDeclaration> passes = MakeDeferredDeclarations();
+	passes[1].accesses[0].state = ResourceState::DepthRead;
+	EXPECT_NE(HashOf(passes, MakeResources(), MakeTransients()), baseline);
+}
+
+TEST_CASE(FrameGraphHash_ChangedEdgeMisses)
+{
+	const std::uint64_t baseline = HashOf(MakeDeferredDeclarations(), MakeResources(), MakeTransients());
+
+	// Lighting also samples the shadow map in the final pass: one new RAW edge
+	std::vector<PassDeclaration> extraRead = MakeDeferredDeclarations();
+	extraRead[2].accesses.push_back(Read(kTransientA, ResourceState::ShaderResource));
+	EXPECT_NE(HashOf(extraRead, MakeResources(), MakeTransients()), baseline);
+
+	// Same accesses, but the final pass reads A instead of B
+	std::vector<PassDeclaration> rewired = MakeDeferredDeclarations();
+	rewired[2].accesses[0].handle = kTransientA;
+	EXPECT_NE(HashOf(rewired, MakeResources(), MakeTransients()), baseline);
+
+	// A read turned into a write flips RAW into WAW
+	std::vector<PassDeclaration> written = MakeDeferredDeclarations();
+	written[1].accesses[0].bWrite = true;
+	EXPECT_NE(HashOf(written, MakeResources(), MakeTransients()), baseline);
+}
+
+TEST_CASE(FrameGraphHash_ChangedResourceMisses)
+{
+	const std::uint64_t baseline = HashOf(MakeDeferredDeclarations(), MakeResources(), MakeTransients());
+
+	std::vector<FrameGraphResourceInfo> resources = MakeResources();
+	resources[ResourceHandle::DEPTH_BUFFER_INDEX].finalState = ResourceState::DepthRead;
+	EXPECT_NE(HashOf(MakeDeferredDeclarations(), resources, MakeTransients()), baseline);
+
+	std::vector<FrameGraphResourceInfo> output = MakeResources();
+	output[kTransientB.index].bOutput = true;
+	EXPECT_NE(HashOf(MakeDeferredDeclarations(), output, MakeTransients()), baseline);
+
+	// Resize: one transient changes size
+	std::vector<TransientTextureDesc> resized = MakeTransients();
+	resized[1].width = 1920;
+	EXPECT_NE(HashOf(MakeDeferredDeclarations(), MakeResources(), resized), baseline);
+
+	std::vector<TransientTextureDesc> reformatted = MakeTransients();
+	reformatted[1].format = RHITextureFormat::RGBA16_Float;
+	EXPECT_NE(HashOf(MakeDeferredDeclarations(), MakeResources(), reformatted), baseline);
+}
+
+TEST_CASE(FrameGraphHash_SeedSeparatesPassSetsAndEpochs)
+{
+	const std::vector<PassDeclaration> passes = MakeDeferredDeclarations();
+	const std::vector<FrameGraphResourceInfo> resources = MakeResources();
+	const std::vector<TransientTextureDesc> transients = MakeTransients();
+	EXPECT_NE(HashFrameGraphDeclarations(passes, resources, transients, 1), HashFrameGraphDeclarations(passes, resources, transients, 2));
+}
@@ -0,0 +1,259 @@
+// ============================================================================
+// FrameRecordingTests.cpp
+// A frame recorded end to end on the Null RHI: FrameGraph setup, compile and
+// pass recording (serial and split across worker lists) for ForwardOpaquePass.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/FrameGraph/FrameGraph.h"
+#include "Renderer/Public/Passes/ForwardOpaquePass.h"
+#include "Renderer/Public/RenderContext.h"
+#include "Renderer/Public/SceneData/SceneView.h"
+#include "Renderer/Public/GPU/GPUMeshCache.h"
+#include "Renderer/Public/GPU/GPUMaterialTable.h"
+#include "Renderer/Public/GPU/GPUUploadQueue.h"
+#include "D3D12/Resources/D3D12ConstantBufferData.h"
+#include "Null/NullRhi.h"
+
+#include <vector>
+
+namespace
+{
+	constexpr std::uint64_t kRingSize = 16ull * 1024ull * 1024ull;
+	constexpr std::uint32_t kFrame = 0;
+
+	// Stand-ins for backend objects: the Null RHI only checks they are set
+	int g_rootSignature = 0;
+	int g_pipelineState = 0;
+	int g_resourceHeap = 0;
+	int g_backBuffer = 0;
+	int g_depthBuffer = 0;
+
+	// One triangle whose content (and so content hash) depends on seed
+	MeshGeometryHandle MakeGeometry(std::uint32_t seed)
+	{
+		MeshData meshData;
+		meshData.vertices.resize(3);
+		meshData.indices = {0, 1, 2};
+		for (std::uint32_t i = 0; i < 3; ++i)
+		{
+			meshData.vertices[i].position = {static_cast<float>(seed), static_cast<float>(i), 0.0f};
+		}
+		return MakeMeshGeometry(std::move(meshData));
+	}
+
+	// A scene of batchCount geometries, batch i drawn 1 + i % 3 times, recorded
+	// through a frame graph holding one ForwardOpaquePass
+	struct FrameFixture
+	{
+		NullRhi rhi;
+		GPUUploadQueue uploads{rhi, kRingSize};
+		GPUMeshCache meshCache{rhi, uploads};
+		GPUMaterialTable materials;
+		FrameGraph frameGraph;
+		ForwardOpaquePass* pass = nullptr;
+
+		std::vector<MeshGeometryHandle> geometries;
+		std::vector<DirectX::XMFLOAT4X4> worlds;
+		std::vector<DirectX::XMFLOAT3X4> worldInvTransposes;
+		SceneView view;
+
+		explicit FrameFixture(std::uint32_t batchCount)
+		{
+			for (std::uint32_t batch = 0; batch < batchCount; ++batch)
+			{
+				geometries.push_back(MakeGeometry(batch));
+				const GPUMeshHandle handle = meshCache.Register(geometries.back());
+				for (std::uint32_t instance = 0; instance < 1 + batch % 3; ++instance)
+				{
+					MeshDraw draw;
+					draw.objectId = static_cast<std::uint32_t>(worlds.size());
+					draw.geometry = geometries.back().get();
+					draw.meshHandle = handle;
+					view.meshDraws.push_back(draw);
+					worlds.push_back({});
+				}
+			}
+			worldInvTransposes.resize(worlds.size());
+
+			view.width = 1280;
+			view.height = 720;
+			view.objectWorlds = worlds;
+			view.objectWorldInvTransposes = worldInvTransposes;
+			view.bAllObjectsChanged = true;
+
+			materials.Build({});
+			pass = &frameGraph.AddPass<ForwardOpaquePass>("ForwardOpaque", rhi, meshCache, materials);
+			rhi.SetSubmissionLogging(true);
+		}
+
+		// Renderer::RecordFrame and SubmitFrame, with fake backend objects
+		void RecordFrame(std::uint32_t maxThreads)
+		{
+			rhi.ResetCommandAllocator(kFrame);
+			rhi.ResetCommandList(kFrame);
+			uploads.BeginFrame();
+			meshCache.BeginFrame();
+			materials.Sync(rhi, kFrame);
+
+			ForwardOpaqueBindings bindings;
+			bindings.rootSignature = RHINativeObject{&g_rootSignature};
+			bindings.pipelineState = RHINativeObject{&g_pipelineState};
+			bindings.renderTarget = RHICpuDescriptor{1};
+			bindings.depthStencil = RHICpuDescriptor{2};
+			bindings.width = view.width;
+			bindings.height = view.height;
+			bindings.perFrameConstants = 0x1000;
+			bindings.perViewConstants = 0x2000;
+			bindings.resourceHeap = RHINativeObject{&g_resourceHeap};
+			bindings.textureTable = RHIGpuDescriptor{3};
+			bindings.frameInFlightIndex = kFrame;
+			pass->SetBindings(bindings);
+
+			frameGraph.SetImportedResource(ResourceHandle::BackBuffer(), RHINativeObject{&g_backBuffer});
+			frameGraph.SetImportedResource(ResourceHandle::DepthBuffer(), RHINativeObject{&g_depthBuffer});
+			frameGraph.Setup(view);
+			frameGraph.Compile();
+
+			RenderContext context(rhi.GetRHICommandList(kFrame));
+			frameGraph.ExecuteParallel(context, rhi, kFrame, maxThreads);
+
+			rhi.CloseCommandList(kFrame);
+			rhi.ExecuteCommandList(kFrame);
+			rhi.Signal(kFrame);
+			uploads.EndFrame(rhi.GetFenceValueForFrame(kFrame));
+		}
+	};
+}  // namespace
+
+// ============================================================================
+// Serial Recording
+// ============================================================================
+
+TEST_CASE(FrameRecording_SerialFrameDrawsEveryBatchOnTheFrameList)
+{
+	FrameFixture fixture(16);
+	fixture.RecordFrame(1);
+
+	const InstanceBatchStats& batches = fixture.pass->GetBatchStats();
+	EXPECT_EQ(batches.instanceCount, static_cast<std::uint32_t>(fixture.view.meshDraws.size()));
+	EXPECT_EQ(fixture.frameGraph.GetRecordStats().jobs, 1u);
+
+	// One submission: the frame list carries uploads, transitions and draws
+	const auto log = fixture.rhi.GetSubmissionLog();
+	REQUIRE(log.size() == 1);
+	EXPECT(!log[0].bWorker);
+	EXPECT_EQ(log[0].stats.drawCalls, static_cast<std::uint64_t>(batches.batchCount));
+	EXPECT_EQ(log[0].stats.instances, static_cast<std::uint64_t>(batches.instanceCount));
+	EXPECT_EQ(log[0].stats.clears, 2u);
+	EXPECT(log[0].stats.copies > 0);
+	EXPECT(log[0].stats.barriers > 0);
+	EXPECT_EQ(fixture.rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(FrameRecording_EmptyDrawListStillSyncsObjectData)
+{
+	// Every object culled: no batches, but the object buffer is still current
+	FrameFixture fixture(4);
+	fixture.view.meshDraws.clear();
+	fixture.RecordFrame(4);
+
+	EXPECT_EQ(fixture.frameGraph.GetRecordStats().jobs, 1u);
+	EXPECT_EQ(fixture.pass->GetDrawStats().objectBytesUploaded, fixture.worlds.size() * sizeof(PerObjectData));
+
+	const auto log = fixture.rhi.GetSubmissionLog();
+	REQUIRE(log.size() == 1);
+	EXPECT_EQ(log[0].stats.drawCalls, 0u);
+	EXPECT_EQ(log[0].stats.clears, 2u);
+	EXPECT_EQ(fixture.rhi.GetValidationErrorCount(), 0u);
+}
+
+// ============================================================================
+// Parallel Recording
+// ============================================================================
+
+TEST_CASE(FrameRecording_WorkerListsSubmitInRangeOrder)
+{
+	FrameFixture fixture(3 * ForwardOpaquePass::kMinBatchesPerRange);
+	fixture.RecordFrame(4);
+
+	const InstanceBatchStats& batches = fixture.pass->GetBatchStats();
+	const std::uint32_t jobs = fixture.frameGraph.GetRecordStats().jobs;
+	REQUIRE(jobs >= 2);
+	EXPECT_EQ(jobs, batches.batchCount / ForwardOpaquePass::kMinBatchesPerRange);
+
+	// Frame list (uploads) first, then worker 0..n-1, then the frame list again
+	// with what the context recorded after the passes
+	const auto log = fixture.rhi.GetSubmissionLog();
+	REQUIRE(log.size() == jobs + 2);
+	EXPECT(!log[0].bWorker);
+	EXPECT(log[0].stats.copies > 0);
+	EXPECT_EQ(log[0].stats.drawCalls, 0u);
+	EXPECT(!log[jobs + 1].bWorker);
+	EXPECT_EQ(log[jobs + 1].stats.drawCalls, 0u);
+
+	std::uint64_t drawCalls = 0;
+	std::uint64_t instances = 0;
+	for (std::uint32_t job = 0; job < jobs; ++job)
+	{
+		const NullSubmission& submission = log[1 + job];
+		EXPECT(submission.bWorker);
+		EXPECT_EQ(submission.worker, job);
+
+		// Contiguous ranges; only the first clears and carries the pass's transitions
+		const std::uint64_t first = static_cast<std::uint64_t>(batches.batchCount) * job / jobs;
+		const std::uint64_t end = static_cast<std::uint64_t>(batches.batchCount) * (job + 1) / jobs;
+		EXPECT_EQ(submission.stats.drawCalls, end - first);
+		EXPECT(submission.stats.instances >= submission.stats.drawCalls);
+		EXPECT_EQ(submission.stats.clears, job == 0 ? 2u : 0u);
+		EXPECT_EQ(submission.stats.copies, 0u);
+		if (job > 0)
+		{
+			EXPECT_EQ(submission.stats.barriers, 0u);
+		}
+		drawCalls += submission.stats.drawCalls;
+		instances += submission.stats.instances;
+	}
+	EXPECT(log[1].stats.barriers > 0);
+	EXPECT_EQ(drawCalls, static_cast<std::uint64_t>(batches.batchCount));
+	EXPECT_EQ(instances, static_cast<std::uint64_t>(batches.instanceCount));
+	EXPECT_EQ(fixture.rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(FrameRecording_RangeCountFollowsMinBatchesPerRange)
+{
+	// One batch short of two ranges records serially on the frame list
+	{
+		FrameFixture fixture(2 * ForwardOpaquePass::kMinBatchesPerRange - 1);
+		fixture.RecordFrame(4);
+		EXPECT_EQ(fixture.frameGraph.GetRecordStats().jobs, 1u);
+		EXPECT_EQ(fixture.rhi.GetSubmissionLog().size(), 1u);
+	}
+
+	// Two full ranges split onto two worker lists, submitted in range order
+	{
+		FrameFixture fixture(2 * ForwardOpaquePass::kMinBatchesPerRange);
+		fixture.RecordFrame(4);
+		EXPECT_EQ(fixture.frameGraph.GetRecordStats().jobs, 2u);
+
+		const auto log = fixture.rhi.GetSubmissionLog();
+		REQUIRE(log.size() == 4);
+		EXPECT(!log[0].bWorker);
+		EXPECT(log[1].bWorker && log[1].worker == 0);
+		EXPECT(log[2].bWorker && log[2].worker == 1);
+		EXPECT(!log[3].bWorker);
+		EXPECT_EQ(log[1].stats.drawCalls, static_cast<std::uint64_t>(ForwardOpaquePass::kMinBatchesPerRange));
+		EXPECT_EQ(log[2].stats.drawCalls, static_cast<std::uint64_t>(ForwardOpaquePass::kMinBatchesPerRange));
+		EXPECT_EQ(fixture.rhi.GetValidationErrorCount(), 0u);
+	}
+
+	// Never more ranges than worker command lists
+	{
+		FrameFixture fixture(2 * RHIDevice::kMaxWorkerCommandLists * ForwardOpaquePass::kMinBatchesPerRange);
+		fixture.RecordFrame(RHIDevice::kMaxWorkerCommandLists);
+		EXPECT_EQ(fixture.frameGraph.GetRecordStats().jobs, RHIDevice::kMaxWorkerCommandLists);
+		EXPECT_EQ(fixture.rhi.GetSubmissionLog().size(), static_cast<std::size_t>(RHIDevice::kMaxWorkerCommandLists) + 2);
+		EXPECT_EQ(fixture.rhi.GetValidationErrorCount(), 0u);
+	}
+}
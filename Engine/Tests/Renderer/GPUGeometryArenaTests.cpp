@@ -0,0 +1,239 @@
+// ============================================================================
+// GPUGeometryArenaTests.cpp
+// GPUGeometryArena on the Null RHI: page selection, dedicated pages for
+// oversized meshes and ranges returning to their page on Free.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/GPU/GPUGeometryArena.h"
+#include "Renderer/Public/GPU/GPUMesh.h"
+#include "Null/NullRhi.h"
+
+namespace
+{
+	constexpr std::uint64_t kPageSize = 64 * 1024;
+	constexpr std::uint64_t kRingSize = 1024 * 1024;
+
+	// vertexCount vertices (64 bytes each) and as many indices (4 bytes each)
+	MeshGeometryHandle MakeGeometry(std::uint32_t vertexCount)
+	{
+		MeshData meshData;
+		meshData.vertices.resize(vertexCount);
+		meshData.indices.resize(vertexCount);
+		for (std::uint32_t i = 0; i < vertexCount; ++i)
+		{
+			meshData.vertices[i].position = {static_cast<float>(i), 0.0f, 0.0f};
+			meshData.indices[i] = i;
+		}
+		return MakeMeshGeometry(std::move(meshData));
+	}
+
+	bool RangesOverlap(const GeometryRange& a, const GeometryRange& b)
+	{
+		return a.page == b.page && a.allocation.offset < b.allocation.offset + b.allocation.size &&
+		       b.allocation.offset < a.allocation.offset + a.allocation.size;
+	}
+
+	void RecordFrame(NullRhi& rhi, GPUGeometryArena& arena)
+	{
+		rhi.ResetCommandList(0);
+		arena.RecordUploads(rhi.GetRHICommandList(0));
+		rhi.CloseCommandList(0);
+	}
+}  // namespace
+
+// ============================================================================
+// Page Selection
+// ============================================================================
+
+TEST_CASE(GeometryArena_SmallMeshesShareOnePage)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	GPUMesh first;
+	GPUMesh second;
+	REQUIRE(arena.Upload(MakeGeometry(100), first) == GeometryUploadResult::Uploaded);
+	REQUIRE(arena.Upload(MakeGeometry(50), second) == GeometryUploadResult::Uploaded);
+
+	// Vertex and index ranges of both meshes sit in page 0 without overlapping
+	const GeometryRange ranges[] = {first.GetVertexRange(), first.GetIndexRange(), second.GetVertexRange(), second.GetIndexRange()};
+	for (std::size_t i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(ranges[i].page, 0u);
+		EXPECT_EQ(ranges[i].allocation.offset % GPUGeometryArena::kRangeAlignment, 0u);
+		for (std::size_t j = i + 1; j < 4; ++j)
+		{
+			EXPECT(!RangesOverlap(ranges[i], ranges[j]));
+		}
+	}
+
+	// Both views point into the same page buffer
+	EXPECT(rhi.IsAddressRangeValid(first.GetVertexBufferView().address, first.GetVertexBufferView().sizeInBytes));
+	EXPECT(rhi.IsAddressRangeValid(second.GetIndexBufferView().address, second.GetIndexBufferView().sizeInBytes));
+	EXPECT_EQ(first.GetVertexBufferView().strideInBytes, sizeof(VertexData));
+	EXPECT_EQ(first.GetIndexCount(), 100u);
+
+	const GeometryArenaStats stats = arena.GetStats();
+	EXPECT_EQ(stats.pageCount, 1u);
+	EXPECT_EQ(stats.reservedBytes, kPageSize);
+	EXPECT_EQ(stats.allocationCount, 4u);
+	EXPECT_EQ(stats.allocatedBytes, first.GetSizeInBytes() + second.GetSizeInBytes());
+
+	RecordFrame(rhi, arena);
+	EXPECT_EQ(arena.GetStats().uploadedMeshes, 2u);
+	EXPECT_EQ(arena.GetStats().uploadedBytes, 150u * (sizeof(VertexData) + sizeof(std::uint32_t)));
+	EXPECT_EQ(rhi.GetCommandStats(0).copies, 4u);
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(GeometryArena_FullPageOpensANewOneAndFreedSpaceIsReused)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	// 800 vertices = 50 KB of vertices: a second one no longer fits page 0
+	GPUMesh first;
+	GPUMesh second;
+	REQUIRE(arena.Upload(MakeGeometry(800), first) == GeometryUploadResult::Uploaded);
+	REQUIRE(arena.Upload(MakeGeometry(800), second) == GeometryUploadResult::Uploaded);
+	EXPECT_EQ(first.GetVertexRange().page, 0u);
+	EXPECT_EQ(second.GetVertexRange().page, 1u);
+	EXPECT_EQ(arena.GetStats().pageCount, 2u);
+
+	// Pages are tried in order: once page 0 has room again, it wins
+	arena.Free(first);
+	GPUMesh third;
+	REQUIRE(arena.Upload(MakeGeometry(800), third) == GeometryUploadResult::Uploaded);
+	EXPECT_EQ(third.GetVertexRange().page, 0u);
+	EXPECT_EQ(arena.GetStats().pageCount, 2u);
+}
+
+// ============================================================================
+// Dedicated Pages
+// ============================================================================
+
+TEST_CASE(GeometryArena_OversizedMeshGetsADedicatedPage)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	// 2000 vertices = 125 KB of vertices (> page), 8 KB of indices (< page)
+	GPUMesh large;
+	REQUIRE(arena.Upload(MakeGeometry(2000), large) == GeometryUploadResult::Uploaded);
+	const std::uint32_t dedicatedPage = large.GetVertexRange().page;
+	EXPECT_NE(dedicatedPage, large.GetIndexRange().page);
+
+	const std::uint64_t vertexBytes = 2000u * sizeof(VertexData);
+	EXPECT_EQ(arena.GetStats().pageCount, 2u);
+	EXPECT_EQ(arena.GetStats().reservedBytes, kPageSize + vertexBytes);
+
+	// Small meshes never go into the dedicated page, even with room left
+	GPUMesh small;
+	REQUIRE(arena.Upload(MakeGeometry(10), small) == GeometryUploadResult::Uploaded);
+	EXPECT_NE(small.GetVertexRange().page, dedicatedPage);
+	EXPECT_NE(small.GetIndexRange().page, dedicatedPage);
+}
+
+TEST_CASE(GeometryArena_EmptyDedicatedPageIsReleasedAndItsSlotReused)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	GPUMesh large;
+	REQUIRE(arena.Upload(MakeGeometry(2000), large) == GeometryUploadResult::Uploaded);
+	const std::uint32_t dedicatedPage = large.GetVertexRange().page;
+	const std::uint64_t buffersLive = rhi.GetDeviceStats().buffersLive;
+
+	arena.Free(large);
+	EXPECT(!large.IsValid());
+	EXPECT_EQ(arena.GetStats().pageCount, 1u);
+	EXPECT_EQ(arena.GetStats().reservedBytes, kPageSize);
+	EXPECT_EQ(rhi.GetDeviceStats().buffersLive, buffersLive - 1);
+
+	GPUMesh again;
+	REQUIRE(arena.Upload(MakeGeometry(3000), again) == GeometryUploadResult::Uploaded);
+	EXPECT_EQ(again.GetVertexRange().page, dedicatedPage);
+	EXPECT_EQ(arena.GetStats().reservedBytes, kPageSize + 3000u * sizeof(VertexData));
+}
+
+// ============================================================================
+// Free
+// ============================================================================
+
+TEST_CASE(GeometryArena_FreeReturnsRangesToTheirPage)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	GPUMesh meshes[3];
+	for (GPUMesh& mesh : meshes)
+	{
+		REQUIRE(arena.Upload(MakeGeometry(64), mesh) == GeometryUploadResult::Uploaded);
+	}
+
+	// Freeing the middle mesh leaves a hole; freeing the rest merges it back
+	arena.Free(meshes[1]);
+	EXPECT_EQ(arena.GetStats().allocationCount, 4u);
+	EXPECT_EQ(arena.GetStats().freeRangeCount, 2u);
+
+	arena.Free(meshes[0]);
+	arena.Free(meshes[2]);
+	const GeometryArenaStats stats = arena.GetStats();
+	EXPECT_EQ(stats.allocatedBytes, 0u);
+	EXPECT_EQ(stats.allocationCount, 0u);
+	EXPECT_EQ(stats.freeRangeCount, 1u);
+	EXPECT_EQ(stats.largestFreeRange, kPageSize);
+
+	// Shared pages stay reserved for the next meshes
+	EXPECT_EQ(stats.pageCount, 1u);
+
+	// Freeing an empty mesh is a no-op
+	arena.Free(meshes[0]);
+	EXPECT_EQ(arena.GetStats().allocationCount, 0u);
+}
+
+// ============================================================================
+// Upload Failures
+// ============================================================================
+
+TEST_CASE(GeometryArena_FullUploadRingDefersWithoutHoldingRanges)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, 8 * 1024);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	// 80 vertices stage 5 KB: the second one does not fit the 8 KB ring this frame
+	GPUMesh first;
+	GPUMesh second;
+	REQUIRE(arena.Upload(MakeGeometry(80), first) == GeometryUploadResult::Uploaded);
+	EXPECT(arena.Upload(MakeGeometry(80), second) == GeometryUploadResult::Deferred);
+	EXPECT(!second.IsValid());
+	EXPECT_EQ(arena.GetStats().allocationCount, 2u);
+	EXPECT_EQ(arena.GetStats().deferredUploads, 1u);
+
+	// Next frame, once the first batch retired, the retry goes through
+	RecordFrame(rhi, arena);
+	rhi.Signal(0);
+	uploads.EndFrame(rhi.GetFenceValueForFrame(0));
+	uploads.BeginFrame();
+	EXPECT(arena.Upload(MakeGeometry(80), second) == GeometryUploadResult::Uploaded);
+}
+
+TEST_CASE(GeometryArena_InvalidGeometryFails)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUGeometryArena arena(rhi, uploads, kPageSize);
+
+	GPUMesh mesh;
+	EXPECT(arena.Upload(nullptr, mesh) == GeometryUploadResult::Failed);
+	EXPECT(arena.Upload(MakeMeshGeometry(MeshData{}), mesh) == GeometryUploadResult::Failed);
+	EXPECT_EQ(arena.GetStats().pageCount, 0u);
+}
@@ -0,0 +1,144 @@
+// ============================================================================
+// GPUMeshCacheTests.cpp
+// GPUMeshCache on the Null RHI: content-hash reuse across mesh lists (level
+// switches and reloads) and the reuse hit/miss counters.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/GPU/GPUMeshCache.h"
+#include "Null/NullRhi.h"
+
+#include <vector>
+
+namespace
+{
+	constexpr std::uint64_t kRingSize = 1024 * 1024;
+
+	// Content is a function of vertexCount: equal counts hash equal
+	MeshGeometryHandle MakeGeometry(std::uint32_t vertexCount)
+	{
+		MeshData meshData;
+		meshData.vertices.resize(vertexCount);
+		meshData.indices.resize(vertexCount);
+		for (std::uint32_t i = 0; i < vertexCount; ++i)
+		{
+			meshData.vertices[i].position = {static_cast<float>(i), 0.0f, 0.0f};
+			meshData.indices[i] = i;
+		}
+		return MakeMeshGeometry(std::move(meshData));
+	}
+
+	// Registers a mesh list the way the renderer does on a level load
+	std::vector<GPUMeshHandle> LoadLevel(GPUMeshCache& cache, const std::vector<MeshGeometryHandle>& meshes)
+	{
+		std::vector<GPUMeshHandle> handles;
+		for (const MeshGeometryHandle& mesh : meshes)
+		{
+			handles.push_back(cache.Register(mesh));
+		}
+		cache.ReleaseUnreferenced();
+		return handles;
+	}
+
+	void DrawFrame(NullRhi& rhi, GPUMeshCache& cache, const std::vector<GPUMeshHandle>& handles)
+	{
+		cache.BeginFrame();
+		for (const GPUMeshHandle handle : handles)
+		{
+			REQUIRE(cache.Acquire(handle) != nullptr);
+		}
+		rhi.ResetCommandList(0);
+		cache.RecordUploads(rhi.GetRHICommandList(0));
+		rhi.CloseCommandList(0);
+	}
+}  // namespace
+
+// ============================================================================
+// Level Loads
+// ============================================================================
+
+TEST_CASE(MeshCache_FirstLoadMissesOncePerContent)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUMeshCache cache(rhi, uploads);
+
+	// Two instances of one geometry share a slot and count as one miss
+	const auto handles = LoadLevel(cache, {MakeGeometry(100), MakeGeometry(100), MakeGeometry(50)});
+	EXPECT(handles[0] == handles[1]);
+	EXPECT_EQ(cache.GetStats().reuseMisses, 2u);
+	EXPECT_EQ(cache.GetStats().reusedMeshes, 0u);
+
+	DrawFrame(rhi, cache, handles);
+	EXPECT_EQ(cache.GetStats().misses, 2u);
+	EXPECT_EQ(cache.GetStats().residentCount, 2u);
+}
+
+TEST_CASE(MeshCache_LevelSwitchReusesSharedContent)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUMeshCache cache(rhi, uploads);
+
+	DrawFrame(rhi, cache, LoadLevel(cache, {MakeGeometry(100), MakeGeometry(50)}));
+	const GPUMeshCacheStats before = cache.GetStats();
+
+	// The next level loads its own copy of one mesh plus a new one
+	const auto handles = LoadLevel(cache, {MakeGeometry(100), MakeGeometry(70)});
+	const GPUMeshCacheStats& stats = cache.GetStats();
+	EXPECT_EQ(stats.reusedMeshes - before.reusedMeshes, 1u);
+	EXPECT_EQ(stats.reuseMisses - before.reuseMisses, 1u);
+	EXPECT_EQ(stats.uploadBytesAvoided, 100u * (sizeof(VertexData) + sizeof(std::uint32_t)));
+	EXPECT(cache.IsResident(handles[0]));
+
+	// The dropped mesh stays resident for a later level; only the new one uploads
+	EXPECT_EQ(stats.registeredCount, 2u);
+	EXPECT_EQ(stats.retainedCount, 1u);
+	DrawFrame(rhi, cache, handles);
+	EXPECT_EQ(cache.GetStats().misses - before.misses, 1u);
+}
+
+TEST_CASE(MeshCache_ReloadRevivesRetainedMeshes)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUMeshCache cache(rhi, uploads);
+
+	DrawFrame(rhi, cache, LoadLevel(cache, {MakeGeometry(100), MakeGeometry(50)}));
+	DrawFrame(rhi, cache, LoadLevel(cache, {MakeGeometry(30)}));
+	EXPECT_EQ(cache.GetStats().retainedCount, 2u);
+
+	// Back to the first level: everything it needs is still resident
+	const GPUMeshCacheStats before = cache.GetStats();
+	const auto handles = LoadLevel(cache, {MakeGeometry(100), MakeGeometry(50)});
+	EXPECT_EQ(cache.GetStats().reusedMeshes - before.reusedMeshes, 2u);
+	EXPECT_EQ(cache.GetStats().reuseMisses - before.reuseMisses, 0u);
+
+	DrawFrame(rhi, cache, handles);
+	EXPECT_EQ(cache.GetStats().misses, before.misses);
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(MeshCache_EvictedContentCountsAsAMiss)
+{
+	NullRhi rhi;
+	GPUUploadQueue uploads(rhi, kRingSize);
+	GPUMeshCache cache(rhi, uploads);
+
+	const auto handles = LoadLevel(cache, {MakeGeometry(100)});
+	DrawFrame(rhi, cache, handles);
+
+	// Once no frame in flight uses it, a zero budget evicts it
+	for (std::uint32_t i = 0; i < RHISettings::FramesInFlight; ++i)
+	{
+		cache.BeginFrame();
+	}
+	cache.SetBudget(0);
+	REQUIRE(!cache.IsResident(handles[0]));
+
+	const GPUMeshCacheStats before = cache.GetStats();
+	(void)LoadLevel(cache, {MakeGeometry(100)});
+	EXPECT_EQ(cache.GetStats().reusedMeshes, before.reusedMeshes);
+	EXPECT_EQ(cache.GetStats().reuseMisses - before.reuseMisses, 1u);
+}
@@ -0,0 +1,286 @@
+// ============================================================================
+// GPUUploadQueueTests.cpp
+// GPUUploadQueue on the Null RHI with manual fences standing in for a GPU
+// that lags behind: batching, ring wrap-around and ticket completion.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/GPU/GPUUploadQueue.h"
+#include "Null/NullRhi.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+	// Records the queued copies into frameIndex's list, submits and signals it
+	std::uint64_t SubmitFrame(NullRhi& rhi, GPUUploadQueue& uploads, std::uint32_t frameIndex)
+	{
+		rhi.ResetCommandList(frameIndex);
+		uploads.RecordCopies(rhi.GetRHICommandList(frameIndex));
+		rhi.CloseCommandList(frameIndex);
+		rhi.ExecuteCommandList(frameIndex);
+		rhi.Signal(frameIndex);
+
+		const std::uint64_t fenceValue = rhi.GetFenceValueForFrame(frameIndex);
+		uploads.EndFrame(fenceValue);
+		return fenceValue;
+	}
+
+	std::vector<std::byte> MakePayload(std::size_t size, std::uint8_t seed)
+	{
+		std::vector<std::byte> payload(size);
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			payload[i] = static_cast<std::byte>(seed + i);
+		}
+		return payload;
+	}
+}  // namespace
+
+// ============================================================================
+// Batching
+// ============================================================================
+
+TEST_CASE(UploadQueue_CopiesAreRecordedWithBarriersPerDestination)
+{
+	NullRhi rhi;
+	RHIBuffer first(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"First"});
+	RHIBuffer second(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"Second"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const std::vector<std::byte> payload = MakePayload(64, 1);
+	const RHINativeObject firstNative = rhi.GetNativeBuffer(first.GetHandle());
+	const UploadTicket a = uploads.UploadBuffer(firstNative, 0, payload.data(), 64);
+	const UploadTicket b = uploads.UploadBuffer(firstNative, 64, payload.data(), 64);
+	const UploadTicket c = uploads.UploadBuffer(rhi.GetNativeBuffer(second.GetHandle()), 0, payload.data(), 64);
+	REQUIRE(c.IsValid());
+
+	// One batch per frame: every upload of the frame shares its ticket
+	EXPECT_EQ(a.batch, b.batch);
+	EXPECT_EQ(a.batch, c.batch);
+	EXPECT(uploads.HasQueuedCopies());
+
+	SubmitFrame(rhi, uploads, 0);
+	EXPECT(!uploads.HasQueuedCopies());
+	EXPECT_EQ(uploads.GetStats().copiesRecorded, 3u);
+	EXPECT_EQ(uploads.GetStats().bytesRecorded, 192u);
+
+	const NullCommandStats& stats = rhi.GetCommandStats(0);
+	EXPECT_EQ(stats.copies, 3u);
+	EXPECT_EQ(stats.barriers, 4u);  // Common -> CopyDest -> Common per buffer
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(UploadQueue_StagingHoldsTheUploadedBytes)
+{
+	NullRhi rhi;
+	RHIBuffer destination(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"Destination"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const UploadAllocation staging = uploads.Allocate(100);
+	REQUIRE(staging.IsValid());
+	EXPECT_EQ(staging.offset % GPUUploadQueue::kStagingAlignment, 0u);
+
+	const std::vector<std::byte> payload = MakePayload(100, 7);
+	std::memcpy(staging.data, payload.data(), payload.size());
+	uploads.CopyBuffer(staging, 0, rhi.GetNativeBuffer(destination.GetHandle()), 0, 100);
+
+	// Copies outside the allocation are dropped
+	uploads.CopyBuffer(staging, 50, rhi.GetNativeBuffer(destination.GetHandle()), 0, 100);
+	SubmitFrame(rhi, uploads, 0);
+	EXPECT_EQ(uploads.GetStats().copiesRecorded, 1u);
+	EXPECT_EQ(std::memcmp(staging.data, payload.data(), payload.size()), 0);
+}
+
+// ============================================================================
+// Fence-Tracked Retirement
+// ============================================================================
+
+TEST_CASE(UploadQueue_TicketCompletesWithItsFence)
+{
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	RHIBuffer destination(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"Destination"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const std::vector<std::byte> payload = MakePayload(64, 3);
+	const UploadTicket ticket = uploads.UploadBuffer(rhi.GetNativeBuffer(destination.GetHandle()), 0, payload.data(), 64);
+	REQUIRE(ticket.IsValid());
+
+	// Not submitted yet: Wait must not block on a fence that was never signaled
+	EXPECT(!uploads.IsComplete(ticket));
+	EXPECT(!uploads.Wait(ticket));
+
+	const std::uint64_t fenceValue = SubmitFrame(rhi, uploads, 0);
+	EXPECT(!uploads.IsComplete(ticket));
+	EXPECT_EQ(uploads.GetStats().batchesInFlight, 1u);
+
+	rhi.CompleteFenceValue(fenceValue);
+	EXPECT(uploads.IsComplete(ticket));
+	EXPECT_EQ(uploads.GetStats().batchesInFlight, 0u);
+	EXPECT_EQ(uploads.GetStats().ringUsedBytes, 0u);
+}
+
+TEST_CASE(UploadQueue_WaitAdvancesTheFence)
+{
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	RHIBuffer destination(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"Destination"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const std::vector<std::byte> payload = MakePayload(64, 5);
+	const UploadTicket ticket = uploads.UploadBuffer(rhi.GetNativeBuffer(destination.GetHandle()), 0, payload.data(), 64);
+	const std::uint64_t fenceValue = SubmitFrame(rhi, uploads, 0);
+
+	EXPECT(uploads.Wait(ticket));
+	EXPECT_EQ(rhi.GetCompletedFenceValue(), fenceValue);
+	EXPECT(uploads.IsComplete(ticket));
+}
+
+TEST_CASE(UploadQueue_UnrecordedCopiesKeepTheBatchOpen)
+{
+	NullRhi rhi;
+	RHIBuffer destination(rhi, RHIBufferDesc{256, RHIHeapType::Default, L"Destination"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const std::vector<std::byte> payload = MakePayload(64, 9);
+	const UploadTicket first = uploads.UploadBuffer(rhi.GetNativeBuffer(destination.GetHandle()), 0, payload.data(), 64);
+	uploads.EndFrame(1);
+	EXPECT_EQ(uploads.GetStats().batchesInFlight, 0u);
+
+	// The next upload joins the still-open batch
+	const UploadTicket second = uploads.UploadBuffer(rhi.GetNativeBuffer(destination.GetHandle()), 64, payload.data(), 64);
+	EXPECT_EQ(first.batch, second.batch);
+
+	SubmitFrame(rhi, uploads, 0);
+	EXPECT_EQ(uploads.GetStats().copiesRecorded, 2u);
+	EXPECT(uploads.IsComplete(first));
+}
+
+// ============================================================================
+// Wrap-Around
+// ============================================================================
+
+TEST_CASE(UploadQueue_FullRingRejectsUntilTheGpuCatchesUp)
+{
+	constexpr std::uint64_t kRingSize = 1024;
+	constexpr std::uint64_t kUploadSize = 400;
+
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	RHIBuffer destination(rhi, RHIBufferDesc{4096, RHIHeapType::Default, L"Destination"});
+	const RHINativeObject destinationNative = rhi.GetNativeBuffer(destination.GetHandle());
+	GPUUploadQueue uploads(rhi, kRingSize);
+
+	const std::vector<std::byte> payload = MakePayload(kUploadSize, 11);
+
+	// Two frames fill the ring up to 800 bytes; neither has completed
+	const UploadTicket frame0 = uploads.UploadBuffer(destinationNative, 0, payload.data(), kUploadSize);
+	const std::uint64_t fence0 = SubmitFrame(rhi, uploads, 0);
+	const UploadTicket frame1 = uploads.UploadBuffer(destinationNative, 0, payload.data(), kUploadSize);
+	const std::uint64_t fence1 = SubmitFrame(rhi, uploads, 1);
+	REQUIRE(frame1.IsValid());
+	EXPECT_EQ(uploads.GetStats().ringUsedBytes, 2 * kUploadSize);
+
+	// The third upload must wrap over frame 0's space, which is still in flight
+	uploads.BeginFrame();
+	EXPECT(!uploads.UploadBuffer(destinationNative, 0, payload.data(), kUploadSize).IsValid());
+	EXPECT_EQ(uploads.GetStats().ringFullRejections, 1u);
+
+	// The GPU finishes frame 0: the retry wraps to offset 0
+	rhi.CompleteFenceValue(fence0);
+	uploads.BeginFrame();
+	EXPECT(uploads.IsComplete(frame0));
+	EXPECT(!uploads.IsComplete(frame1));
+
+	const UploadAllocation wrapped = uploads.Allocate(kUploadSize);
+	REQUIRE(wrapped.IsValid());
+	EXPECT_EQ(wrapped.offset, 0u);
+	uploads.CopyBuffer(wrapped, 0, destinationNative, 0, kUploadSize);
+	const std::uint64_t fence2 = SubmitFrame(rhi, uploads, 0);
+
+	rhi.CompleteFenceValue(fence1);
+	rhi.CompleteFenceValue(fence2);
+	uploads.BeginFrame();
+	EXPECT(uploads.IsComplete(wrapped.ticket));
+	EXPECT_EQ(uploads.GetStats().ringUsedBytes, 0u);
+	EXPECT_EQ(rhi.GetValidationErrorCount(), 0u);
+}
+
+TEST_CASE(UploadQueue_SteadyStateWithLaggingFenceNeverStalls)
+{
+	constexpr std::uint64_t kRingSize = 4096;
+	constexpr std::uint64_t kUploadSize = 600;
+	constexpr std::uint32_t kFrames = 64;
+
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	RHIBuffer destination(rhi, RHIBufferDesc{kUploadSize, RHIHeapType::Default, L"Destination"});
+	const RHINativeObject destinationNative = rhi.GetNativeBuffer(destination.GetHandle());
+	GPUUploadQueue uploads(rhi, kRingSize);
+
+	// The GPU finishes a frame two frames after it was submitted, so the
+	// previous frame's batch is always still in flight at BeginFrame
+	const std::vector<std::byte> payload = MakePayload(kUploadSize, 13);
+	std::uint64_t fences[2] = {};
+	std::uint32_t wraps = 0;
+	std::uint64_t lastOffset = 0;
+	for (std::uint32_t frame = 0; frame < kFrames; ++frame)
+	{
+		const std::uint32_t frameIndex = frame % 2;
+		if (fences[frameIndex] != 0)
+		{
+			rhi.CompleteFenceValue(fences[frameIndex]);
+		}
+		uploads.BeginFrame();
+		EXPECT_EQ(uploads.GetStats().batchesInFlight, frame > 0 ? 1u : 0u);
+
+		for (std::uint32_t i = 0; i < 2; ++i)
+		{
+			const UploadAllocation staging = uploads.Allocate(kUploadSize);
+			REQUIRE(staging.IsValid());
+			std::memcpy(staging.data, payload.data(), kUploadSize);
+			uploads.CopyBuffer(staging, 0, destinationNative, 0, kUploadSize);
+
+			wraps += staging.offset < lastOffset ? 1 : 0;
+			lastOffset = staging.offset;
+		}
+
+		fences[frameIndex] = SubmitFrame(rhi, uploads, frameIndex);
+		EXPECT(uploads.GetStats().ringUsedBytes <= kRingSize);
+	}
+
+	EXPECT(wraps > 4);
+	EXPECT_EQ(uploads.GetStats().ringFullRejections, 0u);
+	EXPECT_EQ(uploads.GetStats().dedicatedStagingBuffers, 0u);
+}
+
+// ============================================================================
+// Dedicated Staging
+// ============================================================================
+
+TEST_CASE(UploadQueue_OversizedUploadGetsDedicatedStaging)
+{
+	NullRhi rhi;
+	rhi.SetManualFenceCompletion(true);
+	RHIBuffer destination(rhi, RHIBufferDesc{4096, RHIHeapType::Default, L"Destination"});
+	GPUUploadQueue uploads(rhi, 1024);
+
+	const std::vector<std::byte> payload = MakePayload(2048, 17);
+	const UploadTicket ticket = uploads.UploadBuffer(rhi.GetNativeBuffer(destination.GetHandle()), 0, payload.data(), payload.size());
+	REQUIRE(ticket.IsValid());
+	EXPECT_EQ(uploads.GetStats().dedicatedStagingBuffers, 1u);
+	EXPECT_EQ(uploads.GetStats().ringUsedBytes, 0u);
+
+	// The staging buffer lives until its batch retires
+	const std::uint64_t buffersBefore = rhi.GetDeviceStats().buffersLive;
+	const std::uint64_t fenceValue = SubmitFrame(rhi, uploads, 0);
+	EXPECT_EQ(rhi.GetDeviceStats().buffersLive, buffersBefore);
+
+	rhi.CompleteFenceValue(fenceValue);
+	uploads.BeginFrame();
+	EXPECT(uploads.IsComplete(ticket));
+	EXPECT_EQ(rhi.GetDeviceStats().buffersLive, buffersBefore - 1);
+}
@@ -0,0 +1,158 @@
+// ============================================================================
+// InstanceBatcherTests.cpp
+// InstanceBatcher over hand-ordered packets: merging, splitting, adjacency.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/SceneData/InstanceBatcher.h"
+#include "Renderer/Public/SceneData/MeshDraw.h"
+
+#include <vector>
+
+namespace
+{
+	// Stand-ins for shared MeshData: only their addresses matter
+	const int kCubeGeometry = 0;
+	const int kSphereGeometry = 0;
+
+	MeshDraw MakeDraw(std::uint32_t objectId, const void* geometry, std::uint32_t materialId)
+	{
+		MeshDraw draw;
+		draw.objectId = objectId;
+		draw.materialId = materialId;
+		draw.geometry = geometry;
+		draw.meshHandle = {objectId, 0};
+		return draw;
+	}
+
+	// Packets in the given draw order (as if the DrawList had sorted them so)
+	std::vector<DrawPacket> MakePackets(std::initializer_list<std::uint32_t> drawOrder)
+	{
+		std::vector<DrawPacket> packets;
+		for (const std::uint32_t drawIndex : drawOrder)
+		{
+			packets.push_back({0, drawIndex});
+		}
+		return packets;
+	}
+}  // namespace
+
+// ============================================================================
+// Merging
+// ============================================================================
+
+TEST_CASE(InstanceBatcher_MergesAdjacentDrawsSharingGeometryAndMaterial)
+{
+	const std::vector<MeshDraw> draws = {
+	    MakeDraw(0, &kCubeGeometry, 1),
+	    MakeDraw(1, &kCubeGeometry, 1),
+	    MakeDraw(2, &kCubeGeometry, 1),
+	};
+
+	InstanceBatcher batcher;
+	batcher.Build(MakePackets({2, 0, 1}), draws);
+
+	REQUIRE(batcher.GetBatches().size() == 1);
+	const InstanceBatch& batch = batcher.GetBatches()[0];
+	EXPECT_EQ(batch.instanceCount, 3u);
+	EXPECT_EQ(batch.firstInstance, 0u);
+	EXPECT(batch.geometry == &kCubeGeometry);
+	EXPECT_EQ(batch.materialId, 1u);
+
+	// The batch takes its mesh handle from its first draw; instances keep packet order
+	EXPECT(batch.meshHandle == draws[2].meshHandle);
+	EXPECT_EQ(batcher.GetInstanceDrawIndices()[0], 2u);
+	EXPECT_EQ(batcher.GetInstanceDrawIndices()[1], 0u);
+	EXPECT_EQ(batcher.GetInstanceDrawIndices()[2], 1u);
+
+	EXPECT_EQ(batcher.GetStats().instanceCount, 3u);
+	EXPECT_EQ(batcher.GetStats().batchCount, 1u);
+	EXPECT_EQ(batcher.GetStats().largestBatch, 3u);
+	EXPECT_EQ(batcher.GetStats().GetDrawCallsSaved(), 2u);
+}
+
+// ============================================================================
+// Splitting
+// ============================================================================
+
+TEST_CASE(InstanceBatcher_SplitsOnMaterialChange)
+{
+	const std::vector<MeshDraw> draws = {
+	    MakeDraw(0, &kCubeGeometry, 1),
+	    MakeDraw(1, &kCubeGeometry, 1),
+	    MakeDraw(2, &kCubeGeometry, 2),
+	};
+
+	InstanceBatcher batcher;
+	batcher.Build(MakePackets({0, 1, 2}), draws);
+
+	REQUIRE(batcher.GetBatches().size() == 2);
+	EXPECT_EQ(batcher.GetBatches()[0].instanceCount, 2u);
+	EXPECT_EQ(batcher.GetBatches()[0].materialId, 1u);
+	EXPECT_EQ(batcher.GetBatches()[1].instanceCount, 1u);
+	EXPECT_EQ(batcher.GetBatches()[1].firstInstance, 2u);
+	EXPECT_EQ(batcher.GetBatches()[1].materialId, 2u);
+}
+
+TEST_CASE(InstanceBatcher_SplitsOnGeometryChange)
+{
+	const std::vector<MeshDraw> draws = {
+	    MakeDraw(0, &kCubeGeometry, 1),
+	    MakeDraw(1, &kSphereGeometry, 1),
+	};
+
+	InstanceBatcher batcher;
+	batcher.Build(MakePackets({0, 1}), draws);
+
+	REQUIRE(batcher.GetBatches().size() == 2);
+	EXPECT(batcher.GetBatches()[0].geometry == &kCubeGeometry);
+	EXPECT(batcher.GetBatches()[1].geometry == &kSphereGeometry);
+	EXPECT_EQ(batcher.GetStats().GetDrawCallsSaved(), 0u);
+}
+
+TEST_CASE(InstanceBatcher_NonAdjacentMatchesAreNotMerged)
+{
+	// cube, sphere, cube: the batcher trusts the sort and only merges runs
+	const std::vector<MeshDraw> draws = {
+	    MakeDraw(0, &kCubeGeometry, 1),
+	    MakeDraw(1, &kSphereGeometry, 1),
+	    MakeDraw(2, &kCubeGeometry, 1),
+	};
+
+	InstanceBatcher batcher;
+	batcher.Build(MakePackets({0, 1, 2}), draws);
+
+	REQUIRE(batcher.GetBatches().size() == 3);
+	for (const InstanceBatch& batch : batcher.GetBatches())
+	{
+		EXPECT_EQ(batch.instanceCount, 1u);
+	}
+
+	// Sorted so the cubes are adjacent, the same draws make two batches
+	batcher.Build(MakePackets({0, 2, 1}), draws);
+	REQUIRE(batcher.GetBatches().size() == 2);
+	EXPECT_EQ(batcher.GetBatches()[0].instanceCount, 2u);
+	EXPECT_EQ(batcher.GetBatches()[1].instanceCount, 1u);
+}
+
+// ============================================================================
+// Rebuild
+// ============================================================================
+
+TEST_CASE(InstanceBatcher_RebuildStartsOver)
+{
+	const std::vector<MeshDraw> draws = {
+	    MakeDraw(0, &kCubeGeometry, 1),
+	    MakeDraw(1, &kCubeGeometry, 1),
+	};
+
+	InstanceBatcher batcher;
+	batcher.Build(MakePackets({0, 1}), draws);
+	batcher.Build({}, draws);
+
+	EXPECT(batcher.GetBatches().empty());
+	EXPECT(batcher.GetInstanceDrawIndices().empty());
+	EXPECT_EQ(batcher.GetStats().batchCount, 0u);
+	EXPECT_EQ(batcher.GetStats().largestBatch, 0u);
+}
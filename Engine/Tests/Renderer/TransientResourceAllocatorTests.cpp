@@ -0,0 +1,174 @@
+// ============================================================================
+// TransientResourceAllocatorTests.cpp
+// Lifetime-based first-fit placement and heap aliasing of transients.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Renderer/Public/FrameGraph/TransientResourceAllocator.h"
+
+#include <vector>
+
+namespace
+{
+	constexpr std::uint64_t kUnit = RHIPlacementAlignment;
+}  // namespace
+
+// ============================================================================
+// Aliasing
+// ============================================================================
+
+TEST_CASE(TransientAllocator_DisjointLifetimesShareMemory)
+{
+	const std::vector<TransientAllocationRequest> requests = {
+	    {4 * kUnit, 0, 1},
+	    {4 * kUnit, 2, 3},
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	REQUIRE(placements.size() == 2);
+	EXPECT_EQ(placements[0].heapIndex, 0u);
+	EXPECT_EQ(placements[1].heapIndex, 0u);
+	EXPECT_EQ(placements[0].offset, 0u);
+	EXPECT_EQ(placements[1].offset, 0u);
+
+	const TransientMemoryStats& stats = allocator.GetStats();
+	EXPECT_EQ(stats.heapCount, 1u);
+	EXPECT_EQ(stats.bytesWithoutAliasing, 8 * kUnit);
+	EXPECT_EQ(stats.bytesWithAliasing, 4 * kUnit);
+	EXPECT_EQ(stats.peakLiveBytes, 4 * kUnit);
+}
+
+TEST_CASE(TransientAllocator_OverlappingLifetimesDoNotOverlapInMemory)
+{
+	// Touching at pass 1 counts as overlapping: lifetimes are inclusive
+	const std::vector<TransientAllocationRequest> requests = {
+	    {2 * kUnit, 0, 1},
+	    {3 * kUnit, 1, 2},
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	// Largest first: request 1 sits at offset 0
+	EXPECT_EQ(placements[1].offset, 0u);
+	EXPECT_EQ(placements[0].offset, 3 * kUnit);
+	EXPECT_EQ(allocator.GetStats().bytesWithAliasing, 5 * kUnit);
+	EXPECT_EQ(allocator.GetStats().peakLiveBytes, 5 * kUnit);
+}
+
+TEST_CASE(TransientAllocator_FirstFitReusesGapBelowLiveResource)
+{
+	// A [0,4) is dead once C starts, so C takes the gap below B
+	const std::vector<TransientAllocationRequest> requests = {
+	    {4 * kUnit, 0, 0},  // A
+	    {2 * kUnit, 0, 3},  // B, placed above A
+	    {1 * kUnit, 1, 3},  // C
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	EXPECT_EQ(placements[0].offset, 0u);
+	EXPECT_EQ(placements[1].offset, 4 * kUnit);
+	EXPECT_EQ(placements[2].offset, 0u);
+	EXPECT_EQ(allocator.GetStats().heapCount, 1u);
+	EXPECT_EQ(allocator.GetStats().bytesWithAliasing, 6 * kUnit);
+}
+
+TEST_CASE(TransientAllocator_OffsetsStayPlacementAligned)
+{
+	const std::vector<TransientAllocationRequest> requests = {
+	    {kUnit + 1, 0, 2},
+	    {100, 0, 2},
+	    {kUnit / 2, 1, 1},
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	for (const TransientPlacement& placement : placements)
+	{
+		EXPECT(placement.IsPlaced());
+		EXPECT_EQ(placement.offset % RHIPlacementAlignment, 0u);
+	}
+	EXPECT_NE(placements[0].offset, placements[1].offset);
+	EXPECT_NE(placements[1].offset, placements[2].offset);
+}
+
+// ============================================================================
+// Heaps
+// ============================================================================
+
+TEST_CASE(TransientAllocator_OpensNewHeapPastMaxSize)
+{
+	const std::vector<TransientAllocationRequest> requests = {
+	    {2 * kUnit, 0, 1},
+	    {2 * kUnit, 0, 1},
+	    {3 * kUnit, 0, 1},  // Larger than the cap: a heap of its own
+	};
+
+	TransientResourceAllocator allocator(2 * kUnit);
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	EXPECT_EQ(allocator.GetStats().heapCount, 3u);
+	EXPECT_EQ(placements[2].heapIndex, 0u);
+	EXPECT_EQ(placements[0].heapIndex, 1u);
+	EXPECT_EQ(placements[1].heapIndex, 2u);
+	for (const TransientPlacement& placement : placements)
+	{
+		EXPECT_EQ(placement.offset, 0u);
+	}
+
+	const std::span<const std::uint64_t> heapSizes = allocator.GetHeapSizes();
+	REQUIRE(heapSizes.size() == 3);
+	EXPECT_EQ(heapSizes[0], 3 * kUnit);
+	EXPECT_EQ(heapSizes[1], 2 * kUnit);
+}
+
+TEST_CASE(TransientAllocator_UnsizedRequestsStayUnplaced)
+{
+	const std::vector<TransientAllocationRequest> requests = {
+	    {0, 0, 0},
+	    {kUnit, 0, 0},
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> placements;
+	allocator.Place(requests, placements);
+
+	EXPECT(!placements[0].IsPlaced());
+	EXPECT(placements[1].IsPlaced());
+	EXPECT_EQ(allocator.GetStats().resourceCount, 1u);
+}
+
+TEST_CASE(TransientAllocator_PlacementIsRepeatable)
+{
+	const std::vector<TransientAllocationRequest> requests = {
+	    {3 * kUnit, 0, 2},
+	    {kUnit, 1, 4},
+	    {2 * kUnit, 3, 5},
+	};
+
+	TransientResourceAllocator allocator;
+	std::vector<TransientPlacement> first;
+	std::vector<TransientPlacement> second;
+	allocator.Place(requests, first);
+	const TransientMemoryStats firstStats = allocator.GetStats();
+	allocator.Place(requests, second);
+
+	REQUIRE(first.size() == second.size());
+	for (std::size_t i = 0; i < first.size(); ++i)
+	{
+		EXPECT_EQ(first[i].heapIndex, second[i].heapIndex);
+		EXPECT_EQ(first[i].offset, second[i].offset);
+	}
+	EXPECT(firstStats == allocator.GetStats());
+}
@@ -0,0 +1,82 @@
+// ============================================================================
+// TestFramework.h
+// Minimal self-registering test cases for the headless test executables.
+// ----------------------------------------------------------------------------
+// USAGE:
+//   TEST_CASE(Tlsf_AllocateFree)
+//   {
+//       TlsfAllocator allocator(1024);
+//       EXPECT(allocator.Allocate(64).IsValid());
+//       EXPECT_EQ(allocator.GetStats().allocationCount, 1u);
+//   }
+//
+// DESIGN:
+//   - Each test executable links TestMain.cpp, which runs every registered
+//     case and returns non-zero if any check failed (ctest reads the code)
+//   - A failed EXPECT logs file:line and the expression, then continues with
+//     the rest of the case; REQUIRE returns from the case instead
+//   - EXPECT rather than CHECK: Log.h's CHECK is the HRESULT check
+//   - No third-party dependency, so the tests build wherever Core does
+// ============================================================================
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace Test
+{
+	using TestFunction = void (*)();
+
+	struct TestCase
+	{
+		const char* name = nullptr;
+		TestFunction function = nullptr;
+	};
+
+	// Function-local statics: registration runs during static initialization
+	inline std::vector<TestCase>& GetRegistry()
+	{
+		static std::vector<TestCase> registry;
+		return registry;
+	}
+
+	inline std::uint32_t& GetFailureCount()
+	{
+		static std::uint32_t failures = 0;
+		return failures;
+	}
+
+	inline bool Register(const char* name, TestFunction function)
+	{
+		GetRegistry().push_back({name, function});
+		return true;
+	}
+
+	inline bool Report(bool bPassed, const char* expression, const char* file, int line)
+	{
+		if (!bPassed)
+		{
+			++GetFailureCount();
+			std::fprintf(stderr, "%s:%d: EXPECT failed: %s\n", file, line, expression);
+		}
+		return bPassed;
+	}
+}  // namespace Test
+
+#define TEST_CASE(name)                                                  \
+	static void name();                                                  \
+	static const bool name##_registered = ::Test::Register(#name, name); \
+	static void name()
+
+#define EXPECT(expr) ::Test::Report(static_cast<bool>(expr), #expr, __FILE__, __LINE__)
+#define EXPECT_EQ(a, b) ::Test::Report((a) == (b), #a " == " #b, __FILE__, __LINE__)
+#define EXPECT_NE(a, b) ::Test::Report((a) != (b), #a " != " #b, __FILE__, __LINE__)
+
+#define REQUIRE(expr)                                                     \
+	do                                                                    \
+	{                                                                     \
+		if (!::Test::Report(static_cast<bool>(expr), #expr, __FILE__, __LINE__)) \
+			return;                                                       \
+	} while (false)
@@ -0,0 +1,27 @@
+// ============================================================================
+// TestMain.cpp
+// Runs every TEST_CASE linked into the executable.
+// ============================================================================
+
+#include "TestFramework.h"
+
+#include "Core/Public/Diagnostics/Log.h"
+
+#include <cstdio>
+
+int main()
+{
+	// Negative-path cases log expected errors; keep the output to test results
+	Logger::SetLevel(LogLevel::Fatal);
+
+	for (const Test::TestCase& test : Test::GetRegistry())
+	{
+		const std::uint32_t failuresBefore = Test::GetFailureCount();
+		test.function();
+		std::printf("[%s] %s\n", Test::GetFailureCount() == failuresBefore ? "PASS" : "FAIL", test.name);
+	}
+
+	const std::uint32_t failures = Test::GetFailureCount();
+	std::printf("%zu cases, %u failed checks\n", Test::GetRegistry().size(), failures);
+	return failures == 0 ? 0 : 1;
+}